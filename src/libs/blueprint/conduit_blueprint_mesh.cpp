@@ -19,11 +19,13 @@
 // std lib includes
 //-----------------------------------------------------------------------------
 #include <algorithm>
+#include <array>
 #include <deque>
 #include <cmath>
 #include <cstring>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <iterator>
 
@@ -39,6 +41,7 @@
 #include "conduit_blueprint_mesh.hpp"
 #include "conduit_log.hpp"
 #include "conduit_annotations.hpp"
+#include "conduit_execution.hpp"
 
 using namespace conduit;
 // Easier access to the Conduit logging functions
@@ -921,6 +924,635 @@ verify_multi_domain(const Node &n,
     return res;
 }
 
+//-------------------------------------------------------------------------
+// verify cache state: fingerprints of domains that passed verify
+static bool verify_cache_on = false;
+static std::set<std::pair<uint64,uint64>> verify_cache;
+static std::mutex verify_cache_mutex;
+
+//-------------------------------------------------------------------------
+// numeric leaves at or below this length are hashed by value, which covers
+// the entries verify inspects (dims, origin, spacing, shape maps, ...)
+static const index_t VERIFY_FINGERPRINT_MAX_VALUES = 16;
+
+//-------------------------------------------------------------------------
+inline void
+fingerprint_mix(uint64 &h1, uint64 &h2, const uint8 *bytes, size_t nbytes)
+{
+    // two independent 64-bit FNV-1a streams, so a collision requires
+    // both to collide
+    for(size_t i = 0; i < nbytes; i++)
+    {
+        h1 = (h1 ^ bytes[i]) * 0x100000001b3ULL;
+        h2 = (h2 ^ bytes[i]) * 0x00000100000001d3ULL + 0x9e3779b97f4a7c15ULL;
+    }
+}
+
+//-------------------------------------------------------------------------
+template <typename T>
+inline void
+fingerprint_mix(uint64 &h1, uint64 &h2, T value)
+{
+    fingerprint_mix(h1, h2, reinterpret_cast<const uint8 *>(&value), sizeof(T));
+}
+
+//-------------------------------------------------------------------------
+void
+verify_fingerprint(const Node &n, uint64 &h1, uint64 &h2)
+{
+    const DataType &dt = n.dtype();
+    fingerprint_mix(h1, h2, dt.id());
+
+    if(dt.is_object() || dt.is_list())
+    {
+        const index_t nchildren = n.number_of_children();
+        const std::vector<std::string> &names = n.child_names();
+        fingerprint_mix(h1, h2, nchildren);
+        for(index_t i = 0; i < nchildren; i++)
+        {
+            if(dt.is_object())
+            {
+                const std::string &name = names[i];
+                fingerprint_mix(h1, h2, name.size());
+                fingerprint_mix(h1, h2,
+                                reinterpret_cast<const uint8 *>(name.data()),
+                                name.size());
+            }
+            verify_fingerprint(n.child(i), h1, h2);
+        }
+    }
+    else if(dt.is_string())
+    {
+        // hash the string value, not its (possibly padded) buffer
+        const std::string value = n.as_string();
+        fingerprint_mix(h1, h2, value.size());
+        fingerprint_mix(h1, h2,
+                        reinterpret_cast<const uint8 *>(value.data()),
+                        value.size());
+    }
+    else if(!dt.is_empty())
+    {
+        const index_t nelems = dt.number_of_elements();
+        fingerprint_mix(h1, h2, nelems);
+        if(nelems <= VERIFY_FINGERPRINT_MAX_VALUES)
+        {
+            const index_t ebytes = dt.element_bytes();
+            for(index_t i = 0; i < nelems; i++)
+            {
+                fingerprint_mix(h1, h2,
+                                static_cast<const uint8 *>(n.element_ptr(i)),
+                                static_cast<size_t>(ebytes));
+            }
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+bool
+verify_single_domain_quick(const Node &dom, Node &scratch)
+{
+    std::pair<uint64,uint64> key(0xcbf29ce484222325ULL, 0x84222325cbf29ce4ULL);
+    bool use_cache = false;
+    {
+        std::lock_guard<std::mutex> lock(verify_cache_mutex);
+        use_cache = verify_cache_on;
+    }
+
+    if(use_cache)
+    {
+        verify_fingerprint(dom, key.first, key.second);
+        std::lock_guard<std::mutex> lock(verify_cache_mutex);
+        if(verify_cache.find(key) != verify_cache.end())
+        {
+            return true;
+        }
+    }
+
+    const bool msgs = log::messages_enabled();
+    log::set_messages_enabled(false);
+    bool res = false;
+    try
+    {
+        res = verify_single_domain(dom, scratch);
+    }
+    catch(...)
+    {
+        log::set_messages_enabled(msgs);
+        throw;
+    }
+    log::set_messages_enabled(msgs);
+
+    if(use_cache && res)
+    {
+        std::lock_guard<std::mutex> lock(verify_cache_mutex);
+        if(verify_cache_on)
+        {
+            verify_cache.insert(key);
+        }
+    }
+
+    return res;
+}
+
+//-------------------------------------------------------------------------
+// deep verify helpers
+//-------------------------------------------------------------------------
+
+//-------------------------------------------------------------------------
+// Number of entries each deep verify task scans serially.
+static const index_t DEEP_VERIFY_BLOCK_SIZE = 16384;
+
+//-------------------------------------------------------------------------
+/**
+ @brief Scans [0, n) in parallel blocks and collects the first max_bad
+        indices (in increasing order) for which is_bad(i) is true.
+ */
+template <typename BadFunc>
+void
+deep_verify_scan(index_t n,
+                 index_t max_bad,
+                 const BadFunc &is_bad,
+                 std::vector<index_t> &bad)
+{
+#if defined(CONDUIT_USE_OPENMP)
+    using policy = conduit::execution::OpenMPExec;
+#else
+    using policy = conduit::execution::SerialExec;
+#endif
+    bad.clear();
+    if(n <= 0 || max_bad <= 0)
+    {
+        return;
+    }
+
+    const index_t nblocks = (n + DEEP_VERIFY_BLOCK_SIZE - 1) / DEEP_VERIFY_BLOCK_SIZE;
+    std::vector<std::vector<index_t>> block_bad(static_cast<size_t>(nblocks));
+    conduit::execution::for_all<policy>(0, nblocks, [&](index_t bi)
+    {
+        const index_t start = bi * DEEP_VERIFY_BLOCK_SIZE;
+        const index_t end = std::min(n, start + DEEP_VERIFY_BLOCK_SIZE);
+        std::vector<index_t> &found = block_bad[bi];
+        for(index_t i = start; i < end; i++)
+        {
+            if(is_bad(i))
+            {
+                found.push_back(i);
+                if(static_cast<index_t>(found.size()) >= max_bad)
+                {
+                    break;
+                }
+            }
+        }
+    });
+
+    for(index_t bi = 0; bi < nblocks &&
+                        static_cast<index_t>(bad.size()) < max_bad; bi++)
+    {
+        for(size_t j = 0; j < block_bad[bi].size() &&
+                          static_cast<index_t>(bad.size()) < max_bad; j++)
+        {
+            bad.push_back(block_bad[bi][j]);
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+/**
+ @brief Records a deep verify failure for the given indices: an error
+        message listing them and an "invalid_indices" array in info.
+ */
+void
+deep_verify_report(const std::string &protocol,
+                   Node &info,
+                   const std::string &msg,
+                   const std::vector<index_t> &bad)
+{
+    std::ostringstream oss;
+    oss << msg << " at indices [";
+    for(size_t i = 0; i < bad.size(); i++)
+    {
+        oss << (i > 0 ? ", " : "") << bad[i];
+    }
+    oss << "]";
+    log::error(info, protocol, oss.str());
+    info["invalid_indices"].set(bad);
+    log::validation(info, false);
+}
+
+//-------------------------------------------------------------------------
+/**
+ @brief Checks that the values of an index array are in [0, upper).
+ */
+bool
+deep_verify_index_range(const std::string &protocol,
+                        const Node &values,
+                        index_t upper,
+                        index_t max_bad,
+                        Node &info)
+{
+    const index_t_accessor vals = values.as_index_t_accessor();
+    std::vector<index_t> bad;
+    deep_verify_scan(vals.number_of_elements(), max_bad, [&](index_t i)
+    {
+        const index_t v = vals[i];
+        return v < 0 || v >= upper;
+    }, bad);
+
+    if(!bad.empty())
+    {
+        std::ostringstream oss;
+        oss << "values outside of [0, " << upper << ")";
+        deep_verify_report(protocol, info, oss.str(), bad);
+    }
+    return bad.empty();
+}
+
+//-------------------------------------------------------------------------
+/**
+ @brief Checks the "sizes" and "offsets" of an o2m style node (elements or
+        subelements) against the length of its "connectivity": offsets must
+        be non-decreasing, sizes non-negative, both must have the same
+        length, and every offset + size must be within connectivity.
+ */
+bool
+deep_verify_sizes_offsets(const std::string &protocol,
+                          const Node &elems,
+                          index_t max_bad,
+                          Node &info)
+{
+    bool res = true;
+    const index_t conn_len = elems["connectivity"].dtype().number_of_elements();
+    const bool has_sizes = elems.has_child("sizes");
+    const bool has_offsets = elems.has_child("offsets");
+
+    if(has_sizes && has_offsets)
+    {
+        const index_t nsizes = elems["sizes"].dtype().number_of_elements();
+        const index_t noffsets = elems["offsets"].dtype().number_of_elements();
+        if(nsizes != noffsets)
+        {
+            std::ostringstream oss;
+            oss << "'sizes' and 'offsets' lengths differ ("
+                << nsizes << " vs " << noffsets << ")";
+            log::error(info["offsets"], protocol, oss.str());
+            log::validation(info["offsets"], false);
+            return false;
+        }
+    }
+
+    std::vector<index_t> bad;
+    if(has_sizes)
+    {
+        const index_t_accessor sizes = elems["sizes"].as_index_t_accessor();
+        deep_verify_scan(sizes.number_of_elements(), max_bad, [&](index_t i)
+        {
+            return sizes[i] < 0;
+        }, bad);
+        if(!bad.empty())
+        {
+            deep_verify_report(protocol, info["sizes"], "negative sizes", bad);
+            res = false;
+        }
+    }
+
+    if(has_offsets)
+    {
+        const index_t_accessor offsets = elems["offsets"].as_index_t_accessor();
+        const index_t noffsets = offsets.number_of_elements();
+        deep_verify_scan(noffsets, max_bad, [&](index_t i)
+        {
+            const index_t o = offsets[i];
+            return o < 0 || o > conn_len || (i > 0 && o < offsets[i - 1]);
+        }, bad);
+        if(!bad.empty())
+        {
+            deep_verify_report(protocol, info["offsets"],
+                "offsets that are decreasing or outside of connectivity", bad);
+            res = false;
+        }
+
+        if(res && has_sizes)
+        {
+            const index_t_accessor sizes = elems["sizes"].as_index_t_accessor();
+            deep_verify_scan(noffsets, max_bad, [&](index_t i)
+            {
+                return offsets[i] + sizes[i] > conn_len;
+            }, bad);
+            if(!bad.empty())
+            {
+                deep_verify_report(protocol, info["sizes"],
+                    "offsets + sizes beyond the end of connectivity", bad);
+                res = false;
+            }
+        }
+    }
+
+    return res;
+}
+
+//-------------------------------------------------------------------------
+bool
+deep_verify_topology(const Node &dom,
+                     const Node &topo,
+                     index_t max_bad,
+                     Node &info)
+{
+    const std::string protocol = "mesh::topology::unstructured";
+    if(topo["type"].as_string() != "unstructured")
+    {
+        return true;
+    }
+
+    bool res = true;
+    const Node &cset = dom["coordsets"][topo["coordset"].as_string()];
+    const index_t npts = bputils::coordset::length(cset);
+    const Node &elems = topo["elements"];
+    Node &elems_info = info["elements"];
+
+    // multiple element type streams are left to the structural verify
+    if(!elems.has_child("connectivity"))
+    {
+        return true;
+    }
+
+    const std::string shape = elems["shape"].as_string();
+    const bool is_polyhedral = shape == "polyhedral";
+    const bool is_mixed = shape == "mixed";
+
+    if(is_polyhedral || (is_mixed && topo.has_child("subelements")))
+    {
+        // element connectivity references faces, face connectivity
+        // references points
+        const Node &subelems = topo["subelements"];
+        Node &subelems_info = info["subelements"];
+        const index_t nfaces = subelems.has_child("sizes") ?
+            subelems["sizes"].dtype().number_of_elements() :
+            subelems["offsets"].dtype().number_of_elements();
+
+        if(!is_mixed)
+        {
+            res &= deep_verify_index_range(protocol, elems["connectivity"],
+                nfaces, max_bad, elems_info["connectivity"]);
+        }
+        res &= deep_verify_sizes_offsets(protocol, elems, max_bad, elems_info);
+        res &= deep_verify_index_range(protocol, subelems["connectivity"],
+            npts, max_bad, subelems_info["connectivity"]);
+        res &= deep_verify_sizes_offsets(protocol, subelems, max_bad,
+            subelems_info);
+        log::validation(subelems_info, res);
+    }
+    else
+    {
+        res &= deep_verify_index_range(protocol, elems["connectivity"],
+            npts, max_bad, elems_info["connectivity"]);
+        if(elems.has_child("sizes") || elems.has_child("offsets"))
+        {
+            res &= deep_verify_sizes_offsets(protocol, elems, max_bad,
+                elems_info);
+        }
+        else if(!is_mixed && shape != "polygonal")
+        {
+            const index_t conn_len =
+                elems["connectivity"].dtype().number_of_elements();
+            const index_t nindices = ShapeType(shape).indices;
+            if(nindices > 0 && conn_len % nindices != 0)
+            {
+                std::ostringstream oss;
+                oss << "connectivity length " << conn_len
+                    << " is not a multiple of " << nindices
+                    << " for shape" << log::quote(shape, 1);
+                log::error(elems_info["connectivity"], protocol, oss.str());
+                log::validation(elems_info["connectivity"], false);
+                res = false;
+            }
+        }
+    }
+
+    log::validation(elems_info, res);
+    log::validation(info, res);
+    return res;
+}
+
+//-------------------------------------------------------------------------
+bool
+deep_verify_matset(const Node &dom,
+                   const Node &matset,
+                   index_t max_bad,
+                   float64 tolerance,
+                   Node &info)
+{
+#if defined(CONDUIT_USE_OPENMP)
+    using policy = conduit::execution::OpenMPExec;
+#else
+    using policy = conduit::execution::SerialExec;
+#endif
+    const std::string protocol = "mesh::matset";
+    const Node &topo = dom["topologies"][matset["topology"].as_string()];
+    const index_t nelems = bputils::topology::length(topo);
+    const Node &vfs = matset["volume_fractions"];
+    Node &vfs_info = info["volume_fractions"];
+    std::vector<index_t> bad;
+    bool res = true;
+
+    std::vector<float64> sums;
+    const bool elem_dom = blueprint::mesh::matset::is_element_dominant(matset);
+    if(blueprint::mesh::matset::is_uni_buffer(matset))
+    {
+        const float64_accessor vf_vals = vfs.as_float64_accessor();
+        const bool has_indices = matset.has_child("indices");
+        index_t_accessor indices;
+        if(has_indices)
+        {
+            indices = matset["indices"].as_index_t_accessor();
+        }
+
+        if(elem_dom)
+        {
+            // sizes and offsets group the volume fractions by element
+            std::vector<index_t> offsets_vec;
+            const bool has_sizes = matset.has_child("sizes");
+            const bool has_offsets = matset.has_child("offsets");
+            index_t_accessor sizes, offsets;
+            if(has_sizes)
+            {
+                sizes = matset["sizes"].as_index_t_accessor();
+            }
+            if(has_offsets)
+            {
+                offsets = matset["offsets"].as_index_t_accessor();
+            }
+            const index_t nvals = has_indices ? indices.number_of_elements()
+                                              : vf_vals.number_of_elements();
+            const index_t ngroups = has_sizes ? sizes.number_of_elements() :
+                                    has_offsets ? offsets.number_of_elements() :
+                                    nvals;
+
+            // bad groups can not be summed safely
+            deep_verify_scan(ngroups, max_bad, [&](index_t i)
+            {
+                const index_t sz = has_sizes ? sizes[i] : 1;
+                return sz < 0 || (has_offsets &&
+                                  (offsets[i] < 0 || offsets[i] + sz > nvals));
+            }, bad);
+            if(!bad.empty())
+            {
+                deep_verify_report(protocol, info["offsets"],
+                    "sizes or offsets outside of volume_fractions", bad);
+                res = false;
+            }
+            else
+            {
+                // without offsets the groups are contiguous
+                if(!has_offsets && has_sizes)
+                {
+                    offsets_vec.resize(static_cast<size_t>(ngroups));
+                    index_t o = 0;
+                    for(index_t i = 0; i < ngroups; i++)
+                    {
+                        offsets_vec[i] = o;
+                        o += sizes[i];
+                    }
+                    if(o > nvals)
+                    {
+                        log::error(info["sizes"], protocol,
+                            "sizes sum past the end of volume_fractions");
+                        log::validation(info["sizes"], false);
+                        res = false;
+                    }
+                }
+
+                if(res)
+                {
+                    sums.resize(static_cast<size_t>(ngroups), 0.0);
+                    conduit::execution::for_all<policy>(0, ngroups, [&](index_t i)
+                    {
+                        const index_t o = has_offsets ? offsets[i] :
+                                          (has_sizes ? offsets_vec[i] : i);
+                        const index_t sz = has_sizes ? sizes[i] : 1;
+                        float64 sum = 0.0;
+                        for(index_t j = o; j < o + sz; j++)
+                        {
+                            sum += vf_vals[has_indices ? indices[j] : j];
+                        }
+                        sums[i] = sum;
+                    });
+                }
+            }
+        }
+        else
+        {
+            // material dominant: element_ids scatter the volume fractions
+            const index_t_accessor eids = matset["element_ids"].as_index_t_accessor();
+            res &= deep_verify_index_range(protocol, matset["element_ids"],
+                nelems, max_bad, info["element_ids"]);
+            if(res)
+            {
+                sums.resize(static_cast<size_t>(nelems), 0.0);
+                for(index_t i = 0; i < eids.number_of_elements(); i++)
+                {
+                    sums[eids[i]] += vf_vals[has_indices ? indices[i] : i];
+                }
+            }
+        }
+    }
+    else
+    {
+        sums.resize(static_cast<size_t>(nelems), 0.0);
+        NodeConstIterator itr = vfs.children();
+        while(itr.has_next() && res)
+        {
+            const Node &mat_vfs = itr.next();
+            const std::string mat_name = itr.name();
+            const float64_accessor vf_vals = mat_vfs.as_float64_accessor();
+            if(elem_dom)
+            {
+                if(vf_vals.number_of_elements() != nelems)
+                {
+                    std::ostringstream oss;
+                    oss << "has " << vf_vals.number_of_elements()
+                        << " volume fractions for " << nelems << " elements";
+                    log::error(vfs_info[mat_name], protocol, oss.str());
+                    log::validation(vfs_info[mat_name], false);
+                    res = false;
+                    break;
+                }
+                for(index_t i = 0; i < nelems; i++)
+                {
+                    sums[i] += vf_vals[i];
+                }
+            }
+            else
+            {
+                const Node &mat_eids = matset["element_ids"][mat_name];
+                res &= deep_verify_index_range(protocol, mat_eids, nelems,
+                    max_bad, info["element_ids"][mat_name]);
+                if(res)
+                {
+                    const index_t_accessor eids = mat_eids.as_index_t_accessor();
+                    for(index_t i = 0; i < eids.number_of_elements(); i++)
+                    {
+                        sums[eids[i]] += vf_vals[i];
+                    }
+                }
+            }
+        }
+    }
+
+    if(res)
+    {
+        deep_verify_scan(static_cast<index_t>(sums.size()), max_bad,
+            [&](index_t i)
+        {
+            return std::abs(sums[i] - 1.0) > tolerance;
+        }, bad);
+        if(!bad.empty())
+        {
+            deep_verify_report(protocol, vfs_info,
+                "volume fractions that do not sum to 1", bad);
+            res = false;
+        }
+    }
+
+    log::validation(info, res);
+    return res;
+}
+
+//-------------------------------------------------------------------------
+bool
+deep_verify_domain(const Node &dom,
+                   index_t max_bad,
+                   float64 tolerance,
+                   Node &info)
+{
+    bool res = true;
+    NodeConstIterator itr = dom["topologies"].children();
+    while(itr.has_next())
+    {
+        const Node &topo = itr.next();
+        Node &topo_info = info["topologies"][itr.name()];
+        bool topo_res = deep_verify_topology(dom, topo, max_bad, topo_info);
+        log::validation(info["topologies"], topo_res);
+        res &= topo_res;
+    }
+
+    if(dom.has_child("matsets"))
+    {
+        itr = dom["matsets"].children();
+        while(itr.has_next())
+        {
+            const Node &matset = itr.next();
+            Node &mset_info = info["matsets"][itr.name()];
+            bool mset_res = deep_verify_matset(dom, matset, max_bad,
+                                               tolerance, mset_info);
+            log::validation(info["matsets"], mset_res);
+            res &= mset_res;
+        }
+    }
+
+    log::validation(info, res);
+    return res;
+}
+
 //-----------------------------------------------------------------------------
 // - end internal data function helpers -
 //-----------------------------------------------------------------------------
@@ -1472,86 +2104,354 @@ unique_mask(const Container &values, index_t offset, index_t n, int *mask)
 }
 
 //-------------------------------------------------------------------------
-// NOTE: This function is templated to support passing raw pointers (as
-//       well as accessors) and for passing in a custom function to store
-//       the data.
-template <typename IndexType, typename CoordType, typename StorageFunc>
-void
-unstructured_centroid(const ShapeType &topo_shape,
-                      const IndexType &topo_conn,
-                      const IndexType &topo_offsets,
-                      const IndexType &topo_sizes,
-                      index_t topo_num_elems,
-                      const CoordType &coords,
-                      index_t ncoord_dims,
-                      StorageFunc &&store)
+// Number of elements each centroid task processes serially. Tasks reuse
+// their scratch buffers for all of the elements in their block.
+static const index_t CENTROID_BLOCK_SIZE = 1024;
+
+//-------------------------------------------------------------------------
+/**
+ @brief Optional per-element outputs that the centroid kernels can compute
+        in the same pass as the centroids. Null pointers are skipped.
+ */
+struct ElementMeasureOutputs
 {
-    constexpr size_t max_size_guess = 12;
-    std::vector<index_t> eids;
-    std::vector<int> mask;
-    eids.reserve(max_size_guess);
-    mask.reserve(max_size_guess);
+    ElementMeasureOutputs() : measure(nullptr)
+    {
+        for(int ai = 0; ai < 3; ai++)
+        {
+            bbox_min[ai] = nullptr;
+            bbox_max[ai] = nullptr;
+        }
+    }
+
+    // length, area, or volume depending on the element dimension
+    float64 *measure;
+    // per axis bounding box extents
+    float64 *bbox_min[3];
+    float64 *bbox_max[3];
+};
+
+//-------------------------------------------------------------------------
+inline float64
+tet_volume(const float64 *a, const float64 *b, const float64 *c, const float64 *d)
+{
+    const float64 u[3] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+    const float64 v[3] = {c[0] - a[0], c[1] - a[1], c[2] - a[2]};
+    const float64 w[3] = {d[0] - a[0], d[1] - a[1], d[2] - a[2]};
+    const float64 det = u[0] * (v[1] * w[2] - v[2] * w[1]) -
+                        u[1] * (v[0] * w[2] - v[2] * w[0]) +
+                        u[2] * (v[0] * w[1] - v[1] * w[0]);
+    return std::abs(det) / 6.;
+}
+
+//-------------------------------------------------------------------------
+inline float64
+tri_area(const float64 *a, const float64 *b, const float64 *c)
+{
+    const float64 u[3] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+    const float64 v[3] = {c[0] - a[0], c[1] - a[1], c[2] - a[2]};
+    const float64 x = u[1] * v[2] - u[2] * v[1];
+    const float64 y = u[2] * v[0] - u[0] * v[2];
+    const float64 z = u[0] * v[1] - u[1] * v[0];
+    return 0.5 * std::sqrt(x * x + y * y + z * z);
+}
 
-    bool is_polygonal = topo_shape.is_polygonal();
-    for(index_t ei = 0; ei < topo_num_elems; ei++)
+//-------------------------------------------------------------------------
+/**
+ @brief Computes the area of the polygon whose point coordinates are found
+        at pts[3 * face[i]] by fanning triangles around the given center.
+ */
+inline float64
+polygon_area(const float64 *pts, const index_t *face, index_t npts,
+             const float64 *center)
+{
+    float64 area = 0.;
+    for(index_t i = 0; i < npts; i++)
     {
-        const index_t eoffset = topo_offsets[ei];
-        const index_t npts = is_polygonal
-            ? topo_sizes[ei] : topo_shape.indices;
+        const index_t next = (i + 1 < npts) ? i + 1 : 0;
+        area += tri_area(center, pts + 3 * face[i], pts + 3 * face[next]);
+    }
+    return area;
+}
 
-        // Just in case for larger polygons
-        mask.resize(npts);
-        eids.resize(npts);
+//-------------------------------------------------------------------------
+/**
+ @brief Computes the volume of the cone from apex to the polygonal face whose
+        point coordinates are found at pts[3 * face[i]]. The face is split
+        into triangles around its own center.
+ */
+inline float64
+face_cone_volume(const float64 *pts, const index_t *face, index_t npts,
+                 const float64 *apex)
+{
+    float64 fc[3] = {0., 0., 0.};
+    for(index_t i = 0; i < npts; i++)
+    {
+        for(int ai = 0; ai < 3; ai++)
+            fc[ai] += pts[3 * face[i] + ai];
+    }
+    for(int ai = 0; ai < 3; ai++)
+        fc[ai] /= static_cast<float64>(npts);
 
-        // Assuming topo_conn is an index_t accessor. We copy the data
-        // out to an actual index_t buffer first.
-        for(index_t ci = 0; ci < npts; ci++)
-            eids[ci] = topo_conn[eoffset + ci];
+    float64 vol = 0.;
+    for(index_t i = 0; i < npts; i++)
+    {
+        const index_t next = (i + 1 < npts) ? i + 1 : 0;
+        vol += tet_volume(apex, fc, pts + 3 * face[i], pts + 3 * face[next]);
+    }
+    return vol;
+}
+
+//-------------------------------------------------------------------------
+/**
+ @brief Averages the element points (pts, 3 values per point) into centroid,
+        skipping points whose mask value is 0 when a mask is given.
+ */
+inline void
+element_centroid(const float64 *pts, index_t npts, const int *mask,
+                 float64 centroid[3])
+{
+    centroid[0] = centroid[1] = centroid[2] = 0.;
+    index_t npts_used = 0;
+    for(index_t ci = 0; ci < npts; ci++)
+    {
+        if(mask == nullptr || mask[ci])
+        {
+            for(int ai = 0; ai < 3; ai++)
+                centroid[ai] += pts[3 * ci + ai];
+            npts_used++;
+        }
+    }
+    const float64 one_over_npts = 1. / static_cast<float64>(npts_used);
+    for(int ai = 0; ai < 3; ai++)
+        centroid[ai] *= one_over_npts;
+}
+
+//-------------------------------------------------------------------------
+inline void
+element_bbox(const float64 *pts, index_t npts, index_t ei,
+             index_t ncoord_dims, const ElementMeasureOutputs &outputs)
+{
+    if(outputs.bbox_min[0] == nullptr || npts == 0)
+        return;
 
-        // Compute a mask that identifies the unique points. No sorting.
-        bool needmask = unique_mask(&eids[0], 0, npts, &mask[0]);
+    for(index_t ai = 0; ai < ncoord_dims; ai++)
+    {
+        float64 vmin = pts[ai], vmax = pts[ai];
+        for(index_t ci = 1; ci < npts; ci++)
+        {
+            vmin = std::min(vmin, pts[3 * ci + ai]);
+            vmax = std::max(vmax, pts[3 * ci + ai]);
+        }
+        outputs.bbox_min[ai][ei] = vmin;
+        outputs.bbox_max[ai][ei] = vmax;
+    }
+}
 
-        // Accumulate unique node values for centroid, using mask.
-        float64 centroid[3]={0.,0.,0.};
-        index_t npts_used = 0;
-        if(needmask)
+//-------------------------------------------------------------------------
+/**
+ @brief Computes the measure of a fixed-size (non-poly) element. 3D shapes
+        are split into cones from the centroid over their embedded faces.
+ */
+template <index_t NPTS>
+inline float64
+fixed_element_measure(const ShapeType &shape, const float64 (&pts)[3 * NPTS],
+                      const float64 *centroid)
+{
+    static const index_t polygon_order[4] = {0, 1, 2, 3};
+    float64 res = 0.;
+    if(NPTS == 1)
+    {
+        // points have no measure
+    }
+    else if(shape.dim == 1)
+    {
+        const float64 d[3] = {pts[3] - pts[0], pts[4] - pts[1], pts[5] - pts[2]};
+        res = std::sqrt(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]);
+    }
+    else if(shape.dim == 2)
+    {
+        res = polygon_area(pts, polygon_order, shape.indices, centroid);
+    }
+    else if(shape.dim == 3)
+    {
+        const index_t face_npts = bputils::TOPO_SHAPE_INDEX_COUNTS[shape.embed_id];
+        for(index_t fi = 0; fi < shape.embed_count; fi++)
         {
-            for(index_t ci = 0; ci < npts; ci++)
-            {
-                if(mask[ci])
-                {
-                    auto id = eids[ci];
-                    for(index_t ai = 0; ai < ncoord_dims; ai++)
-                        centroid[ai] += coords[ai][id];
-                    npts_used++;
-                }
-            }
+            res += face_cone_volume(pts, shape.embedding + fi * face_npts,
+                                    face_npts, centroid);
         }
-        else
+    }
+    return res;
+}
+
+//-------------------------------------------------------------------------
+// NOTE: These functions are templated to support passing raw pointers (as
+//       well as accessors) and for passing in a custom function to store
+//       the data. Elements are processed in parallel through
+//       conduit::execution, so store must be safe to call concurrently for
+//       different elements.
+template <index_t NPTS, typename IndexType, typename CoordType, typename StorageFunc>
+void
+unstructured_centroid_fixed(const ShapeType &topo_shape,
+                            const IndexType &topo_conn,
+                            const IndexType &topo_offsets,
+                            index_t topo_num_elems,
+                            const CoordType &coords,
+                            index_t ncoord_dims,
+                            const ElementMeasureOutputs &outputs,
+                            StorageFunc &&store)
+{
+#if defined(CONDUIT_USE_OPENMP)
+    using policy = conduit::execution::OpenMPExec;
+#else
+    using policy = conduit::execution::SerialExec;
+#endif
+    conduit::execution::for_all<policy>(0, topo_num_elems, [&](index_t ei)
+    {
+        index_t eids[NPTS];
+        int mask[NPTS];
+        float64 pts[3 * NPTS];
+
+        const index_t eoffset = topo_offsets[ei];
+        for(index_t ci = 0; ci < NPTS; ci++)
+            eids[ci] = topo_conn[eoffset + ci];
+        for(index_t ci = 0; ci < NPTS; ci++)
         {
-            // We don't need to use the mask - save some branches.
-            npts_used = npts;
+            for(index_t ai = 0; ai < 3; ai++)
+                pts[3 * ci + ai] = (ai < ncoord_dims) ? coords[ai][eids[ci]] : 0.;
+        }
+
+        // Average the unique points. No sorting.
+        const bool needmask = unique_mask(eids, 0, NPTS, mask);
+        float64 centroid[3];
+        element_centroid(pts, NPTS, needmask ? mask : nullptr, centroid);
+        store(ei, centroid);
+
+        if(outputs.measure != nullptr)
+            outputs.measure[ei] = fixed_element_measure<NPTS>(topo_shape, pts, centroid);
+        element_bbox(pts, NPTS, ei, ncoord_dims, outputs);
+    });
+}
+
+//-------------------------------------------------------------------------
+template <typename IndexType, typename CoordType, typename StorageFunc>
+void
+unstructured_centroid_polygonal(const IndexType &topo_conn,
+                                const IndexType &topo_offsets,
+                                const IndexType &topo_sizes,
+                                index_t topo_num_elems,
+                                const CoordType &coords,
+                                index_t ncoord_dims,
+                                const ElementMeasureOutputs &outputs,
+                                StorageFunc &&store)
+{
+#if defined(CONDUIT_USE_OPENMP)
+    using policy = conduit::execution::OpenMPExec;
+#else
+    using policy = conduit::execution::SerialExec;
+#endif
+    const index_t nblocks = (topo_num_elems + CENTROID_BLOCK_SIZE - 1) / CENTROID_BLOCK_SIZE;
+    conduit::execution::for_all<policy>(0, nblocks, [&](index_t bi)
+    {
+        constexpr size_t max_size_guess = 12;
+        std::vector<index_t> eids, order;
+        std::vector<int> mask;
+        std::vector<float64> pts;
+        eids.reserve(max_size_guess);
+        mask.reserve(max_size_guess);
+        pts.reserve(3 * max_size_guess);
+
+        const index_t start = bi * CENTROID_BLOCK_SIZE;
+        const index_t end = std::min(topo_num_elems, start + CENTROID_BLOCK_SIZE);
+        for(index_t ei = start; ei < end; ei++)
+        {
+            const index_t eoffset = topo_offsets[ei];
+            const index_t npts = topo_sizes[ei];
+
+            // Just in case for larger polygons
+            mask.resize(npts);
+            eids.resize(npts);
+            pts.resize(3 * npts);
             for(index_t ci = 0; ci < npts; ci++)
             {
-                auto id = eids[ci];
-                for(index_t ai = 0; ai < ncoord_dims; ai++)
-                    centroid[ai] += coords[ai][id];
+                eids[ci] = topo_conn[eoffset + ci];
+                for(index_t ai = 0; ai < 3; ai++)
+                    pts[3 * ci + ai] = (ai < ncoord_dims) ? coords[ai][eids[ci]] : 0.;
             }
+
+            const bool needmask = unique_mask(&eids[0], 0, npts, &mask[0]);
+            float64 centroid[3];
+            element_centroid(&pts[0], npts, needmask ? &mask[0] : nullptr, centroid);
+            store(ei, centroid);
+
+            if(outputs.measure != nullptr)
+            {
+                if(static_cast<index_t>(order.size()) < npts)
+                {
+                    order.resize(npts);
+                    for(index_t ci = 0; ci < npts; ci++)
+                        order[ci] = ci;
+                }
+                outputs.measure[ei] = polygon_area(&pts[0], &order[0], npts, centroid);
+            }
+            element_bbox(&pts[0], npts, ei, ncoord_dims, outputs);
         }
-        // Average the values.
-        float64 one_over_npts = 1. / static_cast<float64>(npts_used);
-        for(index_t ai = 0; ai < ncoord_dims; ai++)
-            centroid[ai] *= one_over_npts;
+    });
+}
 
-        // Store the centroid.
-        store(ei, centroid);
+//-------------------------------------------------------------------------
+template <typename IndexType, typename CoordType, typename StorageFunc>
+void
+unstructured_centroid(const ShapeType &topo_shape,
+                      const IndexType &topo_conn,
+                      const IndexType &topo_offsets,
+                      const IndexType &topo_sizes,
+                      index_t topo_num_elems,
+                      const CoordType &coords,
+                      index_t ncoord_dims,
+                      const ElementMeasureOutputs &outputs,
+                      StorageFunc &&store)
+{
+    // Dispatch to kernels specialized on the number of element points.
+    switch(topo_shape.is_polygonal() ? -1 : topo_shape.indices)
+    {
+    case 1:
+        unstructured_centroid_fixed<1>(topo_shape, topo_conn, topo_offsets,
+            topo_num_elems, coords, ncoord_dims, outputs, store);
+        break;
+    case 2:
+        unstructured_centroid_fixed<2>(topo_shape, topo_conn, topo_offsets,
+            topo_num_elems, coords, ncoord_dims, outputs, store);
+        break;
+    case 3:
+        unstructured_centroid_fixed<3>(topo_shape, topo_conn, topo_offsets,
+            topo_num_elems, coords, ncoord_dims, outputs, store);
+        break;
+    case 4:
+        unstructured_centroid_fixed<4>(topo_shape, topo_conn, topo_offsets,
+            topo_num_elems, coords, ncoord_dims, outputs, store);
+        break;
+    case 5:
+        unstructured_centroid_fixed<5>(topo_shape, topo_conn, topo_offsets,
+            topo_num_elems, coords, ncoord_dims, outputs, store);
+        break;
+    case 6:
+        unstructured_centroid_fixed<6>(topo_shape, topo_conn, topo_offsets,
+            topo_num_elems, coords, ncoord_dims, outputs, store);
+        break;
+    case 8:
+        unstructured_centroid_fixed<8>(topo_shape, topo_conn, topo_offsets,
+            topo_num_elems, coords, ncoord_dims, outputs, store);
+        break;
+    default:
+        unstructured_centroid_polygonal(topo_conn, topo_offsets, topo_sizes,
+            topo_num_elems, coords, ncoord_dims, outputs, store);
+        break;
     }
 }
 
 //-------------------------------------------------------------------------
-// NOTE: This function is templated to support passing raw pointers (as
-//       well as accessors) and for passing in a custom function to store
-//       the data.
 template <typename IndexType, typename CoordType, typename StorageFunc>
 void
 unstructured_centroid_polyhedral(const ShapeType &/*topo_shape*/,
@@ -1564,51 +2464,97 @@ unstructured_centroid_polyhedral(const ShapeType &/*topo_shape*/,
                                  index_t topo_num_elems,
                                  const CoordType &coords,
                                  index_t ncoord_dims,
+                                 const ElementMeasureOutputs &outputs,
                                  StorageFunc &&store)
 {
-    std::vector<index_t> elem_coord_indices;
-    elem_coord_indices.reserve(12);
-
-    for(index_t ei = 0; ei < topo_num_elems; ei++)
+#if defined(CONDUIT_USE_OPENMP)
+    using policy = conduit::execution::OpenMPExec;
+#else
+    using policy = conduit::execution::SerialExec;
+#endif
+    const index_t nblocks = (topo_num_elems + CENTROID_BLOCK_SIZE - 1) / CENTROID_BLOCK_SIZE;
+    conduit::execution::for_all<policy>(0, nblocks, [&](index_t bi)
     {
-        const index_t eoffset = topo_offsets[ei];
+        std::vector<index_t> elem_coord_indices, face;
+        std::vector<float64> pts;
+        elem_coord_indices.reserve(12);
+        face.reserve(12);
+        pts.reserve(36);
 
-        // Determine the unique points in the element.
-        elem_coord_indices.clear();
-        const index_t elem_num_faces = topo_sizes[ei];
-        for(index_t fi = 0, foffset = eoffset; fi < elem_num_faces; fi++)
+        const index_t start = bi * CENTROID_BLOCK_SIZE;
+        const index_t end = std::min(topo_num_elems, start + CENTROID_BLOCK_SIZE);
+        for(index_t ei = start; ei < end; ei++)
         {
-            index_t subelem_index = topo_conn[foffset];
-            index_t subelem_offset = topo_suboffsets[subelem_index];
-            index_t subelem_size = topo_subsizes[subelem_index];
+            const index_t eoffset = topo_offsets[ei];
 
-            const index_t face_num_coords = subelem_size;
-            for(index_t ci = 0; ci < face_num_coords; ci++)
+            // Determine the unique points in the element.
+            elem_coord_indices.clear();
+            const index_t elem_num_faces = topo_sizes[ei];
+            for(index_t fi = 0, foffset = eoffset; fi < elem_num_faces; fi++)
             {
-                index_t id = topo_subconn[subelem_offset + ci];
-                if(std::find(elem_coord_indices.cbegin(),
-                             elem_coord_indices.cend(), id)
-                   == elem_coord_indices.cend())
+                index_t subelem_index = topo_conn[foffset];
+                index_t subelem_offset = topo_suboffsets[subelem_index];
+                index_t subelem_size = topo_subsizes[subelem_index];
+
+                const index_t face_num_coords = subelem_size;
+                for(index_t ci = 0; ci < face_num_coords; ci++)
                 {
-                    elem_coord_indices.push_back(id);
+                    index_t id = topo_subconn[subelem_offset + ci];
+                    if(std::find(elem_coord_indices.cbegin(),
+                                 elem_coord_indices.cend(), id)
+                       == elem_coord_indices.cend())
+                    {
+                        elem_coord_indices.push_back(id);
+                    }
                 }
+                foffset++;
             }
-            foffset++;
-        }
 
-        // Compute the centroid.
-        float64 centroid[3] = {0., 0., 0.};
-        float64 one_over_npts = 1. / static_cast<float64>(elem_coord_indices.size());
-        for(index_t ai = 0; ai < ncoord_dims; ai++)
-        {
-            for(const auto ci : elem_coord_indices)
-                centroid[ai] += coords[ai][ci];
-            centroid[ai] *= one_over_npts;
-        }
+            const index_t npts = static_cast<index_t>(elem_coord_indices.size());
+            pts.resize(3 * npts);
+            for(index_t ci = 0; ci < npts; ci++)
+            {
+                for(index_t ai = 0; ai < 3; ai++)
+                {
+                    pts[3 * ci + ai] = (ai < ncoord_dims) ?
+                        coords[ai][elem_coord_indices[ci]] : 0.;
+                }
+            }
 
-        // Store the centroid.
-        store(ei, centroid);
-    }
+            // Compute the centroid.
+            float64 centroid[3];
+            element_centroid(&pts[0], npts, nullptr, centroid);
+
+            // Store the centroid.
+            store(ei, centroid);
+
+            if(outputs.measure != nullptr)
+            {
+                // Sum the cones from the centroid over each face, with face
+                // points expressed as indices into the element points.
+                float64 vol = 0.;
+                for(index_t fi = 0; fi < elem_num_faces; fi++)
+                {
+                    const index_t subelem_index = topo_conn[eoffset + fi];
+                    const index_t subelem_offset = topo_suboffsets[subelem_index];
+                    const index_t subelem_size = topo_subsizes[subelem_index];
+                    face.resize(subelem_size);
+                    for(index_t ci = 0; ci < subelem_size; ci++)
+                    {
+                        const index_t id = topo_subconn[subelem_offset + ci];
+                        face[ci] = static_cast<index_t>(
+                            std::find(elem_coord_indices.cbegin(),
+                                      elem_coord_indices.cend(), id) -
+                            elem_coord_indices.cbegin());
+                    }
+                    vol += face_cone_volume(&pts[0], &face[0], subelem_size,
+                                            centroid);
+                }
+                outputs.measure[ei] = vol;
+            }
+            element_bbox(&pts[0], npts, ei, ncoord_dims, outputs);
+        }
+    });
 }
 
 // NOTE(JRC): The following two functions need to be passed the coordinate set
@@ -1622,7 +2568,8 @@ void
 calculate_unstructured_centroids(const conduit::Node &topo,
                                  const conduit::Node &coordset,
                                  conduit::Node &dest,
-                                 conduit::Node &cdest)
+                                 conduit::Node &cdest,
+                                 const ElementMeasureOutputs &outputs = ElementMeasureOutputs())
 {
     CONDUIT_ANNOTATE_MARK_FUNCTION;
 
@@ -1773,7 +2720,7 @@ calculate_unstructured_centroids(const conduit::Node &topo,
                 topo_conn_access, topo_offsets_access, topo_sizes_access, 
                 topo_subconn_access, topo_suboffsets_access, topo_subsizes_access,
                 topo_num_elems,
-                axis_data_access, csys_axes_size,
+                axis_data_access, csys_axes_size, outputs,
                 [&](index_t ei, const float64 centroid[3])
             {
                 for(index_t ai = 0; ai < csys_axes_size; ai++)
@@ -1791,7 +2738,7 @@ calculate_unstructured_centroids(const conduit::Node &topo,
                 topo_conn_access, topo_offsets_access, topo_sizes_access,
                 topo_subconn_access, topo_suboffsets_access, topo_subsizes_access,
                 topo_num_elems,
-                axis_data_access, csys_axes_size,
+                axis_data_access, csys_axes_size, outputs,
                 [&](index_t ei, const float64 centroid[3])
             {
                 for(index_t ai = 0; ai < csys_axes_size; ai++)
@@ -1810,7 +2757,7 @@ calculate_unstructured_centroids(const conduit::Node &topo,
             
             unstructured_centroid(topo_shape,
                 topo_conn_access, topo_offsets_access, topo_sizes_access, topo_num_elems,
-                axis_data_access, csys_axes_size,
+                axis_data_access, csys_axes_size, outputs,
                 [&](index_t ei, const float64 centroid[3])
             {
                 for(index_t ai = 0; ai < csys_axes_size; ai++)
@@ -1826,7 +2773,7 @@ calculate_unstructured_centroids(const conduit::Node &topo,
 
             unstructured_centroid(topo_shape,
                 topo_conn_access, topo_offsets_access, topo_sizes_access, topo_num_elems,
-                axis_data_access, csys_axes_size,
+                axis_data_access, csys_axes_size, outputs,
                 [&](index_t ei, const float64 centroid[3])
             {
                 for(index_t ai = 0; ai < csys_axes_size; ai++)
@@ -1933,23 +2880,131 @@ mesh::verify(const std::string &protocol,
 
 //-----------------------------------------------------------------------------
 bool
-mesh::verify(const Node &mesh,
-             Node &info)
+mesh::verify(const Node &mesh,
+             Node &info)
+{
+    bool res = true;
+    info.reset();
+
+    // if n has the child "coordsets", we assume it is a single domain
+    // mesh
+    if(mesh.has_child("coordsets"))
+    {
+        res = verify_single_domain(mesh, info);
+    }
+    else
+    {
+       res = verify_multi_domain(mesh, info);
+    }
+    return res;
+}
+
+
+//-----------------------------------------------------------------------------
+bool
+mesh::verify(const Node &mesh)
+{
+    // a single scratch node is reused for every domain, so the info
+    // produced for valid domains never accumulates
+    Node scratch;
+
+    if(mesh.has_child("coordsets"))
+    {
+        return verify_single_domain_quick(mesh, scratch);
+    }
+
+    if(!mesh.dtype().is_object() && !mesh.dtype().is_list() &&
+       !mesh.dtype().is_empty())
+    {
+        return false;
+    }
+
+    const index_t num_doms = mesh.number_of_children();
+    for(index_t di = 0; di < num_doms; di++)
+    {
+        if(!verify_single_domain_quick(mesh.child(di), scratch))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+bool
+mesh::verify(const Node &mesh,
+             Node &info,
+             const Node &options)
+{
+    bool res = verify(mesh, info);
+
+    const bool deep = options.has_child("deep") &&
+                      options["deep"].to_int() != 0;
+    // the data checks are only safe on structurally valid meshes
+    if(!res || !deep)
+    {
+        return res;
+    }
+
+    const index_t max_bad = options.has_child("max_errors") ?
+        options["max_errors"].to_index_t() : 10;
+    const float64 tolerance = options.has_child("tolerance") ?
+        options["tolerance"].to_float64() : 1.e-6;
+
+    if(!is_multi_domain(mesh))
+    {
+        res = deep_verify_domain(mesh, max_bad, tolerance, info);
+    }
+    else
+    {
+        NodeConstIterator itr = mesh.children();
+        while(itr.has_next())
+        {
+            const Node &dom = itr.next();
+            res &= deep_verify_domain(dom, max_bad, tolerance,
+                                      info[itr.name()]);
+        }
+        log::validation(info, res);
+    }
+
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+void
+mesh::set_verify_cache_enabled(bool value)
+{
+    std::lock_guard<std::mutex> lock(verify_cache_mutex);
+    verify_cache_on = value;
+    if(!value)
+    {
+        verify_cache.clear();
+    }
+}
+
+//-----------------------------------------------------------------------------
+bool
+mesh::verify_cache_enabled()
 {
-    bool res = true;
-    info.reset();
+    std::lock_guard<std::mutex> lock(verify_cache_mutex);
+    return verify_cache_on;
+}
 
-    // if n has the child "coordsets", we assume it is a single domain
-    // mesh
-    if(mesh.has_child("coordsets"))
-    {
-        res = verify_single_domain(mesh, info);
-    }
-    else
-    {
-       res = verify_multi_domain(mesh, info);
-    }
-    return res;
+//-----------------------------------------------------------------------------
+void
+mesh::clear_verify_cache()
+{
+    std::lock_guard<std::mutex> lock(verify_cache_mutex);
+    verify_cache.clear();
+}
+
+//-----------------------------------------------------------------------------
+index_t
+mesh::verify_cache_size()
+{
+    std::lock_guard<std::mutex> lock(verify_cache_mutex);
+    return static_cast<index_t>(verify_cache.size());
 }
 
 
@@ -2806,7 +3861,8 @@ generate_derived_entities(conduit::Node &mesh,
     // loop over all domains and call generate_derived on each domain
     CONDUIT_ANNOTATE_MARK_BEGIN("Setup");
     const std::vector<DomMapsTuple> doms_and_maps = group_domains_and_maps(mesh, s2dmap, d2smap);
-    for(index_t di = 0; di < (index_t)doms_and_maps.size(); di++)
+    const index_t num_domains = static_cast<index_t>(doms_and_maps.size());
+    bputils::for_all_domains(num_domains, [&](index_t di)
     {
         conduit::Node &domain = *std::get<0>(doms_and_maps[di]);
         conduit::Node &domain_s2dmap = *std::get<1>(doms_and_maps[di]);
@@ -2823,29 +3879,27 @@ generate_derived_entities(conduit::Node &mesh,
         dst_adjset.reset();
         dst_adjset["association"].set("element");
         dst_adjset["topology"].set(dst_topo_name);
-    }
+    });
     CONDUIT_ANNOTATE_MARK_END("Setup");
 
+    // Find the candidate entities for each domain concurrently. The query is
+    // not thread safe so the candidates are added to it afterwards, in domain
+    // order.
     CONDUIT_ANNOTATE_MARK_BEGIN("dom_entity_neighbor_map.start");
-    Node src_data, dst_data;
-    std::vector<std::tuple<int,int,int,uint64>> query_guide;
-    std::map<int,std::map<index_t, std::set<index_t>>> dom_entity_neighbor_map;
-    for(index_t di = 0; di < (index_t)doms_and_maps.size(); di++)
+    // {(neighbor domain id, entity id in topology, entity points)}
+    typedef std::tuple<index_t, index_t, std::vector<index_t>> Candidate;
+    std::vector<std::vector<Candidate>> dom_candidates(num_domains);
+    std::vector<index_t> domain_ids(num_domains);
+    bputils::for_all_domains(num_domains, [&](index_t di)
     {
         conduit::Node &domain = *std::get<0>(doms_and_maps[di]);
-        const index_t domain_id = domain["state/domain_id"].to_index_t();
-
-        const Node *src_topo_ptr = bputils::find_reference_node(domain["adjsets"][src_adjset_name], "topology");
-        const Node &src_topo = *src_topo_ptr;
+        domain_ids[di] = domain["state/domain_id"].to_index_t();
 
         const Node &dst_topo = domain["topologies"][dst_topo_name];
         const index_t dst_topo_len = bputils::topology::length(dst_topo);
 
         const conduit::Node &src_adjset_groups = domain["adjsets"][src_adjset_name]["groups"];
 
-        // Tell the query which topology to use.
-        Q.selectTopology(src_topo.name());
-
         // Organize Adjset Points into Interfaces (Pair-Wise Groups) //
         //
         // for all neighbors:
@@ -2874,7 +3928,7 @@ generate_derived_entities(conduit::Node &mesh,
         conduit::Node &domain_d2smap = *std::get<2>(doms_and_maps[di]);
         index_t_accessor d2s_sizes = domain_d2smap["sizes"].value();
 
-        // {(entity id in topology): <(neighbor domain ids that contain this entity)>}
+        std::vector<Candidate> &candidates = dom_candidates[di];
         for(index_t ei = 0; ei < dst_topo_len; ei++)
         {
             // if we are dealing with anything but points
@@ -2902,16 +3956,35 @@ generate_derived_entities(conduit::Node &mesh,
 
                     if(entity_in_neighbor)
                     {
-                        // Add the entity to the query for consideration.
-                        uint64 qid = Q.add(domain_id, ni, entity_pidxs);
-
-                        // Add the candidate entity to the match query, which
-                        // will help resolve things across domains.
-                        query_guide.push_back(std::make_tuple(domain_id, ni, ei, qid));
+                        candidates.emplace_back(ni, ei, entity_pidxs);
                     }
                 }
             }
         }
+    });
+
+    // {(domain index, neighbor domain id, entity id in topology, query id)}
+    std::vector<std::tuple<index_t,int,index_t,uint64>> query_guide;
+    for(index_t di = 0; di < num_domains; di++)
+    {
+        conduit::Node &domain = *std::get<0>(doms_and_maps[di]);
+        const Node *src_topo_ptr = bputils::find_reference_node(domain["adjsets"][src_adjset_name], "topology");
+        const Node &src_topo = *src_topo_ptr;
+
+        // Tell the query which topology to use.
+        Q.selectTopology(src_topo.name());
+
+        for(const Candidate &c : dom_candidates[di])
+        {
+            const index_t ni = std::get<0>(c);
+            const index_t ei = std::get<1>(c);
+
+            // Add the candidate entity to the match query, which
+            // will help resolve things across domains.
+            uint64 qid = Q.add(domain_ids[di], ni, std::get<2>(c));
+            query_guide.push_back(std::make_tuple(di, ni, ei, qid));
+        }
+        dom_candidates[di].clear();
     }
     CONDUIT_ANNOTATE_MARK_END("dom_entity_neighbor_map.start");
 
@@ -2922,21 +3995,22 @@ generate_derived_entities(conduit::Node &mesh,
 
     // Use query results to finish building entity_neighbor_map.
     CONDUIT_ANNOTATE_MARK_BEGIN("dom_entity_neighbor_map.finish");
+    std::vector<std::map<index_t, std::set<index_t>>> dom_entity_neighbor_map(num_domains);
     for(const auto &obj : query_guide)
     {
-        int domain_id = std::get<0>(obj);
+        index_t di = std::get<0>(obj);
         int ni = std::get<1>(obj);
-        int ei = std::get<2>(obj);
+        index_t ei = std::get<2>(obj);
         uint64 eid = std::get<3>(obj);
-        if(Q.exists(domain_id, ni, eid))
+        if(Q.exists(domain_ids[di], ni, eid))
         {
-            auto &entity_neighbor_map = dom_entity_neighbor_map[domain_id];
+            auto &entity_neighbor_map = dom_entity_neighbor_map[di];
             entity_neighbor_map[ei].insert(ni);
         }
 #ifdef DEBUG_PRINT
         else
         {
-            std::cout << "!!!! NOT adding domain " << domain_id << " entity " << ei << " to entity_neighbor_map for neighbor " << ni << std::endl;
+            std::cout << "!!!! NOT adding domain " << domain_ids[di] << " entity " << ei << " to entity_neighbor_map for neighbor " << ni << std::endl;
         }
 #endif
     }
@@ -2944,10 +4018,10 @@ generate_derived_entities(conduit::Node &mesh,
 
     // Finish building the adjset.
     CONDUIT_ANNOTATE_MARK_BEGIN("build");
-    for(index_t di = 0; di < (index_t)doms_and_maps.size(); di++)
+    bputils::for_all_domains(num_domains, [&](index_t di)
     {
         conduit::Node &domain = *std::get<0>(doms_and_maps[di]);
-        const index_t domain_id = domain["state/domain_id"].to_index_t();
+        const index_t domain_id = domain_ids[di];
 
         const Node *src_topo_ptr = bputils::find_reference_node(domain["adjsets"][src_adjset_name], "topology");
         const Node &src_topo = *src_topo_ptr;
@@ -2961,8 +4035,9 @@ generate_derived_entities(conduit::Node &mesh,
 
         // Use Entity Interfaces to Construct Group Entity Lists //
 
+        Node src_data, dst_data;
         std::map<std::set<index_t>, std::vector<std::tuple<std::set<PointTuple>, index_t>>> group_entity_map;
-        const auto &entity_neighbor_map = dom_entity_neighbor_map[domain_id];
+        const auto &entity_neighbor_map = dom_entity_neighbor_map[di];
         for(const auto &entity_neighbor_pair : entity_neighbor_map)
         {
             const index_t &ei = entity_neighbor_pair.first;
@@ -3045,7 +4120,7 @@ generate_derived_entities(conduit::Node &mesh,
                 src_data.to_data_type(dst_data.dtype().id(), dst_data);
             }
         }
-    }
+    });
     CONDUIT_ANNOTATE_MARK_END("build");
 }
 
@@ -3096,7 +4171,8 @@ generate_decomposed_entities(conduit::Node &mesh,
     // the adjset identified by src_adjset_name.
     CONDUIT_ANNOTATE_MARK_BEGIN("Setup");
     const std::vector<DomMapsTuple> doms_and_maps = group_domains_and_maps(mesh, s2dmap, d2smap);
-    for(index_t di = 0; di < (index_t)doms_and_maps.size(); di++)
+    const index_t num_domains = static_cast<index_t>(doms_and_maps.size());
+    bputils::for_all_domains(num_domains, [&](index_t di)
     {
         Node &domain = *std::get<0>(doms_and_maps[di]);
         Node &domain_s2dmap = *std::get<1>(doms_and_maps[di]);
@@ -3116,24 +4192,23 @@ generate_decomposed_entities(conduit::Node &mesh,
         // NOTE(JRC): Diff- different association (decomposed entity -> assoc: vertex)
         dst_adjset["association"].set("vertex");
         dst_adjset["topology"].set(dst_topo_name);
-    }
+    });
     CONDUIT_ANNOTATE_MARK_END("Setup");
 
     // Iterate over each domain and build up dom_entity_neighbor_map as much as
     // we can. For some entities, we need to ask neighboring domains whether the
-    // entity-produced corner coordset point is valid there. For those, we add
-    // points to the input query and build up query_guide.
+    // entity-produced corner coordset point is valid there. Those points are
+    // collected per domain while the domains run concurrently. They are added
+    // to the input query afterwards, in domain order, to build up query_guide.
     CONDUIT_ANNOTATE_MARK_BEGIN("dom_entity_neighbor_map.start");
-    Node src_data, dst_data;
-    src_data.reset();
-    dst_data.reset();
-    index_t num_domains = static_cast<index_t>(doms_and_maps.size());
-    std::map<index_t, std::map<index_t, std::set<index_t>>> dom_entity_neighbor_map;
+    // {(entity centroid id, neighbor domain id, point)}
+    typedef std::tuple<index_t, index_t, std::array<double, 3>> QueryPoint;
+    std::vector<std::vector<QueryPoint>> dom_query_points(num_domains);
+    std::vector<std::map<index_t, std::set<index_t>>> dom_entity_neighbor_map(num_domains);
     std::vector<std::tuple<index_t, index_t, index_t, index_t>> query_guide;
-    for(index_t di = 0; di < num_domains; di++)
+    bputils::for_all_domains(num_domains, [&](index_t di)
     {
         Node &domain = *std::get<0>(doms_and_maps[di]);
-        const index_t domain_id = domain["state/domain_id"].to_index_t();
 
         const Node *src_topo_ptr = bputils::find_reference_node(domain["adjsets"][src_adjset_name], "topology");
         const Node &src_topo = *src_topo_ptr;
@@ -3177,7 +4252,8 @@ generate_decomposed_entities(conduit::Node &mesh,
         // Collect Viable Entities for All Interfaces //
 
         // {(entity centroid id): <(neighbor domain ids that contain this entity)>}
-        auto &entity_neighbor_map = dom_entity_neighbor_map[domain_id];
+        auto &entity_neighbor_map = dom_entity_neighbor_map[di];
+        auto &query_points = dom_query_points[di];
         // NOTE(JRC): Diff, entirely different iteration strategy for finding entities
         // to consider on individual adjset interfaces.
 
@@ -3226,15 +4302,13 @@ generate_decomposed_entities(conduit::Node &mesh,
                         {
                             // Get the point (it might not be 3D)
                             auto pt = bputils::coordset::_explicit::coords(dst_cset, entity_cidx);
-                            double pt3[3];
+                            std::array<double, 3> pt3;
                             pt3[0] = pt[0];
                             pt3[1] = (pt.size() > 1) ? pt[1] : 0.;
                             pt3[2] = (pt.size() > 2) ? pt[2] : 0.;
 
-                            // Add the point to the query and store some information
-                            // help finish up later.
-                            auto idx = query.add(ni, pt3);
-                            query_guide.emplace_back(domain_id, entity_cidx, ni, idx);
+                            // Save the point so it can be added to the query.
+                            query_points.emplace_back(entity_cidx, ni, pt3);
                         }
                         else
                         {
@@ -3246,6 +4320,20 @@ generate_decomposed_entities(conduit::Node &mesh,
                 }
             } // for ei
         } // for dentry
+    });
+
+    // Add the points to the query and store some information to help
+    // finish up later.
+    for(index_t di = 0; di < num_domains; di++)
+    {
+        for(const QueryPoint &qp : dom_query_points[di])
+        {
+            const index_t entity_cidx = std::get<0>(qp);
+            const index_t ni = std::get<1>(qp);
+            auto idx = query.add(ni, std::get<2>(qp).data());
+            query_guide.emplace_back(di, entity_cidx, ni, idx);
+        }
+        dom_query_points[di].clear();
     }
     CONDUIT_ANNOTATE_MARK_END("dom_entity_neighbor_map.start");
 
@@ -3258,12 +4346,12 @@ generate_decomposed_entities(conduit::Node &mesh,
     CONDUIT_ANNOTATE_MARK_BEGIN("dom_entity_neighbor_map.finish");
     for(const auto &obj : query_guide)
     {
-        index_t domain_id = std::get<0>(obj);
+        index_t di = std::get<0>(obj);
         index_t entity_cidx = std::get<1>(obj);
         index_t ni = std::get<2>(obj);
         index_t idx = std::get<3>(obj);
 
-        auto &entity_neighbor_map = dom_entity_neighbor_map[domain_id];
+        auto &entity_neighbor_map = dom_entity_neighbor_map[di];
         // Add the entity to entity_neighbor_map if its point existed on
         // the remote domain.
         const auto &results = query.results(ni);
@@ -3276,11 +4364,11 @@ generate_decomposed_entities(conduit::Node &mesh,
 
     // Finish building the corner mesh adjset.
     CONDUIT_ANNOTATE_MARK_BEGIN("build");
-    for(index_t di = 0; di < num_domains; di++)
+    bputils::for_all_domains(num_domains, [&](index_t di)
     {
         Node &domain = *std::get<0>(doms_and_maps[di]);
         const index_t domain_id = domain["state/domain_id"].to_index_t();
-        const auto &entity_neighbor_map = dom_entity_neighbor_map[domain_id];
+        const auto &entity_neighbor_map = dom_entity_neighbor_map[di];
 
         const Node &dst_cset = domain["coordsets"][dst_cset_name];
 
@@ -3298,6 +4386,7 @@ generate_decomposed_entities(conduit::Node &mesh,
         //
         // This assumption must be made to avoid a costly coordinate->id lookup.
 
+        Node src_data, dst_data;
         std::map<std::set<index_t>, std::vector<std::tuple<std::set<PointTuple>, index_t>>> group_entity_map;
         for(const auto &entity_neighbor_pair : entity_neighbor_map)
         {
@@ -3384,7 +4473,7 @@ generate_decomposed_entities(conduit::Node &mesh,
                 src_data.to_data_type(dst_data.dtype().id(), dst_data);
             }
         }
-    }
+    });
     CONDUIT_ANNOTATE_MARK_END("build");
 }
 
@@ -4744,6 +5833,71 @@ mesh::topology::unstructured::generate_centroids(const Node &topo,
     map_node.to_data_type(int_dtype.id(), d2smap);
 }
 
+//-----------------------------------------------------------------------------
+void
+mesh::topology::unstructured::generate_element_geometry(const Node &topo,
+                                                        Node &dest,
+                                                        const Node &options)
+{
+    CONDUIT_ANNOTATE_MARK_FUNCTION;
+
+    const bool want_centroids = !options.has_child("centroids") ||
+                                options["centroids"].to_int() != 0;
+    const bool want_measures = !options.has_child("measures") ||
+                               options["measures"].to_int() != 0;
+    const bool want_bboxes = !options.has_child("bounding_boxes") ||
+                             options["bounding_boxes"].to_int() != 0;
+
+    const Node *coordset = bputils::find_reference_node(topo, "coordset");
+    const std::vector<std::string> csys_axes = bputils::coordset::axes(*coordset);
+    const index_t n = bputils::topology::length(topo);
+
+    dest.reset();
+    ElementMeasureOutputs outputs;
+    if(want_measures)
+    {
+        dest["measures"].set(DataType::float64(n));
+        outputs.measure = dest["measures"].as_float64_ptr();
+    }
+    if(want_bboxes)
+    {
+        for(size_t ai = 0; ai < csys_axes.size(); ai++)
+        {
+            Node &bmin = dest["bounding_boxes/min"][csys_axes[ai]];
+            Node &bmax = dest["bounding_boxes/max"][csys_axes[ai]];
+            bmin.set(DataType::float64(n));
+            bmax.set(DataType::float64(n));
+            outputs.bbox_min[ai] = bmin.as_float64_ptr();
+            outputs.bbox_max[ai] = bmax.as_float64_ptr();
+        }
+    }
+
+    // the centroid kernels always produce centroids, so compute them into
+    // a scratch tree and keep them if they were requested
+    Node scratch;
+    calculate_unstructured_centroids(topo, *coordset,
+                                     scratch["topo"], scratch["coords"],
+                                     outputs);
+    if(want_centroids)
+    {
+        Node &centroids = dest["centroids"];
+        NodeIterator itr = scratch["coords/values"].children();
+        while(itr.has_next())
+        {
+            Node &vals = itr.next();
+            Node &dst = centroids[itr.name()];
+            if(vals.dtype().is_float64())
+            {
+                dst.swap(vals);
+            }
+            else
+            {
+                vals.to_float64_array(dst);
+            }
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 void
 mesh::topology::unstructured::generate_sides(const Node &topo,
@@ -6573,6 +7727,391 @@ mesh::field::generate_strip(Node& fields,
     }
 }
 
+//-----------------------------------------------------------------------------
+// field recentering helpers
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+enum RecenterOp
+{
+    RECENTER_AVERAGE,
+    RECENTER_SUM,
+    RECENTER_MIN,
+    RECENTER_MAX,
+    RECENTER_VOLUME_WEIGHTED
+};
+
+//-----------------------------------------------------------------------------
+// compressed map from each target entity to the source entities it gathers
+// from: the sources of target t are ids[offsets[t]] ... ids[offsets[t+1]-1]
+struct RecenterMap
+{
+    std::vector<index_t> offsets;
+    std::vector<index_t> ids;
+};
+
+//-----------------------------------------------------------------------------
+static void
+recenter_map_from_dim_map(const Node &dim_map, RecenterMap &map)
+{
+    const index_t_accessor values = dim_map["values"].as_index_t_accessor();
+    const index_t_accessor sizes = dim_map["sizes"].as_index_t_accessor();
+    const index_t_accessor offsets = dim_map["offsets"].as_index_t_accessor();
+    const index_t n = sizes.number_of_elements();
+
+    map.offsets.resize(n + 1);
+    map.offsets[0] = 0;
+    for(index_t i = 0; i < n; i++)
+    {
+        map.offsets[i + 1] = map.offsets[i] + sizes[i];
+    }
+    map.ids.resize(map.offsets[n]);
+
+#if defined(CONDUIT_USE_OPENMP)
+    using policy = conduit::execution::OpenMPExec;
+#else
+    using policy = conduit::execution::SerialExec;
+#endif
+    conduit::execution::for_all<policy>(0, n, [&](index_t i)
+    {
+        const index_t src_offset = offsets[i];
+        for(index_t j = map.offsets[i]; j < map.offsets[i + 1]; j++)
+        {
+            map.ids[j] = values[src_offset + (j - map.offsets[i])];
+        }
+    });
+}
+
+//-----------------------------------------------------------------------------
+static void
+recenter_identity_map(index_t n, RecenterMap &map)
+{
+    map.offsets.resize(n + 1);
+    map.ids.resize(n);
+    for(index_t i = 0; i < n; i++)
+    {
+        map.offsets[i] = i;
+        map.ids[i] = i;
+    }
+    map.offsets[n] = n;
+}
+
+//-----------------------------------------------------------------------------
+// gathers the source values of each target entity; weights are only used
+// by RECENTER_VOLUME_WEIGHTED
+static void
+recenter_gather(const RecenterMap &map,
+                const float64_accessor &src,
+                const std::vector<float64> &weights,
+                RecenterOp op,
+                float64 *dst)
+{
+#if defined(CONDUIT_USE_OPENMP)
+    using policy = conduit::execution::OpenMPExec;
+#else
+    using policy = conduit::execution::SerialExec;
+#endif
+    const index_t n = static_cast<index_t>(map.offsets.size()) - 1;
+    conduit::execution::for_all<policy>(0, n, [&](index_t t)
+    {
+        const index_t begin = map.offsets[t];
+        const index_t end = map.offsets[t + 1];
+        // targets without sources get 0
+        float64 res = 0.;
+        if(begin < end)
+        {
+            switch(op)
+            {
+            case RECENTER_MIN:
+            case RECENTER_MAX:
+                res = src[map.ids[begin]];
+                for(index_t i = begin + 1; i < end; i++)
+                {
+                    const float64 v = src[map.ids[i]];
+                    res = (op == RECENTER_MIN) ? std::min(res, v) : std::max(res, v);
+                }
+                break;
+            case RECENTER_VOLUME_WEIGHTED:
+            {
+                float64 wsum = 0.;
+                for(index_t i = begin; i < end; i++)
+                {
+                    const index_t si = map.ids[i];
+                    res += weights[si] * src[si];
+                    wsum += weights[si];
+                }
+                res = (wsum != 0.) ? res / wsum : 0.;
+                break;
+            }
+            default:
+                for(index_t i = begin; i < end; i++)
+                {
+                    res += src[map.ids[i]];
+                }
+                if(op == RECENTER_AVERAGE)
+                {
+                    res /= static_cast<float64>(end - begin);
+                }
+                break;
+            }
+        }
+        dst[t] = res;
+    });
+}
+
+//-----------------------------------------------------------------------------
+void
+mesh::field::recenter(const Node &mesh,
+                      const Node &fields,
+                      const std::string &target,
+                      const std::string &op,
+                      Node &dest)
+{
+    CONDUIT_ANNOTATE_MARK_FUNCTION;
+
+    RecenterOp rop = RECENTER_AVERAGE;
+    if(op == "sum")
+    {
+        rop = RECENTER_SUM;
+    }
+    else if(op == "min")
+    {
+        rop = RECENTER_MIN;
+    }
+    else if(op == "max")
+    {
+        rop = RECENTER_MAX;
+    }
+    else if(op == "volume_weighted")
+    {
+        rop = RECENTER_VOLUME_WEIGHTED;
+    }
+    else if(op != "average")
+    {
+        CONDUIT_ERROR("blueprint::mesh::field::recenter unknown op '" << op <<
+                      "'. Expected 'average', 'sum', 'min', 'max', or"
+                      " 'volume_weighted'.");
+    }
+
+    // a single field, or a tree of fields that share a topology
+    const bool single = fields.has_child("values");
+    std::vector<std::string> field_names;
+    std::vector<const Node *> field_nodes;
+    if(single)
+    {
+        field_names.push_back(fields.name());
+        field_nodes.push_back(&fields);
+    }
+    else
+    {
+        NodeConstIterator itr = fields.children();
+        while(itr.has_next())
+        {
+            const Node &field = itr.next();
+            field_names.push_back(itr.name());
+            field_nodes.push_back(&field);
+        }
+    }
+    dest.reset();
+    if(field_nodes.empty())
+    {
+        return;
+    }
+
+    const std::string topo_name = (*field_nodes[0])["topology"].as_string();
+    for(const Node *field : field_nodes)
+    {
+        if((*field)["topology"].as_string() != topo_name)
+        {
+            CONDUIT_ERROR("blueprint::mesh::field::recenter fields must all"
+                          " be on the same topology.");
+        }
+        const std::string assoc = field->has_child("association") ?
+            (*field)["association"].as_string() : std::string();
+        if(assoc != "vertex" && assoc != "element")
+        {
+            CONDUIT_ERROR("blueprint::mesh::field::recenter only supports"
+                          " fields with a vertex or element association.");
+        }
+    }
+
+    // TopologyMetadata and the measure kernels need an unstructured
+    // topology in a mesh tree
+    const Node &topo = mesh["topologies"][topo_name];
+    const std::string cset_name = topo["coordset"].as_string();
+    const std::string topo_type = topo["type"].as_string();
+    Node scratch;
+    Node &uns_topo = scratch["topologies"][topo_name];
+    Node &uns_cset = scratch["coordsets"][cset_name];
+    if(topo_type == "uniform")
+    {
+        topology::uniform::to_unstructured(topo, uns_topo, uns_cset);
+    }
+    else if(topo_type == "rectilinear")
+    {
+        topology::rectilinear::to_unstructured(topo, uns_topo, uns_cset);
+    }
+    else if(topo_type == "structured")
+    {
+        topology::structured::to_unstructured(topo, uns_topo, uns_cset);
+    }
+    else
+    {
+        uns_topo.set_external(topo);
+        uns_cset.set_external(mesh["coordsets"][cset_name]);
+    }
+
+    const ShapeType topo_shape(uns_topo);
+    const index_t topo_dim = topo_shape.dim;
+
+    // target dimension and the topology/association of the results
+    index_t target_dim = -1;
+    std::string dest_topo = topo_name, dest_assoc = "element";
+    if(target == "vertex")
+    {
+        target_dim = 0;
+        dest_assoc = "vertex";
+    }
+    else if(target == "element")
+    {
+        target_dim = topo_dim;
+    }
+    else if(mesh["topologies"].has_child(target))
+    {
+        // a topology derived from the field topology by the generate_points,
+        // generate_lines or generate_faces functions
+        const Node &target_topo = mesh["topologies"][target];
+        if(target_topo["coordset"].as_string() != cset_name)
+        {
+            CONDUIT_ERROR("blueprint::mesh::field::recenter target topology '"
+                          << target << "' must use coordset '" << cset_name << "'.");
+        }
+        target_dim = ShapeType(target_topo).dim;
+        dest_topo = target;
+    }
+    else
+    {
+        CONDUIT_ERROR("blueprint::mesh::field::recenter target '" << target <<
+                      "' is not 'vertex', 'element', or a topology name.");
+    }
+
+    // only request the maps the fields need
+    bool need_src[2] = {false, false};
+    for(const Node *field : field_nodes)
+    {
+        need_src[(*field)["association"].as_string() == "vertex" ? 0 : 1] = true;
+    }
+    const bool vertex_weights = rop == RECENTER_VOLUME_WEIGHTED && need_src[0];
+    std::vector<std::pair<size_t, size_t>> desired;
+    const index_t src_dims[2] = {0, topo_dim};
+    for(int si = 0; si < 2; si++)
+    {
+        if(need_src[si] && src_dims[si] != target_dim)
+        {
+            desired.push_back(std::make_pair(static_cast<size_t>(target_dim),
+                                             static_cast<size_t>(src_dims[si])));
+        }
+    }
+    if(vertex_weights)
+    {
+        desired.push_back(std::make_pair(static_cast<size_t>(topo_dim),
+                                         static_cast<size_t>(0)));
+    }
+    const index_t lowest_dim = need_src[0] ? 0 : target_dim;
+    TopologyMetadata topo_data(uns_topo, uns_cset,
+                               static_cast<size_t>(lowest_dim), desired);
+
+    const index_t num_targets = topo_data.get_length(target_dim);
+    if(dest_topo != topo_name &&
+       bputils::topology::length(mesh["topologies"][dest_topo]) != num_targets)
+    {
+        CONDUIT_ERROR("blueprint::mesh::field::recenter target topology '"
+                      << target << "' does not match the entities derived"
+                      " from topology '" << topo_name << "'.");
+    }
+
+    RecenterMap maps[2];
+    for(int si = 0; si < 2; si++)
+    {
+        if(!need_src[si])
+        {
+            continue;
+        }
+        if(src_dims[si] == target_dim)
+        {
+            recenter_identity_map(num_targets, maps[si]);
+        }
+        else
+        {
+            Node dim_map;
+            topo_data.get_dim_map(TopologyMetadata::GLOBAL, target_dim,
+                                  src_dims[si], dim_map);
+            recenter_map_from_dim_map(dim_map, maps[si]);
+        }
+    }
+
+    // volume weights: element measures, and for vertices the share of the
+    // measures of the elements that use them
+    std::vector<float64> weights[2];
+    if(rop == RECENTER_VOLUME_WEIGHTED)
+    {
+        Node geom, geom_opts;
+        geom_opts["centroids"] = 0;
+        geom_opts["bounding_boxes"] = 0;
+        topology::unstructured::generate_element_geometry(uns_topo, geom, geom_opts);
+        const float64 *measures = geom["measures"].as_float64_ptr();
+        const index_t nelems = geom["measures"].dtype().number_of_elements();
+        weights[1].assign(measures, measures + nelems);
+
+        if(vertex_weights)
+        {
+            Node dim_map;
+            topo_data.get_dim_map(TopologyMetadata::GLOBAL, topo_dim, 0, dim_map);
+            RecenterMap elem_verts;
+            recenter_map_from_dim_map(dim_map, elem_verts);
+            weights[0].assign(topo_data.get_length(0), 0.);
+            for(index_t ei = 0; ei < nelems; ei++)
+            {
+                const index_t begin = elem_verts.offsets[ei];
+                const index_t end = elem_verts.offsets[ei + 1];
+                for(index_t i = begin; i < end; i++)
+                {
+                    weights[0][elem_verts.ids[i]] += measures[ei] / (end - begin);
+                }
+            }
+        }
+    }
+
+    for(size_t fi = 0; fi < field_nodes.size(); fi++)
+    {
+        const Node &field = *field_nodes[fi];
+        const int si = (field["association"].as_string() == "vertex") ? 0 : 1;
+        Node &res = single ? dest : dest[field_names[fi]];
+        res["association"] = dest_assoc;
+        res["topology"] = dest_topo;
+
+        const Node &values = field["values"];
+        if(values.dtype().is_object())
+        {
+            NodeConstIterator itr = values.children();
+            while(itr.has_next())
+            {
+                const Node &comp = itr.next();
+                Node &res_comp = res["values"][itr.name()];
+                res_comp.set(DataType::float64(num_targets));
+                recenter_gather(maps[si], comp.as_float64_accessor(), weights[si],
+                                rop, res_comp.as_float64_ptr());
+            }
+        }
+        else
+        {
+            res["values"].set(DataType::float64(num_targets));
+            recenter_gather(maps[si], values.as_float64_accessor(), weights[si],
+                            rop, res["values"].as_float64_ptr());
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 // blueprint::mesh::field::basis protocol interface
 //-----------------------------------------------------------------------------
@@ -60,6 +60,46 @@ bool CONDUIT_BLUEPRINT_API verify(const std::string &protocol,
 bool CONDUIT_BLUEPRINT_API verify(const conduit::Node &mesh,
                                   conduit::Node &info);
 
+//-----------------------------------------------------------------------------
+/// Mesh verify with options.
+///
+/// options:
+///   deep: (int, default 0) when non-zero and the mesh passes the
+///         structural verify, also check its data: unstructured
+///         connectivity against the coordset length, polyhedral face
+///         references, monotonic offsets, sizes/offsets agreement, and
+///         that matset volume fractions sum to 1 for every element.
+///   max_errors: (index_t, default 10) number of offending indices
+///         reported (as "invalid_indices") for each failed check.
+///   tolerance: (float64, default 1e-6) allowed deviation of volume
+///         fraction sums from 1.
+//-----------------------------------------------------------------------------
+bool CONDUIT_BLUEPRINT_API verify(const conduit::Node &mesh,
+                                  conduit::Node &info,
+                                  const conduit::Node &options);
+
+//-----------------------------------------------------------------------------
+/// Boolean-only mesh verify. Produces the same result as
+/// verify(mesh, info) but does not build the info tree: domains are checked
+/// one at a time with messages disabled and the check stops at the first
+/// invalid domain.
+///
+/// When the verify cache is enabled, each domain that passes is recorded
+/// by a fingerprint of its tree structure (names, dtypes, lengths, string
+/// values, and the values of short numeric leaves such as dims) and later
+/// domains with a recorded fingerprint are accepted without re-checking.
+//-----------------------------------------------------------------------------
+bool CONDUIT_BLUEPRINT_API verify(const conduit::Node &mesh);
+
+//-----------------------------------------------------------------------------
+/// Opt-in verify fingerprint cache controls (the cache is off by default).
+/// Disabling the cache also clears it.
+//-----------------------------------------------------------------------------
+void CONDUIT_BLUEPRINT_API set_verify_cache_enabled(bool value);
+bool CONDUIT_BLUEPRINT_API verify_cache_enabled();
+void CONDUIT_BLUEPRINT_API clear_verify_cache();
+index_t CONDUIT_BLUEPRINT_API verify_cache_size();
+
 
 //-----------------------------------------------------------------------------
 /// blueprint mesh property and transform methods
@@ -618,6 +658,19 @@ namespace topology
                                                       conduit::Node &s2dmap,
                                                       conduit::Node &d2smap);
 
+        //---------------------------------------------------------------------
+        // computes per-element geometry in a single pass over the topology,
+        // for example to use as partition weights. results are float64
+        // arrays (one value per element) stored in dest:
+        //   centroids/{x,y,z}: element centroids (unique point averages)
+        //   measures: element length, area, or volume (by element dimension)
+        //   bounding_boxes/{min,max}/{x,y,z}: per element extents
+        // the options node can set "centroids", "measures", and
+        // "bounding_boxes" to 0 or 1 to select the outputs (all default to 1)
+        void CONDUIT_BLUEPRINT_API generate_element_geometry(const conduit::Node &topo,
+                                                             conduit::Node &dest,
+                                                             const conduit::Node &options);
+
         //---------------------------------------------------------------------
         void CONDUIT_BLUEPRINT_API generate_sides(const conduit::Node &topo,
                                                   conduit::Node &topo_dest,
@@ -753,6 +806,28 @@ namespace matset
                                        conduit::Node &dest,
                                        const float64 epsilon = CONDUIT_EPSILON);
 
+    //-------------------------------------------------------------------------
+    // Matset layout conversions.
+    //
+    // to_uni_buffer / to_multi_buffer change the buffer layout and keep
+    // element or material dominance; to_element_dominant /
+    // to_material_dominant change the dominance and keep the buffer layout.
+    // Material dominant results list each material's elements in element
+    // id order, and element dominant multi-buffer results are dense
+    // (zero filled). When the input is already in the target layout, dest
+    // is set external to it and no data are copied.
+    void CONDUIT_BLUEPRINT_API to_uni_buffer(const conduit::Node &matset,
+                                             conduit::Node &dest);
+
+    void CONDUIT_BLUEPRINT_API to_multi_buffer(const conduit::Node &matset,
+                                               conduit::Node &dest);
+
+    void CONDUIT_BLUEPRINT_API to_element_dominant(const conduit::Node &matset,
+                                                   conduit::Node &dest);
+
+    void CONDUIT_BLUEPRINT_API to_material_dominant(const conduit::Node &matset,
+                                                    conduit::Node &dest);
+
     //-------------------------------------------------------------------------
     // blueprint::mesh::matset::index protocol interface
     //-------------------------------------------------------------------------
@@ -782,6 +857,28 @@ namespace field
                                               const std::string& topo_dest,
                                               std::map<std::string, std::string>& matset_names);
 
+    //-------------------------------------------------------------------------
+    // Moves vertex or element field values to another association using the
+    // TopologyMetadata maps between the field topology and its entities.
+    //
+    // fields is a single field or a tree of fields (like mesh["fields"])
+    // that share a topology in mesh (a single domain). target is "vertex",
+    // "element", or the name of a topology in mesh created from the field
+    // topology by generate_points, generate_lines, or generate_faces (for
+    // example, to move element values to faces). Each target entity
+    // combines the values of the source entities it touches using op:
+    // "average", "sum", "min", "max", or "volume_weighted" (weighted by
+    // element measures; vertices use their share of the measures of the
+    // elements that use them). Entities without sources get 0.
+    //
+    // Results are float64 fields with the same names in dest (or dest is
+    // the field when a single field is passed).
+    void CONDUIT_BLUEPRINT_API recenter(const conduit::Node &mesh,
+                                        const conduit::Node &fields,
+                                        const std::string &target,
+                                        const std::string &op,
+                                        conduit::Node &dest);
+
     //-------------------------------------------------------------------------
     // Given a blueprint field and matset, converts the matset and the field
     // values + matset_values to the silo style sparse mixed slot
@@ -795,6 +892,27 @@ namespace field
                                        conduit::Node &dest,
                                        const float64 epsilon = CONDUIT_EPSILON);
 
+    //-------------------------------------------------------------------------
+    // Converts a matset field's matset_values to the layout the matching
+    // blueprint::mesh::matset conversion produces for matset. Other field
+    // entries are set external to the input field. When matset is already
+    // in the target layout, dest is set external to field.
+    void CONDUIT_BLUEPRINT_API to_uni_buffer(const conduit::Node &field,
+                                             const conduit::Node &matset,
+                                             conduit::Node &dest);
+
+    void CONDUIT_BLUEPRINT_API to_multi_buffer(const conduit::Node &field,
+                                               const conduit::Node &matset,
+                                               conduit::Node &dest);
+
+    void CONDUIT_BLUEPRINT_API to_element_dominant(const conduit::Node &field,
+                                                   const conduit::Node &matset,
+                                                   conduit::Node &dest);
+
+    void CONDUIT_BLUEPRINT_API to_material_dominant(const conduit::Node &field,
+                                                    const conduit::Node &matset,
+                                                    conduit::Node &dest);
+
     //-------------------------------------------------------------------------
     // blueprint::mesh::field::index protocol interface
     //-------------------------------------------------------------------------
@@ -23,6 +23,7 @@
 #include "conduit_blueprint_mesh_utils.hpp"
 #include "conduit_blueprint_o2mrelation.hpp"
 #include "conduit_blueprint_o2mrelation_iterator.hpp"
+#include "conduit_execution.hpp"
 
 using namespace conduit;
 // access conduit blueprint mesh utilities
@@ -503,6 +504,595 @@ to_silo(const conduit::Node &field,
     }
 }
 
+//-----------------------------------------------------------------------------
+// Matset layout conversions.
+//
+// Every input layout is first gathered into an element-dominant sparse
+// representation (a compressed row per element, ordered by element id),
+// from which each output layout is written. Input entries are gathered in
+// parallel and grouped by element with a counting sort, so no per-element
+// Nodes or maps are created.
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+struct SparseMatset
+{
+    // material names and ids, in material_map order
+    std::vector<std::string> mat_names;
+    std::vector<index_t>     mat_ids;
+    // slot of each material id in mat_names
+    std::map<index_t, index_t> mat_slots;
+
+    index_t num_elems;
+    // entries of element ei are [elem_offsets[ei], elem_offsets[ei+1])
+    std::vector<index_t> elem_offsets;
+    // per entry material slot, volume fraction and (optional) matset value
+    std::vector<index_t> slots;
+    std::vector<float64> vfs;
+    std::vector<float64> values;
+};
+
+//-----------------------------------------------------------------------------
+template <typename T>
+void
+set_from_vector(const std::vector<T> &src, const DataType &dtype, Node &dest)
+{
+    Node src_node;
+    src_node.set_external(const_cast<T*>(src.data()), src.size());
+    if(src_node.dtype().id() == dtype.id())
+    {
+        dest.set(src_node);
+    }
+    else
+    {
+        src_node.to_data_type(dtype.id(), dest);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Returns the number of o2m items in an (optional) o2mrelation and fills
+// the offset and count of each; data indices are start + j, or
+// indices[start + j] when the relation has "indices".
+index_t
+o2m_items(const Node &o2m,
+          index_t num_data,
+          std::vector<index_t> &starts,
+          std::vector<index_t> &counts)
+{
+    const bool has_sizes = o2m.has_child("sizes");
+    const bool has_offsets = o2m.has_child("offsets");
+    const index_t num_many = o2m.has_child("indices") ?
+        o2m["indices"].dtype().number_of_elements() : num_data;
+
+    index_t nitems = num_many;
+    if(has_sizes)
+    {
+        nitems = o2m["sizes"].dtype().number_of_elements();
+    }
+    else if(has_offsets)
+    {
+        nitems = o2m["offsets"].dtype().number_of_elements();
+    }
+
+    starts.resize(nitems);
+    counts.resize(nitems);
+    if(!has_sizes && !has_offsets)
+    {
+        for(index_t i = 0; i < nitems; i++)
+        {
+            starts[i] = i;
+            counts[i] = 1;
+        }
+    }
+    else if(has_sizes)
+    {
+        const index_t_accessor sizes = o2m["sizes"].as_index_t_accessor();
+        index_t_accessor offsets;
+        if(has_offsets)
+        {
+            offsets = o2m["offsets"].as_index_t_accessor();
+        }
+        index_t start = 0;
+        for(index_t i = 0; i < nitems; i++)
+        {
+            counts[i] = sizes[i];
+            starts[i] = has_offsets ? offsets[i] : start;
+            start += counts[i];
+        }
+    }
+    else
+    {
+        const index_t_accessor offsets = o2m["offsets"].as_index_t_accessor();
+        for(index_t i = 0; i < nitems; i++)
+        {
+            starts[i] = offsets[i];
+            counts[i] = ((i + 1 < nitems) ? offsets[i + 1] : num_many) - offsets[i];
+        }
+    }
+    return nitems;
+}
+
+//-----------------------------------------------------------------------------
+// Groups the given (element, slot, vf, value) entries by element with a
+// counting sort. Entries of each element keep their input order.
+void
+sparse_from_entries(const std::vector<index_t> &elems,
+                    std::vector<index_t> &slots,
+                    std::vector<float64> &vfs,
+                    std::vector<float64> &values,
+                    SparseMatset &res)
+{
+#if defined(CONDUIT_USE_OPENMP)
+    using policy = conduit::execution::OpenMPExec;
+#else
+    using policy = conduit::execution::SerialExec;
+#endif
+    const index_t nentries = static_cast<index_t>(elems.size());
+    const bool has_values = !values.empty();
+
+    res.elem_offsets.assign(res.num_elems + 1, 0);
+    for(index_t i = 0; i < nentries; i++)
+    {
+        res.elem_offsets[elems[i] + 1]++;
+    }
+    for(index_t ei = 0; ei < res.num_elems; ei++)
+    {
+        res.elem_offsets[ei + 1] += res.elem_offsets[ei];
+    }
+
+    // destination of each entry
+    std::vector<index_t> dest(nentries);
+    {
+        std::vector<index_t> next(res.elem_offsets.begin(),
+                                  res.elem_offsets.end() - 1);
+        for(index_t i = 0; i < nentries; i++)
+        {
+            dest[i] = next[elems[i]]++;
+        }
+    }
+
+    res.slots.resize(nentries);
+    res.vfs.resize(nentries);
+    res.values.resize(has_values ? nentries : 0);
+    conduit::execution::for_all<policy>(0, nentries, [&](index_t i)
+    {
+        res.slots[dest[i]] = slots[i];
+        res.vfs[dest[i]] = vfs[i];
+        if(has_values)
+        {
+            res.values[dest[i]] = values[i];
+        }
+    });
+}
+
+//-----------------------------------------------------------------------------
+// Gathers any matset layout (and optionally a field's matset_values) into
+// the element-dominant sparse representation.
+void
+to_sparse(const Node &matset,
+          const Node *matset_values,
+          SparseMatset &res)
+{
+#if defined(CONDUIT_USE_OPENMP)
+    using policy = conduit::execution::OpenMPExec;
+#else
+    using policy = conduit::execution::SerialExec;
+#endif
+    const bool is_uni = blueprint::mesh::matset::is_uni_buffer(matset);
+    const bool is_matdom = blueprint::mesh::matset::is_material_dominant(matset);
+    const Node &vfs_node = matset["volume_fractions"];
+
+    // material names and ids
+    res.mat_names.clear();
+    res.mat_ids.clear();
+    res.mat_slots.clear();
+    if(matset.has_child("material_map"))
+    {
+        NodeConstIterator itr = matset["material_map"].children();
+        while(itr.has_next())
+        {
+            const Node &id_node = itr.next();
+            res.mat_names.push_back(itr.name());
+            res.mat_ids.push_back(id_node.to_index_t());
+        }
+    }
+    else
+    {
+        NodeConstIterator itr = vfs_node.children();
+        while(itr.has_next())
+        {
+            itr.next();
+            res.mat_names.push_back(itr.name());
+            res.mat_ids.push_back(itr.index());
+        }
+    }
+    for(index_t si = 0; si < static_cast<index_t>(res.mat_ids.size()); si++)
+    {
+        res.mat_slots[res.mat_ids[si]] = si;
+    }
+
+    std::vector<index_t> elems, slots;
+    std::vector<float64> vfs, values;
+    std::vector<index_t> starts, counts;
+
+    if(is_uni)
+    {
+        const float64_accessor vf_vals = vfs_node.as_float64_accessor();
+        const index_t_accessor mids = matset["material_ids"].as_index_t_accessor();
+        const bool has_indices = matset.has_child("indices");
+        index_t_accessor indices;
+        if(has_indices)
+        {
+            indices = matset["indices"].as_index_t_accessor();
+        }
+        float64_accessor mv_vals;
+        if(matset_values != nullptr)
+        {
+            mv_vals = matset_values->as_float64_accessor();
+        }
+        index_t_accessor eids;
+        if(is_matdom)
+        {
+            eids = matset["element_ids"].as_index_t_accessor();
+        }
+
+        const index_t nitems = o2m_items(matset, vf_vals.number_of_elements(),
+                                         starts, counts);
+        // entry position of each item
+        std::vector<index_t> item_offsets(nitems + 1, 0);
+        for(index_t i = 0; i < nitems; i++)
+        {
+            item_offsets[i + 1] = item_offsets[i] + counts[i];
+        }
+        const index_t nentries = item_offsets[nitems];
+
+        elems.resize(nentries);
+        slots.resize(nentries);
+        vfs.resize(nentries);
+        values.resize(matset_values != nullptr ? nentries : 0);
+
+        // unknown material ids get slot -1 and are reported below
+        conduit::execution::for_all<policy>(0, nitems, [&](index_t i)
+        {
+            const index_t elem = is_matdom ? eids[i] : i;
+            for(index_t j = 0; j < counts[i]; j++)
+            {
+                const index_t e = item_offsets[i] + j;
+                const index_t di = has_indices ? indices[starts[i] + j]
+                                               : starts[i] + j;
+                const auto slot = res.mat_slots.find(mids[di]);
+                elems[e] = elem;
+                slots[e] = (slot != res.mat_slots.end()) ? slot->second : -1;
+                vfs[e] = vf_vals[di];
+                if(matset_values != nullptr)
+                {
+                    values[e] = mv_vals[di];
+                }
+            }
+        });
+        if(std::find(slots.begin(), slots.end(), -1) != slots.end())
+        {
+            CONDUIT_ERROR("matset 'material_ids' references a material that"
+                          " is not in 'material_map'");
+        }
+
+        if(!is_matdom)
+        {
+            // entries are already grouped by element
+            res.num_elems = nitems;
+            res.elem_offsets.swap(item_offsets);
+            res.slots.swap(slots);
+            res.vfs.swap(vfs);
+            res.values.swap(values);
+            return;
+        }
+    }
+    else
+    {
+        const index_t nmats = static_cast<index_t>(res.mat_names.size());
+        // non-zero entries of dense element-dominant buffers
+        const bool dense = !is_matdom;
+        for(index_t si = 0; si < nmats; si++)
+        {
+            const std::string &mat_name = res.mat_names[si];
+            const Node &mat_node = vfs_node[mat_name];
+
+            // per material buffers may be o2mrelations
+            const Node *mat_data = &mat_node;
+            Node o2m;
+            if(mat_node.dtype().is_object())
+            {
+                const std::string data_path =
+                    blueprint::o2mrelation::data_paths(mat_node).front();
+                mat_data = &mat_node[data_path];
+                o2m.set_external(mat_node);
+            }
+            const float64_accessor vf_vals = mat_data->as_float64_accessor();
+            const index_t nitems = o2m_items(o2m, vf_vals.number_of_elements(),
+                                             starts, counts);
+            const bool has_indices = o2m.has_child("indices");
+            index_t_accessor indices;
+            if(has_indices)
+            {
+                indices = o2m["indices"].as_index_t_accessor();
+            }
+            float64_accessor mv_vals;
+            if(matset_values != nullptr)
+            {
+                mv_vals = (*matset_values)[mat_name].as_float64_accessor();
+            }
+            index_t_accessor eids;
+            if(is_matdom)
+            {
+                eids = matset["element_ids"][mat_name].as_index_t_accessor();
+            }
+
+            for(index_t i = 0; i < nitems; i++)
+            {
+                const index_t di = has_indices ? indices[starts[i]] : starts[i];
+                const float64 vf = vf_vals[di];
+                if(dense && vf == 0.)
+                {
+                    continue;
+                }
+                elems.push_back(is_matdom ? eids[i] : i);
+                slots.push_back(si);
+                vfs.push_back(vf);
+                if(matset_values != nullptr)
+                {
+                    values.push_back(mv_vals[di]);
+                }
+            }
+            if(dense)
+            {
+                res.num_elems = std::max(res.num_elems, nitems);
+            }
+        }
+    }
+
+    if(is_matdom)
+    {
+        index_t max_elem = -1;
+        for(const index_t ei : elems)
+        {
+            max_elem = std::max(max_elem, ei);
+        }
+        res.num_elems = max_elem + 1;
+    }
+    sparse_from_entries(elems, slots, vfs, values, res);
+}
+
+//-----------------------------------------------------------------------------
+// Writes the sparse representation in the requested layout. When
+// values_dest is given, matset_values are written to it in the same layout.
+void
+from_sparse(const SparseMatset &sparse,
+            const Node &src_matset,
+            bool uni_buffer,
+            bool element_dominant,
+            Node &dest,
+            Node *values_dest,
+            const DataType &values_dtype = DataType::empty())
+{
+#if defined(CONDUIT_USE_OPENMP)
+    using policy = conduit::execution::OpenMPExec;
+#else
+    using policy = conduit::execution::SerialExec;
+#endif
+    const DataType int_dtype = bputils::find_widest_dtype(src_matset, bputils::DEFAULT_INT_DTYPES);
+    const DataType float_dtype = bputils::find_widest_dtype(src_matset, bputils::DEFAULT_FLOAT_DTYPE);
+    const index_t nentries = static_cast<index_t>(sparse.vfs.size());
+    const index_t nmats = static_cast<index_t>(sparse.mat_names.size());
+    const bool has_values = values_dest != nullptr;
+
+    dest.reset();
+    dest["topology"].set(src_matset["topology"]);
+    for(index_t si = 0; si < nmats; si++)
+    {
+        Node &id_node = dest["material_map"][sparse.mat_names[si]];
+        if(src_matset.has_child("material_map"))
+        {
+            id_node.set(src_matset["material_map"][sparse.mat_names[si]]);
+        }
+        else
+        {
+            id_node.set(static_cast<int32>(sparse.mat_ids[si]));
+        }
+    }
+
+    // material dominant layouts order entries by material, then element
+    std::vector<index_t> mat_offsets, order;
+    if(!element_dominant)
+    {
+        mat_offsets.assign(nmats + 1, 0);
+        for(index_t i = 0; i < nentries; i++)
+        {
+            mat_offsets[sparse.slots[i] + 1]++;
+        }
+        for(index_t si = 0; si < nmats; si++)
+        {
+            mat_offsets[si + 1] += mat_offsets[si];
+        }
+        order.resize(nentries);
+        std::vector<index_t> next(mat_offsets.begin(), mat_offsets.end() - 1);
+        for(index_t i = 0; i < nentries; i++)
+        {
+            order[next[sparse.slots[i]]++] = i;
+        }
+    }
+
+    // element id of each sparse entry
+    std::vector<index_t> entry_elems(nentries);
+    conduit::execution::for_all<policy>(0, sparse.num_elems, [&](index_t ei)
+    {
+        for(index_t i = sparse.elem_offsets[ei]; i < sparse.elem_offsets[ei + 1]; i++)
+        {
+            entry_elems[i] = ei;
+        }
+    });
+
+    if(uni_buffer)
+    {
+        std::vector<index_t> mids(nentries), eids;
+        std::vector<float64> vfs(nentries), values(has_values ? nentries : 0);
+        if(!element_dominant)
+        {
+            eids.resize(nentries);
+        }
+        conduit::execution::for_all<policy>(0, nentries, [&](index_t i)
+        {
+            const index_t src = element_dominant ? i : order[i];
+            mids[i] = sparse.mat_ids[sparse.slots[src]];
+            vfs[i] = sparse.vfs[src];
+            if(has_values)
+            {
+                values[i] = sparse.values[src];
+            }
+            if(!element_dominant)
+            {
+                eids[i] = entry_elems[src];
+            }
+        });
+
+        set_from_vector(vfs, float_dtype, dest["volume_fractions"]);
+        set_from_vector(mids, int_dtype, dest["material_ids"]);
+        if(element_dominant)
+        {
+            std::vector<index_t> sizes(sparse.num_elems);
+            for(index_t ei = 0; ei < sparse.num_elems; ei++)
+            {
+                sizes[ei] = sparse.elem_offsets[ei + 1] - sparse.elem_offsets[ei];
+            }
+            const std::vector<index_t> offsets(sparse.elem_offsets.begin(),
+                                               sparse.elem_offsets.end() - 1);
+            set_from_vector(sizes, int_dtype, dest["sizes"]);
+            set_from_vector(offsets, int_dtype, dest["offsets"]);
+        }
+        else
+        {
+            set_from_vector(eids, int_dtype, dest["element_ids"]);
+        }
+        if(has_values)
+        {
+            set_from_vector(values, values_dtype, *values_dest);
+        }
+    }
+    else
+    {
+        for(index_t si = 0; si < nmats; si++)
+        {
+            const std::string &mat_name = sparse.mat_names[si];
+            std::vector<float64> vfs, values;
+            std::vector<index_t> eids;
+            if(element_dominant)
+            {
+                // dense per material arrays
+                vfs.assign(sparse.num_elems, 0.);
+                values.assign(has_values ? sparse.num_elems : 0, 0.);
+                conduit::execution::for_all<policy>(0, sparse.num_elems, [&](index_t ei)
+                {
+                    for(index_t i = sparse.elem_offsets[ei]; i < sparse.elem_offsets[ei + 1]; i++)
+                    {
+                        if(sparse.slots[i] == si)
+                        {
+                            vfs[ei] = sparse.vfs[i];
+                            if(has_values)
+                            {
+                                values[ei] = sparse.values[i];
+                            }
+                        }
+                    }
+                });
+            }
+            else
+            {
+                const index_t mstart = mat_offsets[si];
+                const index_t mcount = mat_offsets[si + 1] - mstart;
+                vfs.resize(mcount);
+                eids.resize(mcount);
+                values.resize(has_values ? mcount : 0);
+                conduit::execution::for_all<policy>(0, mcount, [&](index_t i)
+                {
+                    const index_t src = order[mstart + i];
+                    vfs[i] = sparse.vfs[src];
+                    eids[i] = entry_elems[src];
+                    if(has_values)
+                    {
+                        values[i] = sparse.values[src];
+                    }
+                });
+                set_from_vector(eids, int_dtype, dest["element_ids"][mat_name]);
+            }
+            set_from_vector(vfs, float_dtype, dest["volume_fractions"][mat_name]);
+            if(has_values)
+            {
+                set_from_vector(values, values_dtype, (*values_dest)[mat_name]);
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Shared implementation of the matset and field layout conversions. field
+// may be null, in which case only the matset is converted.
+void
+convert_layout(const Node *field,
+               const Node &matset,
+               int uni_buffer,
+               int element_dominant,
+               Node &dest)
+{
+    // -1 keeps the input property
+    const bool src_uni = blueprint::mesh::matset::is_uni_buffer(matset);
+    const bool src_elemdom = blueprint::mesh::matset::is_element_dominant(matset);
+    const bool dst_uni = (uni_buffer < 0) ? src_uni : (uni_buffer != 0);
+    const bool dst_elemdom = (element_dominant < 0) ? src_elemdom : (element_dominant != 0);
+    const bool has_values = field != nullptr && field->has_child("matset_values");
+
+    // zero-copy when the data are already in the target layout
+    if(src_uni == dst_uni && src_elemdom == dst_elemdom)
+    {
+        dest.set_external(field != nullptr ? *field : matset);
+        return;
+    }
+
+    SparseMatset sparse;
+    sparse.num_elems = 0;
+    to_sparse(matset, has_values ? &(*field)["matset_values"] : nullptr, sparse);
+
+    if(field == nullptr)
+    {
+        from_sparse(sparse, matset, dst_uni, dst_elemdom, dest, nullptr);
+    }
+    else
+    {
+        Node mset_dest, values_dest;
+        // matset_values keep their own type
+        const DataType values_dtype = has_values ?
+            bputils::find_widest_dtype((*field)["matset_values"],
+                                       bputils::DEFAULT_NUMBER_DTYPES) :
+            DataType::empty();
+        from_sparse(sparse, matset, dst_uni, dst_elemdom, mset_dest,
+                    has_values ? &values_dest : nullptr, values_dtype);
+
+        // keep every field entry but the matset_values external
+        dest.reset();
+        NodeConstIterator itr = field->children();
+        while(itr.has_next())
+        {
+            const Node &child = itr.next();
+            if(itr.name() != "matset_values")
+            {
+                dest[itr.name()].set_external(child);
+            }
+        }
+        if(has_values)
+        {
+            dest["matset_values"].swap(values_dest);
+        }
+    }
+}
+
 }
 //-----------------------------------------------------------------------------
 // -- end conduit::blueprint::mesh::matset::detail --
@@ -533,6 +1123,39 @@ to_silo(const conduit::Node &matset,
 }
 
 
+//-----------------------------------------------------------------------------
+void
+to_uni_buffer(const conduit::Node &matset,
+              conduit::Node &dest)
+{
+    detail::convert_layout(nullptr, matset, 1, -1, dest);
+}
+
+//-----------------------------------------------------------------------------
+void
+to_multi_buffer(const conduit::Node &matset,
+                conduit::Node &dest)
+{
+    detail::convert_layout(nullptr, matset, 0, -1, dest);
+}
+
+//-----------------------------------------------------------------------------
+void
+to_element_dominant(const conduit::Node &matset,
+                    conduit::Node &dest)
+{
+    detail::convert_layout(nullptr, matset, -1, 1, dest);
+}
+
+//-----------------------------------------------------------------------------
+void
+to_material_dominant(const conduit::Node &matset,
+                     conduit::Node &dest)
+{
+    detail::convert_layout(nullptr, matset, -1, 0, dest);
+}
+
+
 //-----------------------------------------------------------------------------
 
 }
@@ -575,6 +1198,46 @@ to_silo(const conduit::Node &field,
                                                       epsilon);
 }
 
+//-----------------------------------------------------------------------------
+void
+to_uni_buffer(const conduit::Node &field,
+              const conduit::Node &matset,
+              conduit::Node &dest)
+{
+    conduit::blueprint::mesh::matset::detail::convert_layout(&field, matset,
+                                                             1, -1, dest);
+}
+
+//-----------------------------------------------------------------------------
+void
+to_multi_buffer(const conduit::Node &field,
+                const conduit::Node &matset,
+                conduit::Node &dest)
+{
+    conduit::blueprint::mesh::matset::detail::convert_layout(&field, matset,
+                                                             0, -1, dest);
+}
+
+//-----------------------------------------------------------------------------
+void
+to_element_dominant(const conduit::Node &field,
+                    const conduit::Node &matset,
+                    conduit::Node &dest)
+{
+    conduit::blueprint::mesh::matset::detail::convert_layout(&field, matset,
+                                                             -1, 1, dest);
+}
+
+//-----------------------------------------------------------------------------
+void
+to_material_dominant(const conduit::Node &field,
+                     const conduit::Node &matset,
+                     conduit::Node &dest)
+{
+    conduit::blueprint::mesh::matset::detail::convert_layout(&field, matset,
+                                                             -1, 0, dest);
+}
+
 //-----------------------------------------------------------------------------
 
 }
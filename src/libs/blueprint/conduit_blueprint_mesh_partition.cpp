@@ -19,6 +19,7 @@
 #include <algorithm>
 #include <array>
 #include <deque>
+#include <functional>
 #include <cmath>
 #include <cstring>
 #include <limits>
@@ -43,6 +44,7 @@
 #include "conduit_blueprint_mesh.hpp"
 #include "conduit_blueprint_o2mrelation_iterator.hpp"
 #include "conduit_log.hpp"
+#include "conduit_execution.hpp"
 
 #include "conduit_fmt/conduit_fmt.h"
 
@@ -2674,7 +2676,10 @@ Partitioner::copy_fields(index_t domain, const std::string &topology,
         const conduit::Node &n_fields = n_mesh["fields"];
         if(!vertex_ids.empty())
         {
+            // Slice all of the fields with this association together.
             conduit::Node &n_output_fields = n_output["fields"];
+            std::vector<const conduit::Node *> src_values;
+            std::vector<conduit::Node *> dest_values;
             for(index_t i = 0; i < n_fields.number_of_children(); i++)
             {
                 const conduit::Node &n_field = n_fields[i];
@@ -2684,10 +2689,12 @@ Partitioner::copy_fields(index_t domain, const std::string &topology,
                     auto assoc_topo = n_field["topology"].as_string();
                     if(association == "vertex" && topology == assoc_topo)
                     {
-                        copy_field(n_field, vertex_ids, n_output_fields);
+                        prepare_field_copy(n_field, n_output_fields,
+                                           src_values, dest_values);
                     }
                 }
             }
+            conduit::blueprint::mesh::utils::slice_fields(src_values, vertex_ids, dest_values);
 
             if(mapping)
             {
@@ -2705,7 +2712,10 @@ Partitioner::copy_fields(index_t domain, const std::string &topology,
 
         if(!element_ids.empty())
         {
+            // Slice all of the fields with this association together.
             conduit::Node &n_output_fields = n_output["fields"];
+            std::vector<const conduit::Node *> src_values;
+            std::vector<conduit::Node *> dest_values;
             for(index_t i = 0; i < n_fields.number_of_children(); i++)
             {
                 const conduit::Node &n_field = n_fields[i];
@@ -2715,10 +2725,12 @@ Partitioner::copy_fields(index_t domain, const std::string &topology,
                     auto assoc_topo = n_field["topology"].as_string();
                     if(association == "element" && topology == assoc_topo)
                     {
-                        copy_field(n_field, element_ids, n_output_fields);
+                        prepare_field_copy(n_field, n_output_fields,
+                                           src_values, dest_values);
                     }
                 }
             }
+            conduit::blueprint::mesh::utils::slice_fields(src_values, element_ids, dest_values);
 
             if(mapping)
             {
@@ -2740,6 +2752,19 @@ Partitioner::copy_fields(index_t domain, const std::string &topology,
 void
 Partitioner::copy_field(const conduit::Node &n_field,
     const std::vector<index_t> &ids, Node &n_output_fields) const
+{
+    std::vector<const conduit::Node *> src_values;
+    std::vector<conduit::Node *> dest_values;
+    prepare_field_copy(n_field, n_output_fields, src_values, dest_values);
+    conduit::blueprint::mesh::utils::slice_fields(src_values, ids, dest_values);
+}
+
+//---------------------------------------------------------------------------
+void
+Partitioner::prepare_field_copy(const conduit::Node &n_field,
+    Node &n_output_fields,
+    std::vector<const conduit::Node *> &src_values,
+    std::vector<conduit::Node *> &dest_values) const
 {
     static const std::vector<std::string> keys{"association", "grid_function",
         "volume_dependent", "topology"};
@@ -2765,72 +2790,111 @@ Partitioner::copy_field(const conduit::Node &n_field,
             n_new_field[key] = n_field[key];
     }
 
-    const conduit::Node &n_values = n_field["values"];
-    conduit::Node &new_values = n_new_field["values"];
-    if(n_values.dtype().is_compact()) 
-    {
-        if(n_values.number_of_children() > 0)
-        {
+    // The slice reads strided and interleaved (mcarray) values directly so
+    // the values do not need to be compacted first.
+    src_values.push_back(&n_field["values"]);
+    dest_values.push_back(&n_new_field["values"]);
+}
 
-// The vel data must be interleaved. We need to use the DataArray element methods for access.
+//---------------------------------------------------------------------------
+/**
+ @brief Turns a list of ids that may contain duplicates into a sorted list of
+        unique ids. When the id range is not much larger than the list, the
+        ids are marked in a dense mask that is compacted in parallel.
+        Otherwise, the ids are sorted and made unique.
 
+ @param ids The input ids. The list may be reordered.
+ @param[out] unique_ids The sorted, unique ids.
+ */
+static void
+sorted_unique_ids(std::vector<index_t> &ids, std::vector<index_t> &unique_ids)
+{
+#if defined(CONDUIT_USE_OPENMP)
+    using policy = conduit::execution::OpenMPExec;
+#else
+    using policy = conduit::execution::SerialExec;
+#endif
+    unique_ids.clear();
+    if(ids.empty())
+        return;
 
-            // mcarray.
-            for(index_t i = 0; i < n_values.number_of_children(); i++)
-            {
-                const conduit::Node &n_vals = n_values[i];
-                conduit::blueprint::mesh::utils::slice_array(n_vals, ids, new_values[n_vals.name()]);
-            }
-        }
-        else
-            conduit::blueprint::mesh::utils::slice_array(n_values, ids, new_values);
+    const index_t n = static_cast<index_t>(ids.size());
+    const index_t max_id = *std::max_element(ids.begin(), ids.end());
+    const index_t range = max_id + 1;
+    if(range > 4 * n + 1024)
+    {
+        // Sparse ids. A mask would be mostly empty.
+        conduit::execution::sort<policy>(ids.begin(), ids.end());
+        ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+        unique_ids = std::move(ids);
+        return;
     }
-    else
+
+    std::vector<unsigned char> mask(range, 0);
+    for(index_t i = 0; i < n; i++)
+        mask[ids[i]] = 1;
+
+    // Compact the mask: count per chunk, scan, then write per chunk.
+    const index_t chunk_size = 1 << 16;
+    const index_t nchunks = (range + chunk_size - 1) / chunk_size;
+    std::vector<index_t> chunk_offsets(nchunks + 1, 0);
+    conduit::execution::for_all<policy>(0, nchunks, [&](index_t c)
     {
-        // otherwise, we need to compact our data first
-        conduit::Node n;
-        n_values.compact_to(n);
-        if(n.number_of_children() > 0)
+        const index_t cend = std::min((c + 1) * chunk_size, range);
+        index_t count = 0;
+        for(index_t i = c * chunk_size; i < cend; i++)
+            count += mask[i];
+        chunk_offsets[c + 1] = count;
+    });
+    for(index_t c = 0; c < nchunks; c++)
+        chunk_offsets[c + 1] += chunk_offsets[c];
+
+    unique_ids.resize(chunk_offsets[nchunks]);
+    index_t *unique_ptr = unique_ids.data();
+    conduit::execution::for_all<policy>(0, nchunks, [&](index_t c)
+    {
+        const index_t cend = std::min((c + 1) * chunk_size, range);
+        index_t out = chunk_offsets[c];
+        for(index_t i = c * chunk_size; i < cend; i++)
         {
-            // mcarray.
-            for(index_t i = 0; i < n.number_of_children(); i++)
-            {
-                const conduit::Node &n_vals = n[i];
-                conduit::blueprint::mesh::utils::slice_array(n_vals, ids, new_values[n_vals.name()]);
-            }
+            if(mask[i])
+                unique_ptr[out++] = i;
         }
-        else
-            conduit::blueprint::mesh::utils::slice_array(n, ids, new_values);
-    }
+    });
 }
 
 //---------------------------------------------------------------------------
 /**
  @brief Iterates over the cells in the topo that are specified in element_ids
-        and adds their vertex ids into vertex_ids so we can build up a set of
-        vertices that will need to be pulled from the coordset.
+        and gathers their vertex ids so we can build up the sorted list of
+        unique vertices that will need to be pulled from the coordset.
  */
 void
 Partitioner::get_vertex_ids_for_element_ids(const conduit::Node &n_topo,
     const std::vector<index_t> &element_ids,
-    std::set<index_t> &vertex_ids) const
+    std::vector<index_t> &vertex_ids) const
 {
+#if defined(CONDUIT_USE_OPENMP)
+    using policy = conduit::execution::OpenMPExec;
+#else
+    using policy = conduit::execution::SerialExec;
+#endif
     bool is_base_rectilinear = n_topo["type"].as_string() == "rectilinear";
     bool is_base_structured = n_topo["type"].as_string() == "structured";
     bool is_base_uniform = n_topo["type"].as_string() == "uniform";
 
+    // All of the (possibly repeated) vertex ids used by the elements.
+    std::vector<index_t> elem_vertex_ids;
+
     if(is_base_rectilinear || is_base_structured || is_base_uniform)
     {
         index_t edims[3] = {1,1,1}, dims[3] = {0,0,0};
         auto ndims = topology::dims(n_topo);
         conduit::blueprint::mesh::utils::topology::logical_dims(n_topo, edims, 3);
-//cout << "get_vertex_ids_for_element_ids: edims=" << edims[0] << ", " << edims[1] << ", " << edims[2] << endl;
         dims[0] = edims[0] + 1;
         dims[1] = edims[1] + (ndims > 1 ? 1 : 0);
         dims[2] = edims[2] + (ndims > 2 ? 1 : 0);
-//cout << "get_vertex_ids_for_element_ids: dims=" << dims[0] << ", " << dims[1] << ", " << dims[2] << endl;
 
-        index_t cell_ijk[3]={0,0,0}, pt_ijk[3] = {0,0,0}, ptid = 0;
         static const index_t offsets[8][3] = {
             {0,0,0},
             {1,0,0},
@@ -2842,12 +2906,14 @@ Partitioner::get_vertex_ids_for_element_ids(const conduit::Node &n_topo,
             {1,1,1}
         };
         int np = (ndims == 2) ? 4 : 8;
-        auto n = element_ids.size();
-        for(size_t j = 0; j < n; j++)
+        auto n = static_cast<index_t>(element_ids.size());
+        elem_vertex_ids.resize(n * np);
+        index_t *ev_ptr = elem_vertex_ids.data();
+        conduit::execution::for_all<policy>(0, n, [&](index_t j)
         {
             // Get the IJK coordinate of the element.
+            index_t cell_ijk[3]={0,0,0}, pt_ijk[3] = {0,0,0}, ptid = 0;
             grid_id_to_ijk(element_ids[j], edims, cell_ijk);
-//cout << element_ids[i] << "-> " << cell_ijk[0] << "," << cell_ijk[1] << "," << cell_ijk[2] << endl;
             // Turn the IJK into vertex ids.
             for(int i = 0; i < np; i++)
             {
@@ -2855,12 +2921,9 @@ Partitioner::get_vertex_ids_for_element_ids(const conduit::Node &n_topo,
                 pt_ijk[1] = cell_ijk[1] + offsets[i][1];
                 pt_ijk[2] = cell_ijk[2] + offsets[i][2];
                 grid_ijk_to_id(pt_ijk, dims, ptid);
-
-//cout << "\t" << pt_ijk[0] << "," << pt_ijk[1] << "," << pt_ijk[2] << "-> " << ptid << endl;
-
-                vertex_ids.insert(ptid);
+                ev_ptr[j * np + i] = ptid;
             }
-        }
+        });
     }
     else
     {
@@ -2895,7 +2958,7 @@ Partitioner::get_vertex_ids_for_element_ids(const conduit::Node &n_topo,
                 auto offset = offsets[element_ids[i]];
                 auto sz = sizes[element_ids[i]];
                 for(unsigned int ptid = 0; ptid < sz; ptid++)
-                    vertex_ids.insert(iptr[offset + ptid]);
+                    elem_vertex_ids.push_back(iptr[offset + ptid]);
             }
         }
         else if(shape.is_polyhedral())
@@ -2931,7 +2994,7 @@ Partitioner::get_vertex_ids_for_element_ids(const conduit::Node &n_topo,
                     auto face_nfaces = static_cast<index_t>(se_sizes[face_id]);
                     for(index_t vi = 0; vi < face_nfaces; vi++)
                     {
-                        vertex_ids.insert(se_conn[face_offset + vi]);
+                        elem_vertex_ids.push_back(se_conn[face_offset + vi]);
                     }
                 }
             }
@@ -2987,7 +3050,7 @@ Partitioner::get_vertex_ids_for_element_ids(const conduit::Node &n_topo,
             {
                 auto npts = sizes[element_ids[i]];
                 for(index_t j = 0; j < npts; j++)
-                    vertex_ids.insert(stream[offsets[element_ids[i]] + j]);
+                    elem_vertex_ids.push_back(stream[offsets[element_ids[i]] + j]);
             }
         }
         else
@@ -2997,23 +3060,19 @@ Partitioner::get_vertex_ids_for_element_ids(const conduit::Node &n_topo,
             as_index_t(n_topo["elements/connectivity"], n_indices);
             auto iptr = as_index_t_array(n_indices);
             auto nverts_in_shape = conduit::blueprint::mesh::utils::TOPO_SHAPE_INDEX_COUNTS[shape.id];
-            for(size_t i = 0; i < element_ids.size(); i++)
+            auto n = static_cast<index_t>(element_ids.size());
+            elem_vertex_ids.resize(n * nverts_in_shape);
+            index_t *ev_ptr = elem_vertex_ids.data();
+            conduit::execution::for_all<policy>(0, n, [&](index_t i)
             {
                 auto offset = element_ids[i] * nverts_in_shape;
                 for(index_t j = 0; j < nverts_in_shape; j++)
-                    vertex_ids.insert(iptr[offset + j]);
-            }
+                    ev_ptr[i * nverts_in_shape + j] = iptr[offset + j];
+            });
         }
     }
-}
 
-//---------------------------------------------------------------------------
-inline void
-index_t_set_to_vector(const std::set<index_t> &src, std::vector<index_t> &dest)
-{
-    dest.reserve(src.size());
-    for(auto it = src.begin(); it != src.end(); it++)
-        dest.push_back(*it);
+    sorted_unique_ids(elem_vertex_ids, vertex_ids);
 }
 
 //---------------------------------------------------------------------------
@@ -3083,10 +3142,8 @@ Partitioner::extract(size_t idx, const conduit::Node &n_mesh, std::vector<index_
         }
         else
         {
-            // Get the unique set of vertex ids used by the elements.
-            std::set<index_t> vertex_ids_set;
-            get_vertex_ids_for_element_ids(n_topo, element_ids, vertex_ids_set);
-            index_t_set_to_vector(vertex_ids_set, vertex_ids);
+            // Get the sorted, unique vertex ids used by the elements.
+            get_vertex_ids_for_element_ids(n_topo, element_ids, vertex_ids);
 
             // Create a new coordset consisting of the selected vertex ids.
             create_new_explicit_coordset(n_coordset, vertex_ids, n_new_coordsets[csname]);
@@ -3329,11 +3386,24 @@ Partitioner::unstructured_topo_from_unstructured(const conduit::Node &n_topo,
     n_new_topo["type"].set("unstructured");
     n_new_topo["coordset"].set(csname);
 
-    // vertex_ids contains the list of old vertex ids that our selection uses
-    // from the old coordset. It can serve as a new to old map.
-    std::map<index_t,index_t> old2new;
-    for(size_t i = 0; i < vertex_ids.size(); i++)
-        old2new[vertex_ids[i]] = static_cast<index_t>(i);
+    // vertex_ids contains the sorted list of old vertex ids that our selection
+    // uses from the old coordset. It can serve as a new to old map. Invert it
+    // into a dense old to new map.
+    const index_t old2new_size = vertex_ids.empty() ? 0 : (vertex_ids.back() + 1);
+    std::vector<index_t> old2new(old2new_size, -1);
+    {
+#if defined(CONDUIT_USE_OPENMP)
+        using policy = conduit::execution::OpenMPExec;
+#else
+        using policy = conduit::execution::SerialExec;
+#endif
+        index_t *old2new_ptr = old2new.data();
+        const index_t *vertex_ids_ptr = vertex_ids.data();
+        conduit::execution::for_all<policy>(0, vertex_ids.size(), [&](index_t i)
+        {
+            old2new_ptr[vertex_ids_ptr[i]] = i;
+        });
+    }
 
     conduit::blueprint::mesh::utils::ShapeType shape(n_topo);
     std::vector<index_t> new_conn;
@@ -3399,7 +3469,9 @@ Partitioner::unstructured_topo_from_unstructured(const conduit::Node &n_topo,
         auto se_offsets = as_index_t_array(n_se_offsets);
         auto se_sizes = as_index_t_array(n_se_sizes);
 
-        std::map<index_t,index_t> old2new_faces;
+        // Dense map from old face ids to new face ids (-1 if not seen yet).
+        std::vector<index_t> old2new_faces(se_sizes.number_of_elements(), -1);
+        index_t num_new_faces = 0;
         std::vector<index_t> new_sizes, new_offsets, new_se_conn, new_se_sizes, new_se_offsets;
 
         index_t new_offset = 0, new_se_offset = 0;
@@ -3410,11 +3482,10 @@ Partitioner::unstructured_topo_from_unstructured(const conduit::Node &n_topo,
             for(index_t fi = 0; fi < nfaces; fi++)
             {
                 auto face_id = iptr[offset + fi];
-                auto it = old2new_faces.find(face_id);
-                if(it == old2new_faces.end())
+                if(old2new_faces[face_id] < 0)
                 {
                     // We have not seen the face before. Add it.
-                    auto new_face_id = static_cast<index_t>(old2new_faces.size());
+                    auto new_face_id = num_new_faces++;
                     old2new_faces[face_id] = new_face_id;
                     new_conn.push_back(new_face_id);
 
@@ -3423,11 +3494,11 @@ Partitioner::unstructured_topo_from_unstructured(const conduit::Node &n_topo,
                     for(index_t vi = 0; vi < face_nverts; vi++)
                     {
                         auto vid = se_conn[face_offset + vi];
+                        index_t nvid = (static_cast<index_t>(vid) < old2new_size) ? old2new[vid] : -1;
 #if 1
-                        if(old2new.find(vid) == old2new.end())
+                        if(nvid < 0)
                             cout << " ERROR - no vertex " << vid << " in old2new." << endl;
 #endif
-                        auto nvid = old2new[vid];
                         new_se_conn.push_back(nvid);
                     }
 
@@ -3438,7 +3509,7 @@ Partitioner::unstructured_topo_from_unstructured(const conduit::Node &n_topo,
                 else
                 {
                     // We've seen the face before. Reference it.
-                    new_conn.push_back(it->second);
+                    new_conn.push_back(old2new_faces[face_id]);
                 }
             }
 
@@ -3599,27 +3670,21 @@ Partitioner::unstructured_topo_from_unstructured(const conduit::Node &n_topo,
         auto iptr = as_index_t_array(n_indices);
 
         auto nverts_in_shape = conduit::blueprint::mesh::utils::TOPO_SHAPE_INDEX_COUNTS[shape.id];
-        for(size_t i = 0; i < element_ids.size(); i++)
+        auto n = static_cast<index_t>(element_ids.size());
+        new_conn.resize(n * nverts_in_shape);
+        index_t *new_conn_ptr = new_conn.data();
+        const index_t *old2new_ptr = old2new.data();
+#if defined(CONDUIT_USE_OPENMP)
+        using policy = conduit::execution::OpenMPExec;
+#else
+        using policy = conduit::execution::SerialExec;
+#endif
+        conduit::execution::for_all<policy>(0, n, [&](index_t i)
         {
             auto offset = element_ids[i] * nverts_in_shape;
-#if 0
-            cout << "cell " << element_ids[i] << ":  old(";
-            for(index_t j = 0; j < nverts_in_shape; j++)
-                cout << iptr[offset + j] << ", ";
-            cout << "), new(";
             for(index_t j = 0; j < nverts_in_shape; j++)
-            {
-                auto it = old2new.find(iptr[offset + j]);
-                if(it == old2new.end())
-                    cout << "ERROR" << ", ";
-                else
-                    cout << it->second << ", ";
-            }
-            cout << ")" << endl;
-#endif
-            for(index_t j = 0; j < nverts_in_shape; j++)
-                new_conn.push_back(old2new[iptr[offset + j]]);
-        }
+                new_conn_ptr[i * nverts_in_shape + j] = old2new_ptr[iptr[offset + j]];
+        });
 
         n_new_topo["elements/shape"].set(n_topo["elements/shape"]);
         n_new_topo["elements/connectivity"].set(new_conn);
@@ -4263,146 +4328,188 @@ Partitioner::execute(conduit::Node &output)
     DomainToChunkMap domain_to_chunk_map;
     std::map<index_t, const conduit::Node*> domain_id_to_node;
 
-    for(size_t i = 0; i < selections.size(); i++)
+    // Selections can decide whether they are whole as a side effect, so
+    // do that first, in order.
+    const index_t nsel = static_cast<index_t>(selections.size());
+    std::vector<bool> whole(nsel);
+    for(index_t i = 0; i < nsel; i++)
     {
-        // Get destination rank, domain if the selection has any. If not, it
-        // will return -1,-1 so we have some flexibility in how data are moved.
-        int dr = selections[i]->get_destination_rank();
-        int dd = selections[i]->get_destination_domain();
-
-        index_t sr = selections[i]->get_domain();
+        domain_id_to_node[selections[i]->get_domain()] = meshes[i];
+        whole[i] = selections[i]->get_whole(*meshes[i]);
+    }
 
-        domain_id_to_node[sr] = meshes[i];
-        if(selections[i]->get_whole(*meshes[i]))
+    // Extract the selections. Each one builds its chunk into its own nodes,
+    // so they can run concurrently. The results are gathered in selection
+    // order below so the output does not depend on the thread count.
+    std::vector<const conduit::Node *> sel_mesh(nsel, nullptr);
+    std::vector<int> sel_owns(nsel, 1);
+    std::vector<const conduit::Node *> sel_assoc_aset(nsel, nullptr);
+    std::vector<conduit::Node *> sel_adjset(nsel, nullptr);
+    std::vector<std::vector<index_t>> sel_vert_ids(nsel);
+    try
+    {
+        mesh::utils::for_all_domains(nsel, [&](index_t i)
         {
-            // We had a selection that spanned the entire mesh so we'll take
-            // the whole mesh rather than extracting. If we are using "mapping"
-            // then we will be wrapping the mesh so we can add vertex and element
-            // maps to it without changing the input mesh.
-            const conduit::Node* assoc_aset = nullptr;
-            conduit::Node* wrapped_adjset = nullptr;
-            if(mapping || meshes[i]->has_child("adjsets"))
+            if(whole[i])
             {
-                conduit::Node *c = wrap(i, *meshes[i]);
-                chunks.push_back(Chunk(c, true, dr, dd));
-                assoc_aset = get_associated_topo_adjset(*meshes[i], selections[i]->get_topology());
-                if (assoc_aset)
+                // We had a selection that spanned the entire mesh so we'll take
+                // the whole mesh rather than extracting. If we are using "mapping"
+                // then we will be wrapping the mesh so we can add vertex and element
+                // maps to it without changing the input mesh.
+                if(mapping || meshes[i]->has_child("adjsets"))
+                {
+                    conduit::Node *c = wrap(i, *meshes[i]);
+                    sel_mesh[i] = c;
+                    sel_assoc_aset[i] = get_associated_topo_adjset(*meshes[i], selections[i]->get_topology());
+                    if (sel_assoc_aset[i])
+                    {
+                        sel_adjset[i] = c->fetch_ptr("adjsets");
+                    }
+                }
+                else
                 {
-                    wrapped_adjset = c->fetch_ptr("adjsets");
+                    sel_mesh[i] = meshes[i];
+                    sel_owns[i] = 0;
                 }
             }
             else
             {
-                chunks.push_back(Chunk(meshes[i], false, dr, dd));
+                conduit::Node *c = extract(i, *meshes[i], sel_vert_ids[i]);
+                sel_mesh[i] = c;
+                sel_assoc_aset[i] = get_associated_topo_adjset(*meshes[i], selections[i]->get_topology());
+                if (sel_assoc_aset[i])
+                {
+                    sel_adjset[i] = c->fetch_ptr("adjsets");
+                }
             }
-            chunk_assoc_aset.push_back(assoc_aset);
-            adjset_data.push_back(wrapped_adjset);
-            domain_to_chunk_map[meshes[i]][i] = {};
-        }
-        else
+        });
+    }
+    catch(...)
+    {
+        // Free the chunks made by the selections that completed before
+        // passing the error on.
+        for(index_t i = 0; i < nsel; i++)
         {
-            std::vector<index_t> vert_ids;
-            conduit::Node *c = extract(i, *meshes[i], vert_ids);
-            chunks.push_back(Chunk(c, true, dr, dd));
-            const conduit::Node* assoc_aset
-                = get_associated_topo_adjset(*meshes[i], selections[i]->get_topology());
-            chunk_assoc_aset.push_back(assoc_aset);
-            if (assoc_aset)
-            {
-                adjset_data.push_back(c->fetch_ptr("adjsets"));
-            }
-            else
-            {
-                adjset_data.push_back(nullptr);
-            }
-            domain_to_chunk_map[meshes[i]][i] = std::move(vert_ids);
+            Chunk(sel_mesh[i], sel_owns[i] != 0 && sel_mesh[i] != nullptr).free();
         }
+        throw;
     }
 
-    // Compute the destination rank and destination domain of each input
-    // chunk present on this rank.
-    std::vector<int> dest_rank, dest_domain, offsets;
-    map_chunks(chunks, dest_rank, dest_domain, offsets);
+    for(index_t i = 0; i < nsel; i++)
+    {
+        // Get destination rank, domain if the selection has any. If not, it
+        // will return -1,-1 so we have some flexibility in how data are moved.
+        int dr = selections[i]->get_destination_rank();
+        int dd = selections[i]->get_destination_domain();
 
-    init_chunk_adjsets(chunk_assoc_aset, adjset_data);
-    build_interdomain_adjsets(offsets, domain_to_chunk_map, domain_id_to_node, adjset_data);
-    build_intradomain_adjsets(offsets, domain_to_chunk_map, adjset_data);
+        chunks.push_back(Chunk(sel_mesh[i], sel_owns[i] != 0, dr, dd));
+        chunk_assoc_aset.push_back(sel_assoc_aset[i]);
+        adjset_data.push_back(sel_adjset[i]);
+        domain_to_chunk_map[meshes[i]][i] = std::move(sel_vert_ids[i]);
+    }
 
-    // Communicate chunks to the right destination ranks
+    // Chunks that are sent or assembled, freed when we are done or when
+    // an error is raised.
     std::vector<Chunk> chunks_to_assemble;
-    std::vector<int> chunks_to_assemble_domains;
-    std::vector<int> chunks_to_assemble_gids;
-    communicate_chunks(chunks, dest_rank, dest_domain, offsets,
-        chunks_to_assemble,
-        chunks_to_assemble_domains,
-        chunks_to_assemble_gids);
+    auto free_chunks = [&]()
+    {
+        for(size_t i = 0; i < chunks.size(); i++)
+            chunks[i].free();
+        for(size_t i = 0; i < chunks_to_assemble.size(); i++)
+            chunks_to_assemble[i].free();
+    };
 
-    // Now that we have all the parts we need in chunks_to_assemble, combine
-    // the chunks.
-    std::set<int> unique_doms;
-    for(size_t i = 0; i < chunks_to_assemble_domains.size(); i++)
+    try
     {
-        unique_doms.insert(chunks_to_assemble_domains[i]);
-    }
+        // Compute the destination rank and destination domain of each input
+        // chunk present on this rank.
+        std::vector<int> dest_rank, dest_domain, offsets;
+        map_chunks(chunks, dest_rank, dest_domain, offsets);
+
+        init_chunk_adjsets(chunk_assoc_aset, adjset_data);
+        build_interdomain_adjsets(offsets, domain_to_chunk_map, domain_id_to_node, adjset_data);
+        build_intradomain_adjsets(offsets, domain_to_chunk_map, adjset_data);
+
+        // Communicate chunks to the right destination ranks
+        std::vector<int> chunks_to_assemble_domains;
+        std::vector<int> chunks_to_assemble_gids;
+        communicate_chunks(chunks, dest_rank, dest_domain, offsets,
+            chunks_to_assemble,
+            chunks_to_assemble_domains,
+            chunks_to_assemble_gids);
+
+        // Now that we have all the parts we need in chunks_to_assemble, combine
+        // the chunks.
+        std::set<int> unique_doms;
+        for(size_t i = 0; i < chunks_to_assemble_domains.size(); i++)
+        {
+            unique_doms.insert(chunks_to_assemble_domains[i]);
+        }
 
 #ifdef CONDUIT_DEBUG_PARTITIONER
-    std::cout << "unique_doms:\n";
-    for(auto dom = unique_doms.begin(); dom != unique_doms.end(); dom++)
-        std::cout << "  " << (int)*dom << "\n";
-    std::cout << std::endl;
+        std::cout << "unique_doms:\n";
+        for(auto dom = unique_doms.begin(); dom != unique_doms.end(); dom++)
+            std::cout << "  " << (int)*dom << "\n";
+        std::cout << std::endl;
 #endif
 
-    if(!chunks_to_assemble.empty())
-    {
-        output.reset();
-        for(auto dom = unique_doms.begin(); dom != unique_doms.end(); dom++)
+        if(!chunks_to_assemble.empty())
         {
-            // Get the chunks for this output domain.
-            std::vector<const Node *> this_dom_chunks;
-            std::vector<index_t> this_dom_cnkid;
-            for(size_t i = 0; i < chunks_to_assemble_domains.size(); i++)
+            // Group the chunks by output domain and make the output domains
+            // up front so the domains can be assembled concurrently.
+            output.reset();
+            const std::vector<int> doms(unique_doms.begin(), unique_doms.end());
+            const index_t ndoms = static_cast<index_t>(doms.size());
+            std::vector<std::vector<const Node *>> dom_chunks(ndoms);
+            std::vector<std::vector<index_t>> dom_cnkids(ndoms);
+            std::vector<conduit::Node *> new_doms(ndoms);
+            for(index_t di = 0; di < ndoms; di++)
             {
-                if(chunks_to_assemble_domains[i] == *dom)
+                // Get the chunks for this output domain.
+                for(size_t i = 0; i < chunks_to_assemble_domains.size(); i++)
                 {
-                    this_dom_chunks.push_back(chunks_to_assemble[i].mesh);
-                    this_dom_cnkid.push_back(chunks_to_assemble_gids[i]);
+                    if(chunks_to_assemble_domains[i] == doms[di])
+                    {
+                        dom_chunks[di].push_back(chunks_to_assemble[i].mesh);
+                        dom_cnkids[di].push_back(chunks_to_assemble_gids[i]);
+                    }
                 }
+                new_doms[di] = (ndoms > 1) ? &(output.append()) : &output;
             }
 
-            conduit::Node* new_dom;
-            if (unique_doms.size() > 1)
+            mesh::utils::for_all_domains(ndoms, [&](index_t di)
             {
-                new_dom = &(output.append());
-            }
-            else
-            {
-                new_dom = &output;
-            }
-            if(this_dom_chunks.size() == 1)
-            {
-                new_dom->set(*this_dom_chunks[0]); // Could we transfer ownership if we own the chunk?
-                new_dom->set_path("state/domain_id", (int)*dom);
+                const std::vector<const Node *> &this_dom_chunks = dom_chunks[di];
+                const std::vector<index_t> &this_dom_cnkid = dom_cnkids[di];
+                conduit::Node *new_dom = new_doms[di];
+                if(this_dom_chunks.size() == 1)
+                {
+                    new_dom->set(*this_dom_chunks[0]); // Could we transfer ownership if we own the chunk?
+                    new_dom->set_path("state/domain_id", doms[di]);
 
-                attach_chunk_adjset_to_single_dom(*new_dom, this_dom_cnkid[0]);
-            }
-            else if(this_dom_chunks.size() > 1)
-            {
-                // Combine the chunks for this domain and add to a list in output.
-                combine(*dom, this_dom_chunks, this_dom_cnkid, *new_dom);
-            }
+                    attach_chunk_adjset_to_single_dom(*new_dom, this_dom_cnkid[0]);
+                }
+                else if(this_dom_chunks.size() > 1)
+                {
+                    // Combine the chunks for this domain and add to a list in output.
+                    combine(doms[di], this_dom_chunks, this_dom_cnkid, *new_dom);
+                }
 
-            if (new_dom->has_child("adjsets"))
-            {
-                merge_chunked_adjsets((*new_dom)["adjsets"], dest_domain);
-            }
+                if (new_dom->has_child("adjsets"))
+                {
+                    merge_chunked_adjsets((*new_dom)["adjsets"], dest_domain);
+                }
+            });
         }
     }
+    catch(...)
+    {
+        free_chunks();
+        throw;
+    }
 
     // Clean up
-    for(size_t i = 0; i < chunks.size(); i++)
-        chunks[i].free();
-    for(size_t i = 0; i < chunks_to_assemble.size(); i++)
-        chunks_to_assemble[i].free();
+    free_chunks();
 
 #ifdef CONDUIT_DEBUG_PARTITIONER
     std::cout << "Partition output domains:\n";
@@ -4706,6 +4813,16 @@ private:
         const std::vector<coord_system> &systems, index_t dimension,
         double tolerance);
 
+    /**
+    @brief Merges points within tolerance using a uniform grid of cells at
+        least as large as the tolerance. The points are processed in
+        parallel and each point merges into the lowest prior unique point
+        within tolerance, the same result as merging one point at a time.
+    */
+    void spatial_hash_merge(const std::vector<Node> &coordsets,
+        const std::vector<coord_system> &systems, index_t dimension,
+        double tolerance);
+
     void truncate_merge(const std::vector<Node> &coordsets,
         const std::vector<coord_system> &systems, index_t dimension, double tolerance);
 
@@ -5715,15 +5832,17 @@ void
 point_merge::merge_data(const std::vector<Node> &coordsets,
         const std::vector<coord_system> &systems, index_t dimension, double tolerance)
 {
-#define USE_SPATIAL_SEARCH_MERGE
+#define USE_SPATIAL_HASH_MERGE
 #if   defined(USE_TRUNCATE_PRECISION_MERGE)
     truncate_merge(coordsets, systems, dimension, tolerance);
+#elif defined(USE_SPATIAL_HASH_MERGE)
+    spatial_hash_merge(coordsets, systems, dimension, tolerance);
 #elif defined(USE_SPATIAL_SEARCH_MERGE)
     spatial_search_merge(coordsets, systems, dimension, tolerance);
 #else
     simple_merge_data(coordsets, systems, dimension, tolerance);
 #endif
-#undef USE_SPATIAL_SEARCH_MERGE
+#undef USE_SPATIAL_HASH_MERGE
 }
 
 //-----------------------------------------------------------------------------
@@ -6062,6 +6181,168 @@ point_merge::spatial_search_merge(const std::vector<Node> &coordsets,
         << ", nodes in tree " << point_records.nodes() << std::endl);
 }
 
+//-----------------------------------------------------------------------------
+void
+point_merge::spatial_hash_merge(const std::vector<Node> &coordsets,
+        const std::vector<coord_system> &systems, index_t dimension,
+        double tolerance)
+{
+    PM_DEBUG_PRINT("Spatial hash merging!" << std::endl);
+#if defined(CONDUIT_USE_OPENMP)
+    using policy = conduit::execution::OpenMPExec;
+#else
+    using policy = conduit::execution::SerialExec;
+#endif
+    const index_t nsets = static_cast<index_t>(coordsets.size());
+
+    // Gather the (cartesian) points of all coordsets into one array.
+    std::vector<index_t> set_offsets(nsets + 1, 0);
+    for(index_t i = 0; i < nsets; i++)
+    {
+        set_offsets[i + 1] = set_offsets[i] +
+            mesh::utils::coordset::length(coordsets[i]);
+    }
+    const index_t npts = set_offsets[nsets];
+    std::vector<float64> pts(npts * 3);
+    std::vector<float64> set_mins(nsets * 3, std::numeric_limits<float64>::max());
+    conduit::execution::for_all<policy>(0, nsets, [&](index_t i)
+    {
+        const bool translate = systems[i] != coord_system::cartesian
+            && systems[i] != coord_system::logical;
+        index_t pid = set_offsets[i];
+        iterate_coordinates(coordsets[i], [&](float64 *p, index_t)
+        {
+            if(translate)
+            {
+                translate_system(systems[i], coord_system::cartesian,
+                    p[0], p[1], p[2], p[0], p[1], p[2]);
+            }
+            for(int d = 0; d < 3; d++)
+            {
+                pts[pid * 3 + d] = p[d];
+                set_mins[i * 3 + d] = std::min(set_mins[i * 3 + d], p[d]);
+            }
+            pid++;
+        });
+    });
+    float64 pmin[3] = {0., 0., 0.};
+    for(int d = 0; d < 3; d++)
+    {
+        pmin[d] = std::numeric_limits<float64>::max();
+        for(index_t i = 0; i < nsets; i++)
+        {
+            pmin[d] = std::min(pmin[d], set_mins[i * 3 + d]);
+        }
+    }
+
+    // Quantize the points to cells at least as large as the tolerance so
+    // that points within tolerance are in the same or neighboring cells.
+    using cell_type = std::array<int64, 3>;
+    const float64 cell_size = (tolerance > 0.) ? tolerance : 1.;
+    std::vector<cell_type> cells(npts);
+    conduit::execution::for_all<policy>(0, npts, [&](index_t i)
+    {
+        for(int d = 0; d < 3; d++)
+        {
+            cells[i][d] = static_cast<int64>(
+                std::floor((pts[i * 3 + d] - pmin[d]) / cell_size));
+        }
+    });
+
+    // Order the points by cell, then by id.
+    std::vector<index_t> order(npts);
+    std::iota(order.begin(), order.end(), 0);
+    conduit::execution::sort<policy>(order.begin(), order.end(),
+        [&](index_t a, index_t b)
+        {
+            return (cells[a] < cells[b]) || (cells[a] == cells[b] && a < b);
+        });
+
+    // Invokes func(j) on each point j < i within tolerance of point i, in
+    // increasing id order within a cell, until func returns true.
+    const float64 t2 = tolerance * tolerance;
+    const int nbr_range[3] = {1, dimension > 1 ? 1 : 0, dimension > 2 ? 1 : 0};
+    const auto for_each_prior_neighbor = [&](index_t i, const std::function<bool(index_t)> &func)
+    {
+        const float64 *p = &pts[i * 3];
+        cell_type c;
+        for(int dk = -nbr_range[2]; dk <= nbr_range[2]; dk++)
+        for(int dj = -nbr_range[1]; dj <= nbr_range[1]; dj++)
+        for(int di = -nbr_range[0]; di <= nbr_range[0]; di++)
+        {
+            c[0] = cells[i][0] + di; c[1] = cells[i][1] + dj; c[2] = cells[i][2] + dk;
+            auto it = std::lower_bound(order.begin(), order.end(), c,
+                [&](index_t a, const cell_type &key) { return cells[a] < key; });
+            for(; it != order.end() && cells[*it] == c && *it < i; it++)
+            {
+                const float64 *q = &pts[*it * 3];
+                const float64 dx = p[0] - q[0], dy = p[1] - q[1], dz = p[2] - q[2];
+                if(dx * dx + dy * dy + dz * dz <= t2 && func(*it))
+                {
+                    return;
+                }
+            }
+        }
+    };
+
+    // Find the lowest prior point within tolerance of each point.
+    std::vector<index_t> rep(npts);
+    conduit::execution::for_all<policy>(0, npts, [&](index_t i)
+    {
+        index_t lowest = i;
+        for_each_prior_neighbor(i, [&](index_t j)
+        {
+            lowest = std::min(lowest, j);
+            return false;
+        });
+        rep[i] = lowest;
+    });
+
+    // Points merge into the lowest prior unique point within tolerance, as
+    // they would if the points were merged one at a time. The lowest prior
+    // point is almost always unique; otherwise search its neighbors again.
+    std::vector<index_t> new_ids(npts);
+    index_t nunique = 0;
+    for(index_t i = 0; i < npts; i++)
+    {
+        if(rep[i] != i && rep[rep[i]] != rep[i])
+        {
+            index_t lowest = i;
+            for_each_prior_neighbor(i, [&](index_t j)
+            {
+                if(rep[j] == j)
+                {
+                    lowest = std::min(lowest, j);
+                }
+                return false;
+            });
+            rep[i] = lowest;
+        }
+        new_ids[i] = (rep[i] == i) ? nunique++ : new_ids[rep[i]];
+    }
+
+    // Write the maps and the unique coordinates.
+    old_to_new_ids.resize(nsets);
+    for(index_t i = 0; i < nsets; i++)
+    {
+        old_to_new_ids[i].resize(set_offsets[i + 1] - set_offsets[i]);
+    }
+    new_coords.resize(nunique * dimension);
+    conduit::execution::for_all<policy>(0, npts, [&](index_t gi)
+    {
+        const index_t si = static_cast<index_t>(std::upper_bound(
+            set_offsets.begin(), set_offsets.end(), gi) - set_offsets.begin()) - 1;
+        old_to_new_ids[si][gi - set_offsets[si]] = new_ids[gi];
+        if(rep[gi] == gi)
+        {
+            for(index_t d = 0; d < dimension; d++)
+            {
+                new_coords[new_ids[gi] * dimension + d] = pts[gi * 3 + d];
+            }
+        }
+    });
+}
+
 //-----------------------------------------------------------------------------
 void
 point_merge::truncate_merge(const std::vector<Node> &coordsets,
@@ -431,9 +431,23 @@ protected:
                     const std::vector<index_t> &ids,
                     Node &n_output_fields) const;
 
+    /**
+     @brief Copy a field's attributes to the output fields and return the
+            source and destination values nodes that need to be sliced.
+
+     @param n_field The field to copy.
+     @param n_output_fields The node that will contain the new field.
+     @param[out] src_values The field's values are appended here.
+     @param[out] dest_values The new field's values are appended here.
+     */
+    void prepare_field_copy(const conduit::Node &n_field,
+                            Node &n_output_fields,
+                            std::vector<const conduit::Node *> &src_values,
+                            std::vector<conduit::Node *> &dest_values) const;
+
     void get_vertex_ids_for_element_ids(const conduit::Node &n_topo,
              const std::vector<index_t> &element_ids,
-             std::set<index_t> &vertex_ids) const;
+             std::vector<index_t> &vertex_ids) const;
 
     /**
      @brief Extract the idx'th selection from the input mesh and return a
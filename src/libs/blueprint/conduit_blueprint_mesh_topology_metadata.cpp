@@ -166,6 +166,9 @@ class TopologyMetadata::Implementation : public TopologyMetadataBase
         std::vector<index_t> data;
         std::vector<index_t> sizes;
         std::vector<index_t> offsets;
+        // When set, the data are borrowed from a topology level instead.
+        const index_t       *external_data{nullptr};
+        size_t               external_size{0};
         // Other fields
         int                  single_size{1};
         bool                 requested{false};
@@ -174,6 +177,11 @@ class TopologyMetadata::Implementation : public TopologyMetadataBase
         inline index_t get_size(index_t entity_id) const;
         inline index_t get_offset(index_t entity_id) const;
         inline index_t sum_sizes(index_t num_entities) const;
+        inline const index_t *data_ptr() const;
+        inline size_t data_size() const;
+        void compact();
+        void release();
+        size_t memory_usage() const;
     };
 
     // Data members
@@ -190,6 +198,7 @@ class TopologyMetadata::Implementation : public TopologyMetadataBase
     association G[MAX_ENTITY_DIMS][MAX_ENTITY_DIMS];  
     association L[MAX_ENTITY_DIMS][MAX_ENTITY_DIMS];  // For explicit local maps
     std::vector<index_t> local_to_global[MAX_ENTITY_DIMS];
+    bool released[MAX_ENTITY_DIMS];
 
 public:
     //-----------------------------------------------------------------------
@@ -377,6 +386,36 @@ public:
      @return The map for the requested dimension.
      */
     const std::vector<index_t> &get_local_to_global_map(index_t) const;
+
+    //-----------------------------------------------------------------------
+    /**
+     @brief Reduce the memory used by the topologies and associations.
+     */
+    void compact();
+
+    //-----------------------------------------------------------------------
+    /**
+     @brief Free the topology, associations, and local to global map for a
+            dimension.
+     @param dim The dimension to release.
+     */
+    void release(index_t dim);
+
+    //-----------------------------------------------------------------------
+    /**
+     @brief Free the storage for a single association.
+     @param type Whether we want to release GLOBAL or LOCAL data.
+     @param src_dim The source dimension of the association.
+     @param dst_dim The destination dimension of the association.
+     */
+    void release_dim_map(IndexType type, index_t src_dim, index_t dst_dim);
+
+    //-----------------------------------------------------------------------
+    /**
+     @brief Report the number of bytes held for each level.
+     @param rep The node that will contain the report.
+     */
+    void memory_report(conduit::Node &rep) const;
 private:
 
     //-----------------------------------------------------------------------
@@ -1382,11 +1421,11 @@ std::pair<index_t *, index_t>
 TopologyMetadata::Implementation::association::get_data(index_t entity_id) const
 {
     std::pair<index_t *, index_t> retval;
-    if(!data.empty())
+    if(data_size() > 0)
     {
         index_t size = get_size(entity_id);
         index_t offset = get_offset(entity_id);
-        retval = std::make_pair(const_cast<index_t *>(&data[offset]), size);
+        retval = std::make_pair(const_cast<index_t *>(data_ptr() + offset), size);
     }
     else
     {
@@ -1399,7 +1438,16 @@ TopologyMetadata::Implementation::association::get_data(index_t entity_id) const
 index_t
 TopologyMetadata::Implementation::association::get_size(index_t entity_id) const
 {
-    return sizes.empty() ? single_size : sizes[entity_id];
+    if(!sizes.empty())
+        return sizes[entity_id];
+    if(offsets.empty())
+        return single_size;
+
+    // The sizes were compacted away. Derive them from the offsets.
+    const auto n = static_cast<index_t>(offsets.size());
+    const index_t end = (entity_id + 1 < n) ? offsets[entity_id + 1]
+                                            : static_cast<index_t>(data_size());
+    return end - offsets[entity_id];
 }
 
 //---------------------------------------------------------------------------
@@ -1414,19 +1462,95 @@ index_t
 TopologyMetadata::Implementation::association::sum_sizes(index_t num_entities) const
 {
     index_t sum = 0;
-    if(sizes.empty())
+    if(!sizes.empty())
     {
-        // single size case.
-        sum = num_entities * single_size;
+        for(size_t i = 0; i < sizes.size(); i++)
+            sum += sizes[i];
+    }
+    else if(!offsets.empty())
+    {
+        // The sizes are derived from the offsets so the data are contiguous.
+        sum = static_cast<index_t>(data_size());
     }
     else
     {
-        for(size_t i = 0; i < sizes.size(); i++)
-            sum += sizes[i];
+        // single size case.
+        sum = num_entities * single_size;
     }
     return sum;
 }
 
+//---------------------------------------------------------------------------
+const index_t *
+TopologyMetadata::Implementation::association::data_ptr() const
+{
+    return (external_data != nullptr) ? external_data : data.data();
+}
+
+//---------------------------------------------------------------------------
+size_t
+TopologyMetadata::Implementation::association::data_size() const
+{
+    return (external_data != nullptr) ? external_size : data.size();
+}
+
+//---------------------------------------------------------------------------
+/**
+ @brief Drop the sizes and offsets when they can be computed. If all of the
+        entities have the same size then both are replaced by single_size.
+        If the data are contiguous then the sizes are derived from offsets.
+ */
+void
+TopologyMetadata::Implementation::association::compact()
+{
+    const size_t n = offsets.size();
+    const size_t dsize = data_size();
+    if(!sizes.empty() && sizes.size() == n && dsize > 0)
+    {
+        bool uniform = true, contiguous = true;
+        const index_t sz = sizes[0];
+        for(size_t i = 0; i < n && (uniform || contiguous); i++)
+        {
+            uniform &= (sizes[i] == sz) && (offsets[i] == static_cast<index_t>(i) * sz);
+            const index_t end = (i + 1 < n) ? offsets[i + 1] : static_cast<index_t>(dsize);
+            contiguous &= (offsets[i] + sizes[i] == end);
+        }
+
+        if(uniform && static_cast<size_t>(sz) * n == dsize)
+        {
+            single_size = static_cast<int>(sz);
+            std::vector<index_t>().swap(sizes);
+            std::vector<index_t>().swap(offsets);
+        }
+        else if(contiguous)
+        {
+            std::vector<index_t>().swap(sizes);
+        }
+    }
+    data.shrink_to_fit();
+    sizes.shrink_to_fit();
+    offsets.shrink_to_fit();
+}
+
+//---------------------------------------------------------------------------
+void
+TopologyMetadata::Implementation::association::release()
+{
+    std::vector<index_t>().swap(data);
+    std::vector<index_t>().swap(sizes);
+    std::vector<index_t>().swap(offsets);
+    external_data = nullptr;
+    external_size = 0;
+    requested = false;
+}
+
+//---------------------------------------------------------------------------
+size_t
+TopologyMetadata::Implementation::association::memory_usage() const
+{
+    return sizeof(index_t) * (data.capacity() + sizes.capacity() + offsets.capacity());
+}
+
 //---------------------------------------------------------------------------
 //---------------------------------------------------------------------------
 
@@ -1476,6 +1600,7 @@ TopologyMetadata::Implementation::initialize(const std::vector<std::pair<size_t,
     {
         dim_topos[dim].reset();
         dim_topo_lengths[dim] = 0;
+        released[dim] = false;
     }
 
     // Request the associations that we need to build.
@@ -1516,6 +1641,8 @@ TopologyMetadata::Implementation::get_topology(size_t dim)
 {
     if(dim > 3)
         CONDUIT_ERROR("Invalid dimension");
+    if(released[dim])
+        CONDUIT_ERROR("The topology for dimension " << dim << " was released.");
     if(dim_topos_int_dtype[dim].dtype().is_empty())
         convert_topology_dtype(dim, dim_topos_int_dtype[dim], false);
 
@@ -1528,6 +1655,8 @@ TopologyMetadata::Implementation::get_topology(size_t dim, conduit::Node &dest)
 {
     if(dim > 3)
         CONDUIT_ERROR("Invalid dimension");
+    if(released[dim])
+        CONDUIT_ERROR("The topology for dimension " << dim << " was released.");
     convert_topology_dtype(dim, dest, true);
 }
 
@@ -2975,12 +3104,12 @@ TopologyMetadata::Implementation::get_global_dim_map(index_t src_dim, index_t ds
         if(int_dtype.id() != DataType::index_t().id())
         {
             conduit::Node wrap;
-            wrap.set_external(const_cast<index_t *>(&assoc.data[0]), assoc.data.size());
+            wrap.set_external(const_cast<index_t *>(assoc.data_ptr()), assoc.data_size());
             wrap.to_data_type(int_dtype.id(), values);
         }
         else
         {
-            values.set(assoc.data);
+            values.set(assoc.data_ptr(), assoc.data_size());
         }
 
         // Copy sizes out in the desired int_dtype.
@@ -2992,6 +3121,11 @@ TopologyMetadata::Implementation::get_global_dim_map(index_t src_dim, index_t ds
             src_sizes = &tmp;
             size_t nembed = dim_topo_lengths[src_dim];
             tmp.resize(nembed, assoc.single_size);
+            if(!assoc.offsets.empty())
+            {
+                for(size_t i = 0; i < nembed; i++)
+                    tmp[i] = assoc.get_size(static_cast<index_t>(i));
+            }
         }
         if(int_dtype.id() != DataType::index_t().id())
         {
@@ -3272,6 +3406,147 @@ TopologyMetadata::Implementation::get_local_to_global_map(index_t dim) const
     return local_to_global[dim];
 }
 
+//---------------------------------------------------------------------------
+void
+TopologyMetadata::Implementation::compact()
+{
+    CONDUIT_ANNOTATE_MARK_FUNCTION;
+
+    const int maxdim = dimension();
+
+    // Store each topology level once in the preferred integer type if it
+    // is 32-bit and the counts fit. Otherwise, the G(e,0) associations are
+    // copies of the level connectivity so they can borrow it instead.
+    const bool narrow = int_dtype.id() == DataType::int32().id() &&
+                        DataType::index_t().id() != DataType::int32().id();
+    const index_t int32_max = static_cast<index_t>(std::numeric_limits<int32>::max());
+    for(int d = 0; d <= maxdim; d++)
+    {
+        if(released[d] || dim_topos[d].dtype().is_empty())
+            continue;
+
+        if(narrow)
+        {
+            index_t max_count = std::max(coords_length, dim_topo_lengths[d]);
+            NodeConstIterator it = dim_topos[d].children();
+            while(it.has_next())
+            {
+                const Node &group = it.next();
+                if(group.has_child("connectivity"))
+                {
+                    max_count = std::max(max_count,
+                        group["connectivity"].dtype().number_of_elements());
+                }
+            }
+            if(max_count < int32_max)
+            {
+                if(dim_topos_int_dtype[d].dtype().is_empty())
+                    convert_topology_dtype(d, dim_topos_int_dtype[d], false);
+                dim_topos[d].reset();
+                dim_topos[d].set_external(dim_topos_int_dtype[d]);
+            }
+        }
+        else if((d == 1 || d == 2) && G[d][0].requested &&
+                G[d][0].external_data == nullptr &&
+                dim_topos[d].has_path("elements/connectivity"))
+        {
+            const Node &conn = dim_topos[d].fetch_existing("elements/connectivity");
+            if(conn.dtype().id() == DataType::index_t().id() &&
+               conn.dtype().is_compact() &&
+               static_cast<size_t>(conn.dtype().number_of_elements()) == G[d][0].data.size())
+            {
+                std::vector<index_t>().swap(G[d][0].data);
+                G[d][0].external_data = conn.as_index_t_ptr();
+                G[d][0].external_size = static_cast<size_t>(conn.dtype().number_of_elements());
+            }
+        }
+    }
+
+    for(int e = 0; e <= maxdim; e++)
+    {
+        for(int a = 0; a <= maxdim; a++)
+        {
+            if(G[e][a].requested)
+                G[e][a].compact();
+            if(L[e][a].requested)
+            {
+                L[e][a].data.shrink_to_fit();
+                L[e][a].sizes.shrink_to_fit();
+                L[e][a].offsets.shrink_to_fit();
+            }
+        }
+        local_to_global[e].shrink_to_fit();
+    }
+}
+
+//---------------------------------------------------------------------------
+void
+TopologyMetadata::Implementation::release(index_t dim)
+{
+    if(dim < 0 || dim > 3)
+        CONDUIT_ERROR("Invalid dimension");
+
+    for(index_t d = 0; d < static_cast<index_t>(MAX_ENTITY_DIMS); d++)
+    {
+        release_dim_map(GLOBAL, dim, d);
+        release_dim_map(GLOBAL, d, dim);
+        release_dim_map(LOCAL, dim, d);
+        release_dim_map(LOCAL, d, dim);
+    }
+    dim_topos_int_dtype[dim].reset();
+    dim_topos[dim].reset();
+    std::vector<index_t>().swap(local_to_global[dim]);
+    released[dim] = true;
+}
+
+//---------------------------------------------------------------------------
+void
+TopologyMetadata::Implementation::release_dim_map(IndexType type,
+    index_t src_dim, index_t dst_dim)
+{
+    if(src_dim < 0 || src_dim > 3 || dst_dim < 0 || dst_dim > 3)
+        CONDUIT_ERROR("Invalid dimension");
+
+    // NOTE: single_size is kept since the implicit local maps use it.
+    if(type == GLOBAL)
+        G[src_dim][dst_dim].release();
+    else
+        L[src_dim][dst_dim].release();
+}
+
+//---------------------------------------------------------------------------
+void
+TopologyMetadata::Implementation::memory_report(conduit::Node &rep) const
+{
+    rep.reset();
+    index_t total = 0;
+    for(int d = dimension(); d >= 0; d--)
+    {
+        index_t topo_bytes = dim_topos[d].total_bytes_allocated() +
+                             dim_topos_int_dtype[d].total_bytes_allocated();
+        index_t global_bytes = 0, local_bytes = 0;
+        for(size_t a = 0; a < MAX_ENTITY_DIMS; a++)
+        {
+            global_bytes += static_cast<index_t>(G[d][a].memory_usage());
+            local_bytes += static_cast<index_t>(L[d][a].memory_usage());
+        }
+        index_t l2g_bytes = static_cast<index_t>(sizeof(index_t) *
+                                                 local_to_global[d].capacity());
+        index_t level_total = topo_bytes + global_bytes + local_bytes + l2g_bytes;
+
+        std::stringstream oss;
+        oss << "levels/topo" << d;
+        conduit::Node &level = rep[oss.str()];
+        level["topology"] = topo_bytes;
+        level["global_associations"] = global_bytes;
+        level["local_associations"] = local_bytes;
+        level["local_to_global"] = l2g_bytes;
+        level["total"] = level_total;
+        total += level_total;
+    }
+    rep["total"] = total;
+}
+
 //---------------------------------------------------------------------------
 void
 TopologyMetadata::Implementation::build_local_to_global()
@@ -3509,6 +3784,34 @@ TopologyMetadata::get_local_to_global_map(index_t dim) const
     return impl->get_local_to_global_map(dim);
 }
 
+//---------------------------------------------------------------------------
+void
+TopologyMetadata::compact()
+{
+    impl->compact();
+}
+
+//---------------------------------------------------------------------------
+void
+TopologyMetadata::release(index_t dim)
+{
+    impl->release(dim);
+}
+
+//---------------------------------------------------------------------------
+void
+TopologyMetadata::release_dim_map(IndexType type, index_t src_dim, index_t dst_dim)
+{
+    impl->release_dim_map(type, src_dim, dst_dim);
+}
+
+//---------------------------------------------------------------------------
+void
+TopologyMetadata::memory_report(conduit::Node &rep) const
+{
+    impl->memory_report(rep);
+}
+
 //-----------------------------------------------------------------------------
 // -- begin conduit::blueprint::mesh::utils::reference --
 //-----------------------------------------------------------------------------
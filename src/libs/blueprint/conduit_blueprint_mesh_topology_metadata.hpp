@@ -416,6 +416,50 @@ public:
      */
     const std::vector<index_t> &get_local_to_global_map(index_t dim) const;
 
+    //-----------------------------------------------------------------------
+    /**
+     @brief Reduce the memory used by the metadata without changing the
+            results of any query. Associations whose entities all have the
+            same size drop their sizes and offsets, and other associations
+            derive their sizes from their offsets. When the preferred integer
+            type is 32-bit, the topology levels are stored once as 32-bit
+            data. When it is index_t, the point associations G(e,0) share
+            the connectivity of the topology levels.
+     */
+    void compact();
+
+    //-----------------------------------------------------------------------
+    /**
+     @brief Free the topology for a dimension, along with the associations
+            and the local to global map that involve it. Call this once the
+            data needed for that level were pulled out using get_topology()
+            or get_dim_map(). The topology lengths are kept.
+
+     @param dim The dimension of the level to release.
+     */
+    void release(index_t dim);
+
+    //-----------------------------------------------------------------------
+    /**
+     @brief Free the storage for a single association. Afterwards, the
+            association is no longer reported as requested.
+
+     @param type Whether we want to release GLOBAL or LOCAL data.
+     @param src_dim The source dimension of the association.
+     @param dst_dim The destination dimension of the association.
+     */
+    void release_dim_map(IndexType type, index_t src_dim, index_t dst_dim);
+
+    //-----------------------------------------------------------------------
+    /**
+     @brief Report the number of bytes held by the metadata for each level.
+            The report contains "levels/topo<d>" nodes with "topology",
+            "global_associations", "local_associations", "local_to_global",
+            and "total" entries, plus an overall "total".
+     @param rep The node that will contain the report.
+     */
+    void memory_report(conduit::Node &rep) const;
+
 private:
     class Implementation;
     Implementation *impl;
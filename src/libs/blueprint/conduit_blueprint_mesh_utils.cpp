@@ -12,6 +12,7 @@
 // std lib includes
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <deque>
 #include <string>
 #include <limits>
@@ -325,11 +326,10 @@ find_domain_id(const Node &node)
 {
     index_t domain_id = -1;
 
-    Node info;
     const Node *curr_node = &node;
     while(curr_node != NULL && domain_id == -1)
     {
-        if(blueprint::mesh::verify(*curr_node, info))
+        if(blueprint::mesh::verify(*curr_node))
         {
             const std::vector<const Node *> domains = blueprint::mesh::domains(*curr_node);
             const Node &domain = *domains.front();
@@ -346,143 +346,239 @@ find_domain_id(const Node &node)
 }
 
 //---------------------------------------------------------------------------
-// @brief Slice the n_src array using the indices stored in ids. We use the
-//        array classes for their [] operators that deal with interleaved
-//        and non-interleaved arrays.
-template <typename T, typename IndexType>
-inline void
-typed_slice_array(const T &src, const std::vector<IndexType> &ids, T &dest)
+bool same_nodes(const conduit::Node &n1, const conduit::Node &n2)
 {
-    size_t n = ids.size();
-    for(size_t i = 0; i < n; i++)
-        dest[i] = src[ids[i]];
+   return (&n1 == &n2) ||
+          (n1.contiguous_data_ptr() != nullptr &&
+           n1.contiguous_data_ptr() == n2.contiguous_data_ptr());
 }
 
+//---------------------------------------------------------------------------
+// Slicing gathers values by id with the source element size, so it works
+// for every leaf data type (including interleaved data) without per-type
+// dispatch. The ids are turned into runs of consecutive ids once and the
+// runs are then applied to every array being sliced.
+//---------------------------------------------------------------------------
+
+// Runs of at least this many consecutive ids are copied with memcpy when
+// the source data are contiguous.
+static const index_t SLICE_MEMCPY_RUN_LENGTH = 8;
+// The number of output values in a unit of parallel work.
+static const index_t SLICE_BLOCK_SIZE = 16384;
+
 //---------------------------------------------------------------------------
 /**
- @brief Slice a node as an array using its native data type.
+ @brief The destination positions [dst, dst+len) take the source values
+        [src, src+len).
  */
-template <typename IndexType>
-void
-slice_array_internal(const conduit::Node &n_src_values,
-                     const std::vector<IndexType> &ids,
-                     Node &n_dest_values)
+struct SliceRun
 {
-    // Copy the DataType of the input conduit::Node but override the number of elements
-    // before copying it in so assigning to n_dest_values triggers a memory
-    // allocation.
-    auto dt = n_src_values.dtype();
-    n_dest_values = DataType(n_src_values.dtype().id(), ids.size());
+    index_t src;
+    index_t dst;
+    index_t len;
+};
 
-    // Do the slice.
-    if(dt.is_int8())
-    {
-        auto dest(n_dest_values.as_int8_array());
-        typed_slice_array(n_src_values.as_int8_array(), ids, dest);
-    }
-    else if(dt.is_int16())
-    {
-        auto dest(n_dest_values.as_int16_array());
-        typed_slice_array(n_src_values.as_int16_array(), ids, dest);
-    }
-    else if(dt.is_int32())
-    {
-        auto dest(n_dest_values.as_int32_array());
-        typed_slice_array(n_src_values.as_int32_array(), ids, dest);
-    }
-    else if(dt.is_int64())
-    {
-        auto dest(n_dest_values.as_int64_array());
-        typed_slice_array(n_src_values.as_int64_array(), ids, dest);
-    }
-    else if(dt.is_uint8())
-    {
-        auto dest(n_dest_values.as_uint8_array());
-        typed_slice_array(n_src_values.as_uint8_array(), ids, dest);
-    }
-    else if(dt.is_uint16())
-    {
-        auto dest(n_dest_values.as_uint16_array());
-        typed_slice_array(n_src_values.as_uint16_array(), ids, dest);
-    }
-    else if(dt.is_uint32())
-    {
-        auto dest(n_dest_values.as_uint32_array());
-        typed_slice_array(n_src_values.as_uint32_array(), ids, dest);
-    }
-    else if(dt.is_uint64())
-    {
-        auto dest(n_dest_values.as_uint64_array());
-        typed_slice_array(n_src_values.as_uint64_array(), ids, dest);
-    }
-    else if(dt.is_float32())
-    {
-        auto dest(n_dest_values.as_float32_array());
-        typed_slice_array(n_src_values.as_float32_array(), ids, dest);
-    }
-    else if(dt.is_float64())
-    {
-        auto dest(n_dest_values.as_float64_array());
-        typed_slice_array(n_src_values.as_float64_array(), ids, dest);
-    }
-    else if(dt.is_char())
-    {
-        auto dest(n_dest_values.as_char_array());
-        typed_slice_array(n_src_values.as_char_array(), ids, dest);
+//---------------------------------------------------------------------------
+template <typename IndexType>
+static void
+make_slice_runs(const std::vector<IndexType> &ids, std::vector<SliceRun> &runs)
+{
+    runs.clear();
+    const index_t n = static_cast<index_t>(ids.size());
+    index_t i = 0;
+    while(i < n)
+    {
+        SliceRun run;
+        run.src = static_cast<index_t>(ids[i]);
+        run.dst = i;
+        run.len = 1;
+        // Split runs at block boundaries so blocks start at a run.
+        while(i + run.len < n &&
+              static_cast<index_t>(ids[i + run.len]) == run.src + run.len &&
+              (i + run.len) % SLICE_BLOCK_SIZE != 0)
+        {
+            run.len++;
+        }
+        runs.push_back(run);
+        i += run.len;
     }
-    else if(dt.is_short())
+}
+
+//---------------------------------------------------------------------------
+/**
+ @brief Gathers the values for a range of runs from a source to a compact
+        destination whose elements are T sized.
+ */
+template <typename T>
+static void
+typed_slice_runs(const SliceRun *runs, index_t nruns,
+                 const uint8 *src, index_t src_stride, uint8 *dest)
+{
+    T *typed_dest = reinterpret_cast<T *>(dest);
+    if(src_stride == static_cast<index_t>(sizeof(T)))
     {
-        auto dest(n_dest_values.as_short_array());
-        typed_slice_array(n_src_values.as_short_array(), ids, dest);
+        const T *typed_src = reinterpret_cast<const T *>(src);
+        for(index_t r = 0; r < nruns; r++)
+        {
+            const SliceRun &run = runs[r];
+            if(run.len >= SLICE_MEMCPY_RUN_LENGTH)
+            {
+                memcpy(typed_dest + run.dst, typed_src + run.src, run.len * sizeof(T));
+            }
+            else
+            {
+                for(index_t i = 0; i < run.len; i++)
+                    typed_dest[run.dst + i] = typed_src[run.src + i];
+            }
+        }
     }
-    else if(dt.is_int())
+    else
     {
-        auto dest(n_dest_values.as_int_array());
-        typed_slice_array(n_src_values.as_int_array(), ids, dest);
+        for(index_t r = 0; r < nruns; r++)
+        {
+            const SliceRun &run = runs[r];
+            for(index_t i = 0; i < run.len; i++)
+            {
+                memcpy(typed_dest + run.dst + i,
+                       src + (run.src + i) * src_stride, sizeof(T));
+            }
+        }
     }
-    else if(dt.is_long())
-    {
-        auto dest(n_dest_values.as_long_array());
-        typed_slice_array(n_src_values.as_long_array(), ids, dest);
+}
+
+//---------------------------------------------------------------------------
+static void
+slice_runs(const SliceRun *runs, index_t nruns,
+           const uint8 *src, index_t src_stride,
+           index_t elem_bytes, uint8 *dest)
+{
+    switch(elem_bytes)
+    {
+    case 1: typed_slice_runs<uint8>(runs, nruns, src, src_stride, dest); break;
+    case 2: typed_slice_runs<uint16>(runs, nruns, src, src_stride, dest); break;
+    case 4: typed_slice_runs<uint32>(runs, nruns, src, src_stride, dest); break;
+    case 8: typed_slice_runs<uint64>(runs, nruns, src, src_stride, dest); break;
+    default:
+        for(index_t r = 0; r < nruns; r++)
+        {
+            const SliceRun &run = runs[r];
+            for(index_t i = 0; i < run.len; i++)
+            {
+                memcpy(dest + (run.dst + i) * elem_bytes,
+                       src + (run.src + i) * src_stride, elem_bytes);
+            }
+        }
+        break;
     }
-    else if(dt.is_unsigned_char())
+}
+
+//---------------------------------------------------------------------------
+/**
+ @brief Slices many arrays with one list of ids. Each source may be a leaf
+        array or an object of leaf arrays (an mcarray). The runs of the ids
+        are found once and the arrays are gathered together, block by block,
+        in parallel.
+ */
+template <typename IndexType>
+static void
+slice_fields_internal(const std::vector<const conduit::Node *> &n_src_values,
+                      const std::vector<IndexType> &ids,
+                      const std::vector<conduit::Node *> &n_dest_values)
+{
+#if defined(CONDUIT_USE_OPENMP)
+    using policy = conduit::execution::OpenMPExec;
+#else
+    using policy = conduit::execution::SerialExec;
+#endif
+    if(n_src_values.size() != n_dest_values.size())
     {
-        auto dest(n_dest_values.as_unsigned_char_array());
-        typed_slice_array(n_src_values.as_unsigned_char_array(), ids, dest);
+        CONDUIT_ERROR("slice_fields: the numbers of sources and destinations differ.");
     }
-    else if(dt.is_unsigned_short())
+
+    // Pair up the source and destination leaves. Destinations that share
+    // data with their sources are sliced into temporaries and moved after.
+    const index_t n = static_cast<index_t>(ids.size());
+    std::vector<const conduit::Node *> src_leaves;
+    std::vector<conduit::Node *> dest_leaves;
+    std::deque<conduit::Node> temps;
+    std::vector<std::pair<conduit::Node *, conduit::Node *>> moves;
+    const auto add_leaf = [&](const conduit::Node &src, conduit::Node &dest)
     {
-        auto dest(n_dest_values.as_unsigned_short_array());
-        typed_slice_array(n_src_values.as_unsigned_short_array(), ids, dest);
-    }
-    else if(dt.is_unsigned_int())
+        conduit::Node *target = &dest;
+        if(same_nodes(src, dest))
+        {
+            temps.emplace_back();
+            target = &temps.back();
+            moves.push_back(std::make_pair(&dest, target));
+        }
+        target->set(DataType(src.dtype().id(), n));
+        src_leaves.push_back(&src);
+        dest_leaves.push_back(target);
+    };
+    for(size_t fi = 0; fi < n_src_values.size(); fi++)
     {
-        auto dest(n_dest_values.as_unsigned_int_array());
-        typed_slice_array(n_src_values.as_unsigned_int_array(), ids, dest);
+        const conduit::Node &src = *n_src_values[fi];
+        conduit::Node &dest = *n_dest_values[fi];
+        if(src.number_of_children() > 0)
+        {
+            for(conduit::index_t ci = 0; ci < src.number_of_children(); ci++)
+            {
+                const conduit::Node &comp = src[ci];
+                add_leaf(comp, dest[comp.name()]);
+            }
+        }
+        else
+        {
+            add_leaf(src, dest);
+        }
     }
-    else if(dt.is_unsigned_long())
+
+    std::vector<SliceRun> runs;
+    make_slice_runs(ids, runs);
+
+    // Runs do not span blocks, so find the first run of each block.
+    const index_t nruns = static_cast<index_t>(runs.size());
+    const index_t nblocks = (n + SLICE_BLOCK_SIZE - 1) / SLICE_BLOCK_SIZE;
+    std::vector<index_t> block_runs(nblocks + 1, nruns);
+    for(index_t r = nruns - 1; r >= 0; r--)
     {
-        auto dest(n_dest_values.as_unsigned_long_array());
-        typed_slice_array(n_src_values.as_unsigned_long_array(), ids, dest);
+        block_runs[runs[r].dst / SLICE_BLOCK_SIZE] = r;
     }
-    else if(dt.is_float())
+
+    const index_t nleaves = static_cast<index_t>(src_leaves.size());
+    conduit::execution::for_all<policy>(0, nblocks, [&](index_t b)
     {
-        auto dest(n_dest_values.as_float_array());
-        typed_slice_array(n_src_values.as_float_array(), ids, dest);
-    }
-    else if(dt.is_double())
+        const index_t first = block_runs[b];
+        const index_t count = block_runs[b + 1] - first;
+        for(index_t li = 0; li < nleaves; li++)
+        {
+            const conduit::Node &src = *src_leaves[li];
+            const DataType &dt = src.dtype();
+            if(dt.number_of_elements() == 0)
+                continue;
+            slice_runs(&runs[first], count,
+                       static_cast<const uint8 *>(src.element_ptr(0)),
+                       dt.stride(), dt.element_bytes(),
+                       static_cast<uint8 *>(dest_leaves[li]->data_ptr()));
+        }
+    });
+
+    for(auto &m : moves)
     {
-        auto dest(n_dest_values.as_double_array());
-        typed_slice_array(n_src_values.as_double_array(), ids, dest);
+        m.first->move(*m.second);
     }
 }
 
 //---------------------------------------------------------------------------
-bool same_nodes(const conduit::Node &n1, const conduit::Node &n2)
+template <typename IndexType>
+static void
+slice_array_internal(const conduit::Node &n_src_values,
+                     const std::vector<IndexType> &ids,
+                     Node &n_dest_values)
 {
-   return (&n1 == &n2) ||
-          (n1.contiguous_data_ptr() != nullptr &&
-           n1.contiguous_data_ptr() == n2.contiguous_data_ptr());
+    const std::vector<const conduit::Node *> srcs{&n_src_values};
+    const std::vector<conduit::Node *> dests{&n_dest_values};
+    slice_fields_internal(srcs, ids, dests);
 }
 
 //---------------------------------------------------------------------------
@@ -491,18 +587,7 @@ slice_array(const conduit::Node &n_src_values,
             const std::vector<int> &ids,
             conduit::Node &n_dest_values)
 {
-    // Check whether the src and dest nodes are the same. If so, we slice into
-    // a tmp node and move its contents.
-    if(same_nodes(n_src_values, n_dest_values))
-    {
-        conduit::Node tmp;
-        slice_array_internal(n_src_values, ids, tmp);
-        n_dest_values.move(tmp);
-    }
-    else
-    {
-        slice_array_internal(n_src_values, ids, n_dest_values);
-    }
+    slice_array_internal(n_src_values, ids, n_dest_values);
 }
 
 //---------------------------------------------------------------------------
@@ -511,58 +596,43 @@ slice_array(const conduit::Node &n_src_values,
             const std::vector<conduit::index_t> &ids,
             conduit::Node &n_dest_values)
 {
-    // Check whether the src and dest nodes are the same. If so, we slice into
-    // a tmp node and move its contents.
-    if(same_nodes(n_src_values, n_dest_values))
-    {
-        conduit::Node tmp;
-        slice_array_internal(n_src_values, ids, tmp);
-        n_dest_values.move(tmp);
-    }
-    else
-    {
-        slice_array_internal(n_src_values, ids, n_dest_values);
-    }
+    slice_array_internal(n_src_values, ids, n_dest_values);
 }
 
 //---------------------------------------------------------------------------
-template <typename IndexType>
 void
-slice_field_internal(const conduit::Node &n_src_values,
-                     const std::vector<IndexType> &ids,
-                     conduit::Node &n_dest_values)
+slice_field(const conduit::Node &n_src_values,
+            const std::vector<int> &ids,
+            conduit::Node &n_dest_values)
 {
-    if(n_src_values.number_of_children() > 0)
-    {
-        // Reorder an mcarray
-        for(conduit::index_t ci = 0; ci < n_src_values.number_of_children(); ci++)
-        {
-            const conduit::Node &comp = n_src_values[ci];
-            slice_array(comp, ids, n_dest_values[comp.name()]);
-        }
-    }
-    else
-    {
-        slice_array(n_src_values, ids, n_dest_values);
-    }
+    slice_array_internal(n_src_values, ids, n_dest_values);
 }
 
 //---------------------------------------------------------------------------
 void
 slice_field(const conduit::Node &n_src_values,
-            const std::vector<int> &ids,
+            const std::vector<conduit::index_t> &ids,
             conduit::Node &n_dest_values)
 {
-    slice_field_internal(n_src_values, ids, n_dest_values);
+    slice_array_internal(n_src_values, ids, n_dest_values);
 }
 
 //---------------------------------------------------------------------------
 void
-slice_field(const conduit::Node &n_src_values,
-            const std::vector<conduit::index_t> &ids,
-            conduit::Node &n_dest_values)
+slice_fields(const std::vector<const conduit::Node *> &n_src_values,
+             const std::vector<int> &ids,
+             const std::vector<conduit::Node *> &n_dest_values)
 {
-    slice_field_internal(n_src_values, ids, n_dest_values);
+    slice_fields_internal(n_src_values, ids, n_dest_values);
+}
+
+//---------------------------------------------------------------------------
+void
+slice_fields(const std::vector<const conduit::Node *> &n_src_values,
+             const std::vector<conduit::index_t> &ids,
+             const std::vector<conduit::Node *> &n_dest_values)
+{
+    slice_fields_internal(n_src_values, ids, n_dest_values);
 }
 
 //---------------------------------------------------------------------------
@@ -620,6 +690,47 @@ convert(conduit::Node &root,
     }
 }
 
+//---------------------------------------------------------------------------
+void
+for_all_domains(index_t n, const std::function<void(index_t)> &func)
+{
+#if defined(CONDUIT_USE_OPENMP)
+    if(n > 1 && n >= static_cast<index_t>(omp_get_max_threads()))
+    {
+        // Errors must not escape the parallel region. Save them per item
+        // and raise the first one once all of the items are done.
+        std::vector<std::string> errors(static_cast<size_t>(n));
+        conduit::execution::for_all<conduit::execution::OpenMPExec>(0, n, [&](index_t i)
+        {
+            try
+            {
+                func(i);
+            }
+            catch(conduit::Error &e)
+            {
+                errors[i] = e.message();
+            }
+            catch(std::exception &e)
+            {
+                errors[i] = e.what();
+            }
+        });
+        for(const auto &err : errors)
+        {
+            if(!err.empty())
+            {
+                CONDUIT_ERROR(err);
+            }
+        }
+        return;
+    }
+#endif
+    for(index_t i = 0; i < n; i++)
+    {
+        func(i);
+    }
+}
+
 //-----------------------------------------------------------------------------
 // -- begin conduit::blueprint::mesh::utils::connectivity --
 //-----------------------------------------------------------------------------
@@ -1905,6 +2016,132 @@ static void HilbertSort3D(int coord1, bool dir1, bool dir2, bool dir3,
    }
 }
 
+//-----------------------------------------------------------------------------
+/**
+ @brief Entities stored in canonical form: each entity's point ids are sorted
+        so entities that use the same points compare equal regardless of
+        their winding. A hash is kept for each entity.
+ */
+struct CanonicalEntities
+{
+    std::vector<index_t> ids;
+    std::vector<index_t> offsets; // nentities + 1
+    std::vector<uint64>  hashes;
+    std::vector<int>     valid;   // 0 if a point could not be mapped
+
+    index_t size() const { return static_cast<index_t>(hashes.size()); }
+
+    bool equal(index_t i, const CanonicalEntities &other, index_t j) const
+    {
+        const index_t n = offsets[i + 1] - offsets[i];
+        return n == (other.offsets[j + 1] - other.offsets[j]) &&
+               std::equal(ids.begin() + offsets[i],
+                          ids.begin() + offsets[i] + n,
+                          other.ids.begin() + other.offsets[j]);
+    }
+};
+
+//-----------------------------------------------------------------------------
+/**
+ @brief Builds canonical entities for an unstructured topology's elements.
+
+ @param topo The topology.
+ @param map_point A function that maps a topology point id to the id that
+                  will be stored, or returns -1 if the point can not be mapped.
+ @param[out] ents The canonical entities.
+ */
+template <typename MapFunc>
+static void
+canonical_entities(const conduit::Node &topo, MapFunc &&map_point,
+                   CanonicalEntities &ents)
+{
+#if defined(CONDUIT_USE_OPENMP)
+    using policy = conduit::execution::OpenMPExec;
+#else
+    using policy = conduit::execution::SerialExec;
+#endif
+    auto conn = topo["elements/connectivity"].as_index_t_accessor();
+    auto sizes = topo["elements/sizes"].as_index_t_accessor();
+    const index_t nelem = sizes.number_of_elements();
+
+    ents.offsets.resize(nelem + 1);
+    ents.offsets[0] = 0;
+    for(index_t i = 0; i < nelem; i++)
+        ents.offsets[i + 1] = ents.offsets[i] + sizes[i];
+    ents.ids.resize(ents.offsets[nelem]);
+    ents.hashes.resize(nelem);
+    ents.valid.resize(nelem);
+
+    conduit::execution::for_all<policy>(0, nelem, [&](index_t i)
+    {
+        const index_t start = ents.offsets[i];
+        const index_t end = ents.offsets[i + 1];
+        int valid = 1;
+        for(index_t pi = start; pi < end; pi++)
+        {
+            const index_t id = map_point(conn[pi]);
+            valid &= (id >= 0) ? 1 : 0;
+            ents.ids[pi] = id;
+        }
+        std::sort(ents.ids.begin() + start, ents.ids.begin() + end);
+        ents.valid[i] = valid;
+        ents.hashes[i] = (end > start) ?
+            conduit::utils::hash(&ents.ids[start], static_cast<unsigned int>(end - start)) : 0;
+    });
+}
+
+//-----------------------------------------------------------------------------
+/**
+ @brief An open addressing hash table of canonical entities. Lookups compare
+        the full sorted point list so hash collisions can not cause false
+        matches.
+ */
+class EntityHashTable
+{
+public:
+    EntityHashTable(const CanonicalEntities &_ents) : ents(_ents), slots(), mask(0)
+    {
+        size_t capacity = 16;
+        while(capacity < 2 * static_cast<size_t>(ents.size()))
+            capacity <<= 1;
+        slots.resize(capacity, -1);
+        mask = capacity - 1;
+
+        for(index_t i = 0; i < ents.size(); i++)
+        {
+            if(!ents.valid[i] || find(ents, i) >= 0)
+                continue;
+            size_t s = static_cast<size_t>(ents.hashes[i]) & mask;
+            while(slots[s] >= 0)
+                s = (s + 1) & mask;
+            slots[s] = i;
+        }
+    }
+
+    /**
+     @brief Look up entity \a qi from \a query in the table.
+     @return The index of the matching entity or -1 if there is no match.
+     */
+    index_t find(const CanonicalEntities &query, index_t qi) const
+    {
+        const uint64 h = query.hashes[qi];
+        size_t s = static_cast<size_t>(h) & mask;
+        while(slots[s] >= 0)
+        {
+            const index_t ei = slots[s];
+            if(ents.hashes[ei] == h && ents.equal(ei, query, qi))
+                return ei;
+            s = (s + 1) & mask;
+        }
+        return -1;
+    }
+
+private:
+    const CanonicalEntities &ents;
+    std::vector<index_t>     slots;
+    size_t                   mask;
+};
+
 }
 //-----------------------------------------------------------------------------
 // -- end conduit::blueprint::mesh::utils::detail --
@@ -1977,14 +2214,14 @@ topology::hilbert_ordering(const conduit::Node &topo)
 
 //---------------------------------------------------------------------------
 topology::TopologyBuilder::TopologyBuilder(const conduit::Node &_topo) : topo(_topo),
-    old_to_new(), topo_conn(), topo_sizes()
+    old_to_new(), new_to_old(), topo_conn(), topo_sizes()
 {
 
 }
 
 //---------------------------------------------------------------------------
 topology::TopologyBuilder::TopologyBuilder(const conduit::Node *_topo) : topo(*_topo),
-    old_to_new(), topo_conn(), topo_sizes()
+    old_to_new(), new_to_old(), topo_conn(), topo_sizes()
 {
     
 }
@@ -1993,16 +2230,23 @@ topology::TopologyBuilder::TopologyBuilder(const conduit::Node *_topo) : topo(*_
 index_t
 topology::TopologyBuilder::newPointId(index_t oldPointId)
 {
-    auto it = old_to_new.find(oldPointId);
-    index_t newpt;
-    if(it == old_to_new.end())
+    if(static_cast<size_t>(oldPointId) >= old_to_new.size())
     {
-        newpt = old_to_new.size();
-        old_to_new[oldPointId] = newpt;
+        // The first time through, size the map for the whole coordset so
+        // lookups are just array accesses. Grow it if an id is out of range.
+        size_t n = old_to_new.empty() ?
+            static_cast<size_t>(coordset::length(coordset(topo))) :
+            2 * old_to_new.size();
+        n = std::max(n, static_cast<size_t>(oldPointId + 1));
+        old_to_new.resize(n, -1);
     }
-    else
+
+    index_t newpt = old_to_new[oldPointId];
+    if(newpt < 0)
     {
-        newpt = it->second;
+        newpt = static_cast<index_t>(new_to_old.size());
+        old_to_new[oldPointId] = newpt;
+        new_to_old.push_back(oldPointId);
     }
     return newpt;
 }
@@ -2048,7 +2292,13 @@ topology::TopologyBuilder::execute(conduit::Node &n_out, const std::string &shap
     // Iterate over the selected original points and make a new coordset
     newcset["type"] = "explicit";
     auto axes = coordset::axes(origcset);
-    auto npts = static_cast<index_t>(old_to_new.size());
+    auto npts = static_cast<index_t>(new_to_old.size());
+    const index_t *new_to_old_ptr = new_to_old.data();
+#if defined(CONDUIT_USE_OPENMP)
+    using policy = conduit::execution::OpenMPExec;
+#else
+    using policy = conduit::execution::SerialExec;
+#endif
     for(const auto &axis : axes)
     {
         std::string key("values/" + axis);
@@ -2057,10 +2307,10 @@ topology::TopologyBuilder::execute(conduit::Node &n_out, const std::string &shap
         conduit::Node &coords = newcset[key];
         coords.set(DataType::float64(npts));
         auto coords_ptr = static_cast<double *>(coords.element_ptr(0));
-        for(auto it = old_to_new.begin(); it != old_to_new.end(); it++)
+        conduit::execution::for_all<policy>(0, npts, [&](conduit::index_t i)
         {
-            coords_ptr[it->second] = acc[it->first];
-        }
+            coords_ptr[i] = acc[new_to_old_ptr[i]];
+        });
     }
 
     // Fill in the topo information.
@@ -2080,6 +2330,7 @@ void
 topology::TopologyBuilder::clear()
 {
     old_to_new.clear();
+    new_to_old.clear();
     topo_conn.clear();
     topo_sizes.clear();
 }
@@ -2123,75 +2374,38 @@ topology::search(const conduit::Node &topo1, const conduit::Node &topo2)
     // Do the query.
     P.execute(cset2.name());
 
-    const conduit::Node &n_topo1_conn = topo1["elements/connectivity"];
-    const conduit::Node &n_topo1_size = topo1["elements/sizes"];
-    auto topo1_conn = n_topo1_conn.as_index_t_accessor();
-    auto topo1_size = n_topo1_size.as_index_t_accessor();
-
-    // Iterate over the entities in mesh1 and make hash ids for the entities
-    // by hashing their sorted points.
-    index_t nelem = topo1_size.dtype().number_of_elements();
-    std::map<uint64, index_t> topo1_entity_ids;
-    index_t idx = 0;
-    for(index_t i = 0; i < nelem; i++)
-    {
-        std::vector<index_t> ids;
-        index_t s = topo1_size[i];
-        for(index_t pi = 0; pi < s; pi++)
-            ids.push_back(topo1_conn[idx++]);
-        std::sort(ids.begin(), ids.end());
-        uint64 h = conduit::utils::hash(&ids[0], static_cast<unsigned int>(ids.size()));
-        topo1_entity_ids[h] = i;
-    }
+    // Make canonical (sorted point) entities for topo1 and put them in a
+    // hash table.
+    detail::CanonicalEntities ents1;
+    detail::canonical_entities(topo1, [](index_t pt) { return pt; }, ents1);
+    detail::EntityHashTable table(ents1);
 
     // Get the query results for each mesh2 point. This is a vector of point
     // ids from mesh 1 or NotFound.
     const auto &r = P.results(domain_id);
+    const int NotFound = P.NotFound;
 
-    // Iterate over the entities in mesh2 and map their points to mesh 1 points
-    // if possible before computing hashids for them. If a mesh2 entity's points
-    // can all be defined in mesh1 then the entity exists in both meshes.
-    const conduit::Node &n_topo2_conn = topo2["elements/connectivity"];
-    const conduit::Node &n_topo2_size = topo2["elements/sizes"];
-    auto topo2_conn = n_topo2_conn.as_index_t_accessor();
-    auto topo2_size = n_topo2_size.as_index_t_accessor();
-
-    index_t nelem2 = topo2_size.dtype().number_of_elements();
-    std::map<uint64, index_t> topo2_entity_ids;
-    idx = 0;
-    std::vector<int> exists;
-    exists.reserve(nelem2);
-    std::vector<index_t> ids;
-    ids.reserve(10);
-    for(index_t i = 0; i < nelem2; i++)
+    // Map the topo2 entities' points to mesh1 points if possible. If a mesh2
+    // entity's points can all be defined in mesh1 then look for the entity
+    // in topo1.
+    detail::CanonicalEntities ents2;
+    detail::canonical_entities(topo2, [&](index_t pt) -> index_t
     {
-        index_t s = topo2_size[i];
-
-        // Try and map all of the topo2 entity's points to topo1's coordset.
-        // If we can do that then the entity may exist.
-        bool badEntity = false;
-        ids.clear();
-        for(index_t pi = 0; pi < s; pi++)
-        {
-            index_t pt = topo2_conn[idx++];
-            // See if the point exists in mesh1.
-            badEntity |= (r[pt] == P.NotFound);
-            ids.push_back(r[pt]);
-        }
-
-        if(badEntity)
-            exists.push_back(0);
-        else
-        {
-            // The entity can be defined in terms of topo1's coordset. Make a
-            // hash id for it and see if it matches any entities in topo1.
-            std::sort(ids.begin(), ids.end());
-            uint64 h = conduit::utils::hash(&ids[0], static_cast<unsigned int>(ids.size()));
+        return (r[pt] == NotFound) ? -1 : static_cast<index_t>(r[pt]);
+    }, ents2);
 
-            bool found = topo1_entity_ids.find(h) != topo1_entity_ids.end();
-            exists.push_back(found ? 1 : 0);
-        }
-    }
+#if defined(CONDUIT_USE_OPENMP)
+    using policy = conduit::execution::OpenMPExec;
+#else
+    using policy = conduit::execution::SerialExec;
+#endif
+    const index_t nelem2 = ents2.size();
+    std::vector<int> exists(nelem2, 0);
+    conduit::execution::for_all<policy>(0, nelem2, [&](index_t i)
+    {
+        if(ents2.valid[i])
+            exists[i] = (table.find(ents2, i) >= 0) ? 1 : 0;
+    });
 
     return exists;
 }
@@ -3135,7 +3349,270 @@ PointQueryBase::queryDomainIds() const
 const int PointQuery::SEARCH_THRESHOLD = 25 * 25 * 25;
 
 //---------------------------------------------------------------------------
-PointQuery::PointQuery(const conduit::Node &mesh) : PointQueryBase(mesh)
+/**
+ @brief Base class for spatial indices that accelerate point lookups in a
+        coordset. An index remembers the coordinate data pointers it was
+        built from so a cached index can be checked against a coordset.
+ */
+class SpatialIndex
+{
+public:
+    SpatialIndex() : m_ndims(0), m_npts(0), m_dataPtrs{nullptr, nullptr, nullptr}
+    {
+    }
+
+    virtual ~SpatialIndex() = default;
+
+    /// Set the distance under which points are the same.
+    virtual void setPointTolerance(double tolerance) = 0;
+
+    /// Return the point id for pt or PointQuery::NotFound.
+    virtual int findPoint(const double pt[3]) const = 0;
+
+    /// Record the coordinates that the index was built from.
+    void setSource(int ndims, const conduit::Node *coords[3])
+    {
+        m_ndims = ndims;
+        m_npts = coords[0]->dtype().number_of_elements();
+        for(int i = 0; i < 3; i++)
+        {
+            m_dataPtrs[i] = (i < ndims && m_npts > 0) ?
+                coords[i]->element_ptr(0) : nullptr;
+        }
+    }
+
+    /// Return whether the index was built from these coordinates.
+    bool sameSource(int ndims, const conduit::Node *coords[3]) const
+    {
+        if(ndims != m_ndims ||
+           coords[0]->dtype().number_of_elements() != m_npts)
+            return false;
+        for(int i = 0; i < ndims; i++)
+        {
+            const void *ptr = (m_npts > 0) ? coords[i]->element_ptr(0) : nullptr;
+            if(ptr != m_dataPtrs[i])
+                return false;
+        }
+        return true;
+    }
+
+private:
+    int               m_ndims;
+    conduit::index_t  m_npts;
+    const void       *m_dataPtrs[3];
+};
+
+//---------------------------------------------------------------------------
+/**
+ @brief A spatial index that uses a kdtree.
+ */
+template <typename ArrayType, typename CoordType, int NDIMS>
+class KDTreeSpatialIndex : public SpatialIndex
+{
+public:
+    KDTreeSpatialIndex(const conduit::Node *coords[3]) : SpatialIndex(), m_tree()
+    {
+        ArrayType typedCoords[NDIMS];
+        for(int i = 0; i < NDIMS; i++)
+            typedCoords[i] = ArrayType(const_cast<void *>(coords[i]->data_ptr()),
+                                       coords[i]->dtype());
+        m_tree.initialize(typedCoords, coords[0]->dtype().number_of_elements());
+    }
+
+    virtual void setPointTolerance(double tolerance) override
+    {
+        m_tree.setPointTolerance(static_cast<CoordType>(tolerance));
+    }
+
+    virtual int findPoint(const double pt[3]) const override
+    {
+        CoordType searchPt[NDIMS];
+        for(int i = 0; i < NDIMS; i++)
+            searchPt[i] = static_cast<CoordType>(pt[i]);
+        auto found = m_tree.findPoint(searchPt);
+        return (found != m_tree.NotFound) ? static_cast<int>(found) : PointQuery::NotFound;
+    }
+
+private:
+    conduit::blueprint::mesh::utils::kdtree<ArrayType, CoordType, NDIMS> m_tree;
+};
+
+//---------------------------------------------------------------------------
+/**
+ @brief A spatial index that bins points into a uniform grid sized so there
+        is about one point per cell. Lookups only visit the cells within the
+        point tolerance of the search point. This works well for points that
+        are spread evenly, such as most mesh coordsets, and it supports any
+        coordinate type and dimension.
+ */
+class UniformGridSpatialIndex : public SpatialIndex
+{
+public:
+    UniformGridSpatialIndex(int ndims, const conduit::Node *coords[3])
+        : SpatialIndex(), m_ndims(ndims), m_tolerance(0.), m_tolerance2(0.),
+          m_points(), m_cellOffsets(), m_cellPoints()
+    {
+        for(int d = 0; d < 3; d++)
+        {
+            m_origin[d] = 0.;
+            m_invCellSize[d] = 0.;
+            m_dims[d] = 1;
+        }
+        build(coords);
+    }
+
+    virtual void setPointTolerance(double tolerance) override
+    {
+        m_tolerance = tolerance;
+        m_tolerance2 = tolerance * tolerance;
+    }
+
+    virtual int findPoint(const double pt[3]) const override
+    {
+        conduit::index_t lo[3] = {0, 0, 0}, hi[3] = {0, 0, 0};
+        for(int d = 0; d < m_ndims; d++)
+        {
+            const double a = (pt[d] - m_tolerance - m_origin[d]) * m_invCellSize[d];
+            const double b = (pt[d] + m_tolerance - m_origin[d]) * m_invCellSize[d];
+            if(b < 0. || a >= static_cast<double>(m_dims[d]))
+                return PointQuery::NotFound;
+            lo[d] = std::max(static_cast<conduit::index_t>(a), conduit::index_t(0));
+            hi[d] = std::min(static_cast<conduit::index_t>(b), m_dims[d] - 1);
+        }
+
+        // Return the lowest matching point id, like a brute force search.
+        int found = PointQuery::NotFound;
+        for(conduit::index_t k = lo[2]; k <= hi[2]; k++)
+        for(conduit::index_t j = lo[1]; j <= hi[1]; j++)
+        for(conduit::index_t i = lo[0]; i <= hi[0]; i++)
+        {
+            const conduit::index_t cell = (k * m_dims[1] + j) * m_dims[0] + i;
+            for(conduit::index_t ci = m_cellOffsets[cell]; ci < m_cellOffsets[cell + 1]; ci++)
+            {
+                const conduit::index_t ptid = m_cellPoints[ci];
+                if(found != PointQuery::NotFound && ptid >= found)
+                    break;
+                const double *p = &m_points[ptid * 3];
+                const double dx = p[0] - pt[0];
+                const double dy = p[1] - pt[1];
+                const double dz = p[2] - pt[2];
+                if(dx * dx + dy * dy + dz * dz < m_tolerance2)
+                {
+                    found = static_cast<int>(ptid);
+                    break;
+                }
+            }
+        }
+        return found;
+    }
+
+    /// Return the largest number of points in any cell.
+    conduit::index_t maxCellPoints() const
+    {
+        conduit::index_t n = 0;
+        for(size_t c = 1; c < m_cellOffsets.size(); c++)
+            n = std::max(n, m_cellOffsets[c] - m_cellOffsets[c - 1]);
+        return n;
+    }
+
+private:
+    void build(const conduit::Node *coords[3])
+    {
+#if defined(CONDUIT_USE_OPENMP)
+        using policy = conduit::execution::OpenMPExec;
+#else
+        using policy = conduit::execution::SerialExec;
+#endif
+        const conduit::index_t npts = coords[0]->dtype().number_of_elements();
+
+        // Copy the points so lookups do not need to convert types.
+        m_points.resize(npts * 3, 0.);
+        double *points = m_points.data();
+        for(int d = 0; d < m_ndims; d++)
+        {
+            const auto acc = coords[d]->as_double_accessor();
+            conduit::execution::for_all<policy>(0, npts, [&](conduit::index_t i)
+            {
+                points[i * 3 + d] = acc[i];
+            });
+        }
+
+        // Size the cells for about one point per cell.
+        double extents[3] = {0., 0., 0.};
+        int nonzero = 0;
+        double volume = 1.;
+        for(int d = 0; d < m_ndims && npts > 0; d++)
+        {
+            double mn = points[d], mx = points[d];
+            for(conduit::index_t i = 1; i < npts; i++)
+            {
+                mn = std::min(mn, points[i * 3 + d]);
+                mx = std::max(mx, points[i * 3 + d]);
+            }
+            m_origin[d] = mn;
+            extents[d] = mx - mn;
+            if(extents[d] > 0.)
+            {
+                volume *= extents[d];
+                nonzero++;
+            }
+        }
+        const double cellSize = (nonzero > 0) ?
+            std::pow(volume / static_cast<double>(std::max(npts, conduit::index_t(1))),
+                     1. / static_cast<double>(nonzero)) : 1.;
+        for(int d = 0; d < m_ndims; d++)
+        {
+            if(extents[d] > 0. && cellSize > 0.)
+            {
+                m_dims[d] = std::max(conduit::index_t(1),
+                    std::min(static_cast<conduit::index_t>(extents[d] / cellSize),
+                             std::max(npts, conduit::index_t(1))));
+                m_invCellSize[d] = static_cast<double>(m_dims[d]) / extents[d];
+                // Keep the max coordinate inside the last cell.
+                m_invCellSize[d] *= (1. - 1.e-12);
+            }
+        }
+
+        // Bin the points (counting sort, stable so each cell is in id order).
+        const conduit::index_t ncells = m_dims[0] * m_dims[1] * m_dims[2];
+        std::vector<conduit::index_t> pointCells(npts);
+        conduit::index_t *pc = pointCells.data();
+        conduit::execution::for_all<policy>(0, npts, [&](conduit::index_t i)
+        {
+            conduit::index_t ijk[3] = {0, 0, 0};
+            for(int d = 0; d < m_ndims; d++)
+            {
+                const double v = (points[i * 3 + d] - m_origin[d]) * m_invCellSize[d];
+                ijk[d] = std::min(std::max(static_cast<conduit::index_t>(v), conduit::index_t(0)),
+                                  m_dims[d] - 1);
+            }
+            pc[i] = (ijk[2] * m_dims[1] + ijk[1]) * m_dims[0] + ijk[0];
+        });
+        m_cellOffsets.assign(ncells + 1, 0);
+        for(conduit::index_t i = 0; i < npts; i++)
+            m_cellOffsets[pc[i] + 1]++;
+        for(conduit::index_t c = 0; c < ncells; c++)
+            m_cellOffsets[c + 1] += m_cellOffsets[c];
+        std::vector<conduit::index_t> next(m_cellOffsets.begin(), m_cellOffsets.end() - 1);
+        m_cellPoints.resize(npts);
+        for(conduit::index_t i = 0; i < npts; i++)
+            m_cellPoints[next[pc[i]]++] = i;
+    }
+
+    int                           m_ndims;
+    double                        m_origin[3];
+    double                        m_invCellSize[3];
+    conduit::index_t              m_dims[3];
+    double                        m_tolerance;
+    double                        m_tolerance2;
+    std::vector<double>           m_points;
+    std::vector<conduit::index_t> m_cellOffsets;
+    std::vector<conduit::index_t> m_cellPoints;
+};
+
+//---------------------------------------------------------------------------
+PointQuery::PointQuery(const conduit::Node &mesh) : PointQueryBase(mesh),
+    m_pointTolerance(0.), m_searchMethod(SEARCH_AUTO), m_indexCache()
 {
     constexpr double DEFAULT_POINT_TOLERANCE = 1.e-9;
     setPointTolerance(DEFAULT_POINT_TOLERANCE);
@@ -3148,12 +3625,54 @@ PointQuery::setPointTolerance(double tolerance)
     m_pointTolerance = tolerance;
 }
 
+//---------------------------------------------------------------------------
+void
+PointQuery::setSearchMethod(SearchMethod method)
+{
+    if(method != m_searchMethod)
+    {
+        m_searchMethod = method;
+        invalidateCache();
+    }
+}
+
+//---------------------------------------------------------------------------
+PointQuery::SearchMethod
+PointQuery::getSearchMethod() const
+{
+    return m_searchMethod;
+}
+
+//---------------------------------------------------------------------------
+void
+PointQuery::invalidateCache()
+{
+    m_indexCache.clear();
+}
+
+//---------------------------------------------------------------------------
+void
+PointQuery::invalidateCache(const conduit::Node &coordset)
+{
+    m_indexCache.erase(&coordset);
+}
+
 //---------------------------------------------------------------------------
 void
 PointQuery::execute(const std::string &coordsetName)
 {
     CONDUIT_ANNOTATE_MARK_FUNCTION;
 
+    // Make sure each domain's spatial index is ready. Domains that are
+    // searched directly are handled here too.
+    struct DomainBatch
+    {
+        const double                 *input;
+        int                          *result;
+        std::shared_ptr<SpatialIndex> index;
+    };
+    std::vector<DomainBatch> batches;
+    std::vector<conduit::index_t> batchOffsets(1, 0);
     for(auto it = m_domInputs.begin(); it != m_domInputs.end(); it++)
     {
         const conduit::Node *dom = getDomain(it->first);
@@ -3164,8 +3683,54 @@ PointQuery::execute(const std::string &coordsetName)
 
         const std::vector<double> &input = it->second;
         std::vector<int> &result = m_domResults[it->first];
-        findPointsInDomain(*dom, coordsetName, input, result);
+        const conduit::index_t numInputPts = input.size() / 3;
+        result.resize(numInputPts, NotFound);
+        if(numInputPts == 0)
+            continue;
+
+        const conduit::Node &cset = dom->fetch_existing("coordsets/" + coordsetName);
+        const conduit::Node *coords[3] = {nullptr, nullptr, nullptr};
+        conduit::index_t coordTypes[3];
+        int ndims = 0;
+        bool sameTypes = true;
+        const conduit::Node &cvals = cset.fetch_existing("values");
+        for(const std::string &axis : coordset::axes(cset))
+        {
+            coords[ndims] = cvals.fetch_ptr(axis);
+            coordTypes[ndims] = coords[ndims]->dtype().id();
+            sameTypes &= (coordTypes[0] == coordTypes[ndims]);
+            ndims++;
+        }
+
+        auto index = (coords[0] != nullptr) ?
+            spatialIndex(ndims, sameTypes, coords, coordTypes) : nullptr;
+        if(index)
+        {
+            batches.push_back(DomainBatch{input.data(), result.data(), index});
+            batchOffsets.push_back(batchOffsets.back() + numInputPts);
+        }
+        else
+        {
+            findPointsInDomain(*dom, coordsetName, input, result);
+        }
     }
+
+    // Search the points for all indexed domains in a single parallel loop.
+#if defined(CONDUIT_USE_OPENMP)
+    using policy = conduit::execution::OpenMPExec;
+#else
+    using policy = conduit::execution::SerialExec;
+#endif
+    const DomainBatch *batchPtr = batches.data();
+    const conduit::index_t *offsetPtr = batchOffsets.data();
+    const conduit::index_t nbatches = static_cast<conduit::index_t>(batches.size());
+    conduit::execution::for_all<policy>(0, batchOffsets.back(), [&](conduit::index_t i)
+    {
+        const conduit::index_t b = static_cast<conduit::index_t>(
+            std::upper_bound(offsetPtr, offsetPtr + nbatches + 1, i) - offsetPtr) - 1;
+        const conduit::index_t pi = i - offsetPtr[b];
+        batchPtr[b].result[pi] = batchPtr[b].index->findPoint(&batchPtr[b].input[pi * 3]);
+    });
 }
 
 //---------------------------------------------------------------------------
@@ -3233,6 +3798,67 @@ PointQuery::findPointsInDomain(const conduit::Node &mesh,
     }
 }
 
+//---------------------------------------------------------------------------
+std::shared_ptr<SpatialIndex>
+PointQuery::spatialIndex(int ndims,
+    bool sameTypes,
+    const conduit::Node *coords[3],
+    const conduit::index_t coordTypes[3]) const
+{
+    conduit::index_t numCoordsetPts = coords[0]->dtype().number_of_elements();
+    if(ndims < 1 || ndims > 3 ||
+       (m_searchMethod == SEARCH_AUTO && numCoordsetPts < SEARCH_THRESHOLD))
+    {
+        return nullptr;
+    }
+
+    // Key the cache on the coordset node.
+    const conduit::Node *key = coords[0]->parent();
+    if(key != nullptr && key->parent() != nullptr)
+        key = key->parent();
+
+    std::shared_ptr<SpatialIndex> index;
+    auto it = m_indexCache.find(key);
+    if(it != m_indexCache.end() && it->second->sameSource(ndims, coords))
+    {
+        index = it->second;
+    }
+    else
+    {
+        const bool kdtreeTypes = sameTypes && ndims > 1 &&
+            (coordTypes[0] == conduit::DataType::FLOAT64_ID ||
+             coordTypes[0] == conduit::DataType::FLOAT32_ID);
+        bool useKDTree = (m_searchMethod == SEARCH_KDTREE) && kdtreeTypes;
+        if(m_searchMethod != SEARCH_KDTREE || !kdtreeTypes)
+        {
+            auto grid = std::make_shared<UniformGridSpatialIndex>(ndims, coords);
+            // Clustered points make some cells too full. Use a kdtree then.
+            const conduit::index_t MAX_CELL_POINTS = 32;
+            if(m_searchMethod == SEARCH_AUTO && kdtreeTypes &&
+               grid->maxCellPoints() > MAX_CELL_POINTS)
+                useKDTree = true;
+            else
+                index = grid;
+        }
+
+        if(useKDTree)
+        {
+            if(ndims == 3 && coordTypes[0] == conduit::DataType::FLOAT64_ID)
+                index = std::make_shared<KDTreeSpatialIndex<float64_array, float64, 3>>(coords);
+            else if(ndims == 3)
+                index = std::make_shared<KDTreeSpatialIndex<float32_array, float32, 3>>(coords);
+            else if(coordTypes[0] == conduit::DataType::FLOAT64_ID)
+                index = std::make_shared<KDTreeSpatialIndex<float64_array, float64, 2>>(coords);
+            else
+                index = std::make_shared<KDTreeSpatialIndex<float32_array, float32, 2>>(coords);
+        }
+        index->setSource(ndims, coords);
+        m_indexCache[key] = index;
+    }
+    index->setPointTolerance(m_pointTolerance);
+    return index;
+}
+
 //---------------------------------------------------------------------------
 bool
 PointQuery::acceleratedSearch(int ndims,
@@ -3243,110 +3869,25 @@ PointQuery::acceleratedSearch(int ndims,
     std::vector<int> &result) const
 {
     CONDUIT_ANNOTATE_MARK_FUNCTION;
-    bool handled = false;
+    auto index = spatialIndex(ndims, sameTypes, coords, coordTypes);
+    if(!index)
+        return false;
 
     conduit::index_t numInputPts = input.size() / 3;
-    const double *input_ptr = &input[0];
-    int *result_ptr = &result[0];
-    conduit::index_t numCoordsetPts = coords[0]->dtype().number_of_elements();
+    const double *input_ptr = input.data();
+    int *result_ptr = result.data();
+    const SpatialIndex *search = index.get();
 
 #if defined(CONDUIT_USE_OPENMP)
     using policy = conduit::execution::OpenMPExec;
 #else
     using policy = conduit::execution::SerialExec;
 #endif
-
-    // Special case a few large searches where the types are the same.
-    if(ndims == 3 &&
-       sameTypes &&
-       numCoordsetPts >= SEARCH_THRESHOLD &&
-       coordTypes[0] == conduit::DataType::FLOAT64_ID)
-    {
-        // 3D points are all doubles.
-        float64_array typedCoords[3];
-        typedCoords[0] = coords[0]->as_float64_array();
-        typedCoords[1] = coords[1]->as_float64_array();
-        typedCoords[2] = coords[2]->as_float64_array();
-        conduit::blueprint::mesh::utils::kdtree<float64_array, float64, 3> search;
-        search.initialize(typedCoords, numCoordsetPts);
-        search.setPointTolerance(m_pointTolerance);
-        conduit::execution::for_all<policy>(0, numInputPts, [&](conduit::index_t i)
-        {
-            float64 searchPt[3] = {static_cast<float64>(input_ptr[i * 3 + 0]),
-                                   static_cast<float64>(input_ptr[i * 3 + 1]),
-                                   static_cast<float64>(input_ptr[i * 3 + 2])};
-            auto found = static_cast<int>(search.findPoint(searchPt));
-            result_ptr[i] = (found != search.NotFound) ? found : NotFound;
-        });
-        handled = true;
-    }
-    else if(ndims == 3 &&
-            sameTypes &&
-            numCoordsetPts >= SEARCH_THRESHOLD &&
-            coordTypes[0] == conduit::DataType::FLOAT32_ID)
-    {
-        // 3D points are all float.
-        float32_array typedCoords[3];
-        typedCoords[0] = coords[0]->as_float32_array();
-        typedCoords[1] = coords[1]->as_float32_array();
-        typedCoords[2] = coords[2]->as_float32_array();
-        conduit::blueprint::mesh::utils::kdtree<float32_array, float32, 3> search;
-        search.initialize(typedCoords, numCoordsetPts);
-        search.setPointTolerance(static_cast<float32>(m_pointTolerance));
-        conduit::execution::for_all<policy>(0, numInputPts, [&](conduit::index_t i)
-        {
-            float32 searchPt[3] = {static_cast<float32>(input_ptr[i * 3 + 0]),
-                                   static_cast<float32>(input_ptr[i * 3 + 1]),
-                                   static_cast<float32>(input_ptr[i * 3 + 2])};
-            auto found = static_cast<int>(search.findPoint(searchPt));
-            result_ptr[i] = (found != search.NotFound) ? found : NotFound;
-        });
-        handled = true;
-    }
-    // Large searches of 2D coordinates.
-    else if(ndims == 2 &&
-            sameTypes &&
-            numCoordsetPts >= SEARCH_THRESHOLD &&
-            coordTypes[0] == conduit::DataType::FLOAT64_ID)
-    {
-        // 2D points are all doubles.
-        float64_array typedCoords[2];
-        typedCoords[0] = coords[0]->as_float64_array();
-        typedCoords[1] = coords[1]->as_float64_array();
-        conduit::blueprint::mesh::utils::kdtree<float64_array, float64, 2> search;
-        search.initialize(typedCoords, numCoordsetPts);
-        search.setPointTolerance(m_pointTolerance);
-        conduit::execution::for_all<policy>(0, numInputPts, [&](conduit::index_t i)
-        {
-            float64 searchPt[2] = {static_cast<float64>(input_ptr[i * 3 + 0]),
-                                   static_cast<float64>(input_ptr[i * 3 + 1])};
-            auto found = static_cast<int>(search.findPoint(searchPt));
-            result_ptr[i] = (found != search.NotFound) ? found : NotFound;
-        });
-        handled = true;
-    }
-    else if(ndims == 2 &&
-            sameTypes &&
-            numCoordsetPts >= SEARCH_THRESHOLD &&
-            coordTypes[0] == conduit::DataType::FLOAT32_ID)
-    {
-        // 2D points are all float.
-        float32_array typedCoords[2];
-        typedCoords[0] = coords[0]->as_float32_array();
-        typedCoords[1] = coords[1]->as_float32_array();
-        conduit::blueprint::mesh::utils::kdtree<float32_array, float32, 2> search;
-        search.initialize(typedCoords, numCoordsetPts);
-        search.setPointTolerance(static_cast<float32>(m_pointTolerance));
-        conduit::execution::for_all<policy>(0, numInputPts, [&](conduit::index_t i)
-        {
-            float32 searchPt[2] = {static_cast<float32>(input_ptr[i * 3 + 0]),
-                                   static_cast<float32>(input_ptr[i * 3 + 1])};
-            auto found = static_cast<int>(search.findPoint(searchPt));
-            result_ptr[i] = (found != search.NotFound) ? found : NotFound;
-        });
-        handled = true;
-    }
-    return handled;
+    conduit::execution::for_all<policy>(0, numInputPts, [&](conduit::index_t i)
+    {
+        result_ptr[i] = search->findPoint(&input_ptr[i * 3]);
+    });
+    return true;
 }
 
 //---------------------------------------------------------------------------
@@ -3568,30 +4109,41 @@ MatchQuery::execute()
 {
     CONDUIT_ANNOTATE_MARK_FUNCTION;
 
-    // Build the query geometries. Store them in the query_mesh node.
+    if(m_query.empty())
+        return;
+
+    // Determine the shape of the subset topologies from the first domain.
     std::string shape;
-    for(auto it = m_query.begin(); it != m_query.end(); it++)
     {
-        int dom = it->first.first;
+        const auto dtopo = getDomainTopology(m_query.begin()->first.first);
+        ShapeCascade c(*dtopo);
+        const auto &s = c.get_shape((c.dim == 0) ? c.dim : (c.dim - 1));
+        shape = s.type;
+    }
 
-        if(shape.empty())
-        {
-            // We have not determined the shape yet. Do that now so the subset
-            // topologies can be built.
-            const auto dtopo = getDomainTopology(dom);
-            ShapeCascade c(*dtopo);
-            const auto &s = c.get_shape((c.dim == 0) ? c.dim : (c.dim - 1));
-            shape = s.type;
-        }
+    // The queries are independent so they can be built and searched in
+    // parallel. Gather iterators so the queries can be visited by index.
+    std::vector<std::map<std::pair<int,int>, QueryInfo>::iterator> queries;
+    queries.reserve(m_query.size());
+    for(auto it = m_query.begin(); it != m_query.end(); it++)
+        queries.push_back(it);
+    const index_t nqueries = static_cast<index_t>(queries.size());
 
+    // Build the query geometries. Store them in the query_mesh node.
+    for_all_domains(nqueries, [&](index_t qi)
+    {
+        auto it = queries[qi];
+        int dom = it->first.first;
         it->second.builder->execute(it->second.query_mesh, shape);
         it->second.query_mesh["state/domain_id"] = dom;
-    }
+    });
 
     // Now that the query geometries are built, on a single rank, we should
     // have A,B and B,A in the keys.
-    for(auto it = m_query.begin(); it != m_query.end(); it++)
+    const std::string topoKey("topologies/" + m_topoName);
+    for_all_domains(nqueries, [&](index_t qi)
     {
+        auto it = queries[qi];
         int dom = it->first.first;
         int query_domain = it->first.second;
 
@@ -3605,15 +4157,12 @@ MatchQuery::execute()
         }
 
         // Get both of the topologies.
-        conduit::Node &mesh1 = it->second.query_mesh;
-        conduit::Node &mesh2 = oppit->second.query_mesh;
-        std::string topoKey("topologies/" + m_topoName);
-        conduit::Node &topo1 = mesh1[topoKey];
-        conduit::Node &topo2 = mesh2[topoKey];
+        const conduit::Node &topo1 = it->second.query_mesh.fetch_existing(topoKey);
+        const conduit::Node &topo2 = oppit->second.query_mesh.fetch_existing(topoKey);
 
         // Perform the search and store the results.
         it->second.results = topology::search(topo2, topo1);
-    }
+    });
 }
 
 //---------------------------------------------------------------------------
@@ -14,6 +14,7 @@
 //-----------------------------------------------------------------------------
 // std includes
 //-----------------------------------------------------------------------------
+#include <functional>
 #include <map>
 #include <set>
 #include <string>
@@ -253,6 +254,27 @@ void CONDUIT_BLUEPRINT_API slice_field(const conduit::Node &n_src_values,
                                        const std::vector<conduit::index_t> &ids,
                                        conduit::Node &n_dest_values);
 
+//-----------------------------------------------------------------------------
+/**
+ @brief Slice several values nodes (arrays or mcarrays) using the same ids.
+        The runs of consecutive ids are found once and all of the values are
+        gathered in one parallel pass, which is cheaper than slicing each
+        field separately.
+
+ @param n_src_values The nodes containing the source values.
+ @param ids The ids that will be extracted from the source values.
+ @param n_dest_values The nodes that will contain the sliced data. There must
+                      be one destination for each source.
+ */
+void CONDUIT_BLUEPRINT_API slice_fields(const std::vector<const conduit::Node *> &n_src_values,
+                                        const std::vector<int> &ids,
+                                        const std::vector<conduit::Node *> &n_dest_values);
+
+/// Same as above.
+void CONDUIT_BLUEPRINT_API slice_fields(const std::vector<const conduit::Node *> &n_src_values,
+                                        const std::vector<conduit::index_t> &ids,
+                                        const std::vector<conduit::Node *> &n_dest_values);
+
 //-----------------------------------------------------------------------------
 /**
  @brief Copy fields from one node to another, making full copies.
@@ -278,6 +300,20 @@ void CONDUIT_BLUEPRINT_API convert(conduit::Node &root,
                                    const conduit::DataType &desired_type,
                                    const std::vector<std::string> &keys);
 
+//-----------------------------------------------------------------------------
+/**
+ @brief Call func(i) for each i in [0, n), where each i is an independent
+        unit of work such as a domain. When OpenMP is enabled and there are at
+        least as many items as threads, the items run concurrently. Otherwise
+        they run in order so the kernels called by func can use the threads.
+        An error raised by any item is rethrown after all items are done.
+
+ @param n    The number of items.
+ @param func The function to call for each item.
+ */
+void CONDUIT_BLUEPRINT_API for_all_domains(index_t n,
+                                           const std::function<void(index_t)> &func);
+
 //-----------------------------------------------------------------------------
 // -- begin conduit::blueprint::mesh::utils::connectivity --
 //-----------------------------------------------------------------------------
@@ -513,7 +549,10 @@ namespace topology
         void clear();
     protected:
         const conduit::Node       &topo;
-        std::map<index_t, index_t> old_to_new;
+        // Dense map from original point ids to new point ids (-1 if unused)
+        // and the inverse map from new point ids to original point ids.
+        std::vector<index_t>       old_to_new;
+        std::vector<index_t>       new_to_old;
         std::vector<index_t>       topo_conn;
         std::vector<index_t>       topo_sizes;
     };
@@ -616,6 +655,8 @@ namespace topology
 namespace query
 {
 
+class SpatialIndex;
+
 //---------------------------------------------------------------------------
 /**
  @brief Base class for point queries. The class can build up a set of point
@@ -699,6 +740,14 @@ public:
     /// Point threshold after which it makes sense to switch search methods.
     static const int SEARCH_THRESHOLD;
 
+    /// The spatial index types that can be used to accelerate searches.
+    enum SearchMethod
+    {
+        SEARCH_AUTO,         //!< Pick an index based on the point distribution.
+        SEARCH_KDTREE,       //!< Use a kdtree.
+        SEARCH_UNIFORM_GRID  //!< Use a uniform grid of point bins.
+    };
+
     /**
      @brief Constructor
      @param mesh The input mesh(es). Each mesh domain must have state/domain_id
@@ -718,7 +767,37 @@ public:
     void setPointTolerance(double tolerance);
 
     /**
-     @brief Execute all of the point queries.
+     @brief Set the type of spatial index used to search coordsets. With
+            SEARCH_AUTO, small coordsets are searched directly and large
+            coordsets use a uniform grid unless their points are clustered,
+            in which case a kdtree is used.
+     @param method The search method.
+     */
+    void setSearchMethod(SearchMethod method);
+
+    /**
+     @brief Return the search method.
+     @return The search method.
+     */
+    SearchMethod getSearchMethod() const;
+
+    /**
+     @brief Spatial indices are cached per coordset and reused across calls
+            to execute() as long as the coordset's data pointers and size
+            are unchanged. Call this method to discard all cached indices,
+            for example when coordinates were modified in place.
+     */
+    void invalidateCache();
+
+    /**
+     @brief Discard the cached spatial index for a single coordset.
+     @param coordset The coordset whose index will be discarded.
+     */
+    void invalidateCache(const conduit::Node &coordset);
+
+    /**
+     @brief Execute all of the point queries. The points for all domains are
+            searched together in one parallel batch.
      @param coordsetName The name of the coordset we're searching in the domains.
      */
     virtual void execute(const std::string &coordsetName) override;
@@ -746,7 +825,8 @@ protected:
                             std::vector<int> &result) const;
 
     /**
-     @brief Find the input points in the input mesh's coordset using kdtree strategy.
+     @brief Find the input points in the input mesh's coordset using a cached
+            spatial index (kdtree or uniform grid).
      @param ndims The number of dimensions in the coordset.
      @param sameTypes Whether the coordinates are all the same type.
      @param coords The nodes for the individual coordset axis values.
@@ -786,8 +866,21 @@ protected:
      */
     std::vector<int> domainIds() const;
 
+    /**
+     @brief Return a spatial index for the coordinates, building and caching
+            it if needed.
+     @return The spatial index or nullptr if the coordinates should be
+             searched directly.
+     */
+    std::shared_ptr<SpatialIndex> spatialIndex(int ndims,
+                                               bool sameTypes,
+                                               const conduit::Node *coords[3],
+                                               const conduit::index_t coordTypes[3]) const;
+
 protected:
     double m_pointTolerance;
+    SearchMethod m_searchMethod;
+    mutable std::map<const conduit::Node *, std::shared_ptr<SpatialIndex>> m_indexCache;
 };
 
 //---------------------------------------------------------------------------
@@ -149,6 +149,29 @@ void CONDUIT_BLUEPRINT_API distribute(const conduit::Node &mesh,
                                       conduit::Node &output,
                                       MPI_Comm comm);
 
+///@name blueprint::mpi::mesh::exchange_fields(...)
+//-----------------------------------------------------------------------------
+/// description:
+///   exchange_fields(...) Updates the values of the named fields on the
+///   entities shared between domains, as described by the adjset. The fields
+///   must use the adjset's association and topology.
+///
+///   All messages between a pair of ranks are coalesced into one buffer.
+///   Domains that live on the same rank exchange through the same packed
+///   buffers without MPI.
+///
+///  options:
+///   op: "replace" (default) -- the domain with the lowest id that shares
+///                              an entity provides its value
+///       "sum"                -- shared entities get the sum of all values
+///       "min", "max"         -- shared entities get the min / max value
+//-----------------------------------------------------------------------------
+void CONDUIT_BLUEPRINT_API exchange_fields(conduit::Node &mesh,
+                                           const std::string &adjset_name,
+                                           const std::vector<std::string> &field_names,
+                                           const conduit::Node &options,
+                                           MPI_Comm comm);
+
 
 ///@name blueprint::mpi::mesh::find_delegate_domain(...)
 ///@{
@@ -230,7 +253,8 @@ void CONDUIT_BLUEPRINT_API generate_corners(conduit::Node& mesh,
 //-------------------------------------------------------------------------
 /**
  @brief Performs the mesh::flatten() operation across all ranks in comm.
-    The resulting table will be gathered to rank 0.
+    The resulting table will be gathered to rank 0 unless the "distributed"
+    option is used.
  @param mesh    A Conduit node containing a blueprint mesh or set of mesh domains.
  @param options A Conduit node containing options for the flatten operation.
  @param[out] output A Conduit node that will contain the blueprint table output.
@@ -241,6 +265,14 @@ Supports the same options as serial flatten() plus:
         (Default = 0 (false))
     "root": The rank that will contain the output table for all ranks in comm.
         (Default = 0)
+    "distributed": Keeps each rank's rows on that rank instead of gathering
+        them to root. Every rank gets tables with the same columns and its
+        own rows, along with "state/row_offset" (the global index of its
+        first row) and "state/global_rows" for each table. "root" is
+        ignored. (Default = 0 (false))
+    "rebalance": When "distributed" is enabled, moves rows between ranks
+        so each rank holds an equal share while keeping the global row
+        order. (Default = 0 (false))
 */
 void CONDUIT_BLUEPRINT_API flatten(const conduit::Node &mesh,
                                    const conduit::Node &options,
@@ -0,0 +1,567 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_blueprint_mpi_mesh_exchange.cpp
+///
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// conduit includes
+//-----------------------------------------------------------------------------
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <vector>
+
+#include "conduit_blueprint_mesh.hpp"
+#include "conduit_blueprint_mpi_mesh.hpp"
+#include "conduit_execution.hpp"
+
+#include "conduit_relay_mpi.hpp"
+#include <mpi.h>
+
+//-----------------------------------------------------------------------------
+// -- begin conduit --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::blueprint --
+//-----------------------------------------------------------------------------
+namespace blueprint
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::blueprint::mpi --
+//-----------------------------------------------------------------------------
+namespace mpi
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::blueprint::mpi::mesh --
+//-----------------------------------------------------------------------------
+namespace mesh
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::blueprint::mpi::mesh::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+#if defined(CONDUIT_USE_OPENMP)
+using ExchangeExec = conduit::execution::OpenMPExec;
+#else
+using ExchangeExec = conduit::execution::SerialExec;
+#endif
+
+enum ExchangeOp
+{
+    EXCHANGE_REPLACE,
+    EXCHANGE_SUM,
+    EXCHANGE_MIN,
+    EXCHANGE_MAX
+};
+
+//---------------------------------------------------------------------------
+/**
+ @brief The entities that a local domain shares with one neighbor domain.
+        The indices are the concatenation of all adjset groups that contain
+        the neighbor, ordered by the groups' sorted participant lists so both
+        sides of the interface agree on the order.
+ */
+struct ExchangeLink
+{
+    index_t local_idx;   // index into the local domains vector
+    index_t local_id;    // domain id of the local domain
+    index_t remote_id;   // domain id of the neighbor
+    int     remote_rank; // rank that owns the neighbor
+    std::vector<index_t> indices;
+    // byte offsets of this link's data in the send / recv buffers
+    index_t send_offset;
+    index_t recv_offset;
+};
+
+//---------------------------------------------------------------------------
+/**
+ @brief One component of a field in a local domain.
+ */
+struct ExchangeComponent
+{
+    Node   *values;
+    index_t dtype_id;
+    index_t element_bytes;
+};
+
+//---------------------------------------------------------------------------
+// Gathers elements (selected by indices) of a possibly strided array into a
+// packed buffer.
+//---------------------------------------------------------------------------
+template <typename T>
+void
+gather_elements(const Node &values,
+                const std::vector<index_t> &indices,
+                char *dst_bytes)
+{
+    const char *src_bytes = static_cast<const char *>(values.element_ptr(0));
+    const index_t stride = values.dtype().stride();
+    T *dst = reinterpret_cast<T *>(dst_bytes);
+    const index_t *idx = indices.data();
+    conduit::execution::for_all<ExchangeExec>(0, indices.size(), [&](index_t i)
+    {
+        memcpy(dst + i, src_bytes + idx[i] * stride, sizeof(T));
+    });
+}
+
+//---------------------------------------------------------------------------
+template <typename T>
+void
+scatter_replace(Node &values,
+                const std::vector<index_t> &indices,
+                const char *src_bytes)
+{
+    char *dst_bytes = static_cast<char *>(values.element_ptr(0));
+    const index_t stride = values.dtype().stride();
+    const T *src = reinterpret_cast<const T *>(src_bytes);
+    const index_t *idx = indices.data();
+    conduit::execution::for_all<ExchangeExec>(0, indices.size(), [&](index_t i)
+    {
+        memcpy(dst_bytes + idx[i] * stride, src + i, sizeof(T));
+    });
+}
+
+//---------------------------------------------------------------------------
+template <typename T>
+void
+scatter_op(Node &values,
+           const std::vector<index_t> &indices,
+           const char *src_bytes,
+           ExchangeOp op)
+{
+    char *dst_bytes = static_cast<char *>(values.element_ptr(0));
+    const index_t stride = values.dtype().stride();
+    const index_t *idx = indices.data();
+    conduit::execution::for_all<ExchangeExec>(0, indices.size(), [&](index_t i)
+    {
+        T dst_val, src_val;
+        memcpy(&dst_val, dst_bytes + idx[i] * stride, sizeof(T));
+        memcpy(&src_val, src_bytes + i * sizeof(T), sizeof(T));
+        if(op == EXCHANGE_SUM)
+            dst_val = static_cast<T>(dst_val + src_val);
+        else if(op == EXCHANGE_MIN)
+            dst_val = std::min(dst_val, src_val);
+        else
+            dst_val = std::max(dst_val, src_val);
+        memcpy(dst_bytes + idx[i] * stride, &dst_val, sizeof(T));
+    });
+}
+
+//---------------------------------------------------------------------------
+void
+pack_component(const ExchangeComponent &comp,
+               const std::vector<index_t> &indices,
+               char *dst)
+{
+    switch(comp.element_bytes)
+    {
+        case 1: gather_elements<uint8>(*comp.values, indices, dst); break;
+        case 2: gather_elements<uint16>(*comp.values, indices, dst); break;
+        case 4: gather_elements<uint32>(*comp.values, indices, dst); break;
+        case 8: gather_elements<uint64>(*comp.values, indices, dst); break;
+        default:
+            CONDUIT_ERROR("exchange_fields: unsupported element size "
+                          << comp.element_bytes);
+    }
+}
+
+//---------------------------------------------------------------------------
+void
+unpack_component(ExchangeComponent &comp,
+                 const std::vector<index_t> &indices,
+                 const char *src,
+                 ExchangeOp op)
+{
+    if(op == EXCHANGE_REPLACE)
+    {
+        switch(comp.element_bytes)
+        {
+            case 1: scatter_replace<uint8>(*comp.values, indices, src); break;
+            case 2: scatter_replace<uint16>(*comp.values, indices, src); break;
+            case 4: scatter_replace<uint32>(*comp.values, indices, src); break;
+            case 8: scatter_replace<uint64>(*comp.values, indices, src); break;
+            default:
+                CONDUIT_ERROR("exchange_fields: unsupported element size "
+                              << comp.element_bytes);
+        }
+        return;
+    }
+
+    switch(comp.dtype_id)
+    {
+        case DataType::INT8_ID:    scatter_op<int8>(*comp.values, indices, src, op); break;
+        case DataType::INT16_ID:   scatter_op<int16>(*comp.values, indices, src, op); break;
+        case DataType::INT32_ID:   scatter_op<int32>(*comp.values, indices, src, op); break;
+        case DataType::INT64_ID:   scatter_op<int64>(*comp.values, indices, src, op); break;
+        case DataType::UINT8_ID:   scatter_op<uint8>(*comp.values, indices, src, op); break;
+        case DataType::UINT16_ID:  scatter_op<uint16>(*comp.values, indices, src, op); break;
+        case DataType::UINT32_ID:  scatter_op<uint32>(*comp.values, indices, src, op); break;
+        case DataType::UINT64_ID:  scatter_op<uint64>(*comp.values, indices, src, op); break;
+        case DataType::FLOAT32_ID: scatter_op<float32>(*comp.values, indices, src, op); break;
+        case DataType::FLOAT64_ID: scatter_op<float64>(*comp.values, indices, src, op); break;
+        default:
+            CONDUIT_ERROR("exchange_fields: unsupported dtype "
+                          << DataType::id_to_name(comp.dtype_id));
+    }
+}
+
+//---------------------------------------------------------------------------
+ExchangeOp
+exchange_op_from_options(const Node &options)
+{
+    ExchangeOp op = EXCHANGE_REPLACE;
+    if(options.has_child("op"))
+    {
+        const std::string op_name = options["op"].as_string();
+        if(op_name == "replace")
+            op = EXCHANGE_REPLACE;
+        else if(op_name == "sum")
+            op = EXCHANGE_SUM;
+        else if(op_name == "min")
+            op = EXCHANGE_MIN;
+        else if(op_name == "max")
+            op = EXCHANGE_MAX;
+        else
+        {
+            CONDUIT_ERROR("exchange_fields: unknown op \"" << op_name << "\"."
+                          " Expected replace, sum, min, or max.");
+        }
+    }
+    return op;
+}
+
+//---------------------------------------------------------------------------
+/**
+ @brief Builds the per-neighbor index lists for all local domains.
+ */
+void
+build_exchange_links(const std::vector<Node *> &doms,
+                     const std::vector<index_t> &dom_ids,
+                     const std::string &adjset_name,
+                     const index_t_accessor &d2r,
+                     std::vector<ExchangeLink> &links)
+{
+    for(size_t di = 0; di < doms.size(); di++)
+    {
+        const Node &dom = *doms[di];
+        if(!dom.has_path("adjsets/" + adjset_name))
+        {
+            continue;
+        }
+
+        const index_t dom_id = dom_ids[di];
+        const Node &groups = dom["adjsets/" + adjset_name + "/groups"];
+
+        // participants (sorted, including this domain) -> group index
+        std::vector<std::pair<std::vector<index_t>, index_t>> group_keys;
+        for(index_t gi = 0; gi < groups.number_of_children(); gi++)
+        {
+            const Node &group = groups.child(gi);
+            index_t_accessor nbrs = group["neighbors"].as_index_t_accessor();
+            std::vector<index_t> key;
+            key.push_back(dom_id);
+            for(index_t ni = 0; ni < nbrs.number_of_elements(); ni++)
+            {
+                key.push_back(nbrs[ni]);
+            }
+            std::sort(key.begin(), key.end());
+            group_keys.push_back(std::make_pair(key, gi));
+        }
+        std::stable_sort(group_keys.begin(), group_keys.end());
+
+        std::map<index_t, index_t> nbr_link;
+        for(size_t k = 0; k < group_keys.size(); k++)
+        {
+            const Node &group = groups.child(group_keys[k].second);
+            index_t_accessor nbrs = group["neighbors"].as_index_t_accessor();
+            index_t_accessor vals = group["values"].as_index_t_accessor();
+            for(index_t ni = 0; ni < nbrs.number_of_elements(); ni++)
+            {
+                const index_t nbr = nbrs[ni];
+                std::map<index_t, index_t>::const_iterator itr = nbr_link.find(nbr);
+                index_t link_idx = 0;
+                if(itr == nbr_link.end())
+                {
+                    if(nbr < 0 || nbr >= d2r.number_of_elements() || d2r[nbr] < 0)
+                    {
+                        CONDUIT_ERROR("exchange_fields: domain " << dom_id
+                                      << " references unknown neighbor domain "
+                                      << nbr);
+                    }
+                    link_idx = static_cast<index_t>(links.size());
+                    nbr_link[nbr] = link_idx;
+                    ExchangeLink link;
+                    link.local_idx = static_cast<index_t>(di);
+                    link.local_id = dom_id;
+                    link.remote_id = nbr;
+                    link.remote_rank = static_cast<int>(d2r[nbr]);
+                    link.send_offset = 0;
+                    link.recv_offset = 0;
+                    links.push_back(link);
+                }
+                else
+                {
+                    link_idx = itr->second;
+                }
+
+                std::vector<index_t> &indices = links[link_idx].indices;
+                for(index_t vi = 0; vi < vals.number_of_elements(); vi++)
+                {
+                    indices.push_back(vals[vi]);
+                }
+            }
+        }
+    }
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::blueprint::mpi::mesh::detail --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+void
+exchange_fields(conduit::Node &mesh,
+                const std::string &adjset_name,
+                const std::vector<std::string> &field_names,
+                const conduit::Node &options,
+                MPI_Comm comm)
+{
+    using namespace detail;
+
+    const int par_rank = relay::mpi::rank(comm);
+    const ExchangeOp op = exchange_op_from_options(options);
+
+    Node d2r_map;
+    generate_domain_to_rank_map(mesh, d2r_map, comm);
+    index_t_accessor d2r = d2r_map.as_index_t_accessor();
+
+    std::vector<Node *> doms = ::conduit::blueprint::mesh::domains(mesh);
+    std::vector<index_t> dom_ids(doms.size(), par_rank);
+    for(size_t di = 0; di < doms.size(); di++)
+    {
+        if(doms[di]->has_path("state/domain_id"))
+        {
+            dom_ids[di] = doms[di]->fetch("state/domain_id").to_index_t();
+        }
+    }
+
+    // gather the field components of each local domain
+    std::vector<std::vector<ExchangeComponent>> dom_comps(doms.size());
+    std::vector<index_t> dom_entity_bytes(doms.size(), 0);
+    for(size_t di = 0; di < doms.size(); di++)
+    {
+        Node &dom = *doms[di];
+        if(!dom.has_path("adjsets/" + adjset_name))
+        {
+            continue;
+        }
+        const Node &adjset = dom["adjsets/" + adjset_name];
+        const std::string assoc = adjset["association"].as_string();
+        const std::string topo_name = adjset["topology"].as_string();
+
+        for(size_t fi = 0; fi < field_names.size(); fi++)
+        {
+            const std::string &fname = field_names[fi];
+            if(!dom.has_path("fields/" + fname))
+            {
+                CONDUIT_ERROR("exchange_fields: domain " << dom_ids[di]
+                              << " has no field named " << fname);
+            }
+            Node &field = dom["fields/" + fname];
+            if(field["association"].as_string() != assoc ||
+               field["topology"].as_string() != topo_name)
+            {
+                CONDUIT_ERROR("exchange_fields: field " << fname
+                              << " must have association " << assoc
+                              << " and topology " << topo_name
+                              << " to match adjset " << adjset_name);
+            }
+
+            Node &values = field["values"];
+            const index_t ncomps = values.dtype().is_object() ?
+                values.number_of_children() : 1;
+            for(index_t ci = 0; ci < ncomps; ci++)
+            {
+                Node &comp_values = values.dtype().is_object() ?
+                    values.child(ci) : values;
+                if(!comp_values.dtype().is_number())
+                {
+                    CONDUIT_ERROR("exchange_fields: field " << fname
+                                  << " does not hold numeric values");
+                }
+                ExchangeComponent comp;
+                comp.values = &comp_values;
+                comp.dtype_id = comp_values.dtype().id();
+                comp.element_bytes = comp_values.dtype().element_bytes();
+                dom_comps[di].push_back(comp);
+                dom_entity_bytes[di] += comp.element_bytes;
+            }
+        }
+    }
+
+    std::vector<ExchangeLink> links;
+    build_exchange_links(doms, dom_ids, adjset_name, d2r, links);
+
+    // Coalesce all links that cross between this rank and each neighbor
+    // rank into one message. Both sides order a message's links by
+    // (sending domain, receiving domain).
+    std::map<int, std::vector<index_t>> send_links, recv_links;
+    for(size_t li = 0; li < links.size(); li++)
+    {
+        send_links[links[li].remote_rank].push_back(static_cast<index_t>(li));
+        recv_links[links[li].remote_rank].push_back(static_cast<index_t>(li));
+    }
+
+    std::map<int, index_t> send_sizes, recv_sizes;
+    for(auto &rl : send_links)
+    {
+        std::sort(rl.second.begin(), rl.second.end(), [&](index_t a, index_t b)
+        {
+            return std::make_pair(links[a].local_id, links[a].remote_id) <
+                   std::make_pair(links[b].local_id, links[b].remote_id);
+        });
+        index_t offset = 0;
+        for(index_t li : rl.second)
+        {
+            links[li].send_offset = offset;
+            offset += static_cast<index_t>(links[li].indices.size()) *
+                      dom_entity_bytes[links[li].local_idx];
+        }
+        send_sizes[rl.first] = offset;
+    }
+    for(auto &rl : recv_links)
+    {
+        std::sort(rl.second.begin(), rl.second.end(), [&](index_t a, index_t b)
+        {
+            return std::make_pair(links[a].remote_id, links[a].local_id) <
+                   std::make_pair(links[b].remote_id, links[b].local_id);
+        });
+        index_t offset = 0;
+        for(index_t li : rl.second)
+        {
+            links[li].recv_offset = offset;
+            offset += static_cast<index_t>(links[li].indices.size()) *
+                      dom_entity_bytes[links[li].local_idx];
+        }
+        recv_sizes[rl.first] = offset;
+    }
+
+    // pack
+    std::map<int, std::vector<char>> send_bufs, recv_bufs;
+    for(const auto &rl : send_links)
+    {
+        std::vector<char> &buf = send_bufs[rl.first];
+        buf.resize(send_sizes[rl.first]);
+        for(index_t li : rl.second)
+        {
+            const ExchangeLink &link = links[li];
+            char *dst = buf.data() + link.send_offset;
+            const index_t nents = static_cast<index_t>(link.indices.size());
+            for(const ExchangeComponent &comp : dom_comps[link.local_idx])
+            {
+                pack_component(comp, link.indices, dst);
+                dst += nents * comp.element_bytes;
+            }
+        }
+    }
+
+    // domains that live on this rank use a local copy instead of MPI
+    std::vector<MPI_Request> requests;
+    const int tag = 423000;
+    for(const auto &rs : recv_sizes)
+    {
+        if(rs.first == par_rank)
+        {
+            continue;
+        }
+        std::vector<char> &buf = recv_bufs[rs.first];
+        buf.resize(rs.second);
+        MPI_Request req;
+        MPI_Irecv(buf.data(), static_cast<int>(rs.second), MPI_BYTE,
+                  rs.first, tag, comm, &req);
+        requests.push_back(req);
+    }
+    for(auto &sb : send_bufs)
+    {
+        if(sb.first == par_rank)
+        {
+            continue;
+        }
+        MPI_Request req;
+        MPI_Isend(sb.second.data(), static_cast<int>(sb.second.size()),
+                  MPI_BYTE, sb.first, tag, comm, &req);
+        requests.push_back(req);
+    }
+    if(!requests.empty())
+    {
+        MPI_Waitall(static_cast<int>(requests.size()), requests.data(),
+                    MPI_STATUSES_IGNORE);
+    }
+
+    // Unpack in order of decreasing sender domain id so that for "replace"
+    // the lowest domain id that shares an entity provides its value.
+    std::vector<index_t> unpack_order(links.size());
+    for(size_t li = 0; li < links.size(); li++)
+    {
+        unpack_order[li] = static_cast<index_t>(li);
+    }
+    std::sort(unpack_order.begin(), unpack_order.end(), [&](index_t a, index_t b)
+    {
+        return std::make_pair(links[a].remote_id, links[a].local_id) >
+               std::make_pair(links[b].remote_id, links[b].local_id);
+    });
+
+    for(index_t li : unpack_order)
+    {
+        const ExchangeLink &link = links[li];
+        if(op == EXCHANGE_REPLACE && link.remote_id > link.local_id)
+        {
+            // this domain owns the shared entities
+            continue;
+        }
+        // links between domains on this rank read the packed send buffer
+        const std::vector<char> &buf = link.remote_rank == par_rank ?
+            send_bufs[par_rank] : recv_bufs[link.remote_rank];
+        const char *src = buf.data() + link.recv_offset;
+        const index_t nents = static_cast<index_t>(link.indices.size());
+        for(ExchangeComponent &comp : dom_comps[link.local_idx])
+        {
+            unpack_component(comp, link.indices, src, op);
+            src += nents * comp.element_bytes;
+        }
+    }
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::blueprint::mpi::mesh --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::blueprint::mpi --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::blueprint --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit --
+//-----------------------------------------------------------------------------
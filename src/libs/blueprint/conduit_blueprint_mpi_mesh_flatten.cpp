@@ -12,9 +12,11 @@
 //-----------------------------------------------------------------------------
 // std lib includes
 //-----------------------------------------------------------------------------
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <iostream>
+#include <limits>
 #include <unordered_set>
 
 //-----------------------------------------------------------------------------
@@ -85,6 +87,8 @@ ParallelMeshFlattener::ParallelMeshFlattener(MPI_Comm comm)
     root = 0;
     rank = relay::mpi::rank(comm);
     add_rank = false;
+    distributed = false;
+    rebalance = false;
 }
 
 //-----------------------------------------------------------------------------
@@ -114,6 +118,36 @@ ParallelMeshFlattener::set_options(const Node &opts)
         }
     }
 
+    // "distributed", boolean
+    if(opts.has_child("distributed"))
+    {
+        if(opts["distributed"].dtype().is_number())
+        {
+            this->distributed = opts["distributed"].to_int() != 0;
+        }
+        else
+        {
+            ok = false;
+            CONDUIT_ERROR("options[" << quote("distributed") <<
+                "] must be a number. It will be treated as a boolean (.to_int() != 0).");
+        }
+    }
+
+    // "rebalance", boolean
+    if(opts.has_child("rebalance"))
+    {
+        if(opts["rebalance"].dtype().is_number())
+        {
+            this->rebalance = opts["rebalance"].to_int() != 0;
+        }
+        else
+        {
+            ok = false;
+            CONDUIT_ERROR("options[" << quote("rebalance") <<
+                "] must be a number. It will be treated as a boolean (.to_int() != 0).");
+        }
+    }
+
     // "root", int
     if(opts.has_child("root"))
     {
@@ -146,7 +180,7 @@ ParallelMeshFlattener::set_options(const Node &opts)
 //-----------------------------------------------------------------------------
 ParallelMeshFlattener::FieldInfo::FieldInfo()
     : field_names(), field_ncomps(), field_assocs(),
-        field_dtypes(), comp_names()
+        field_dtypes(), comp_names(), cset_name()
 {
 
 }
@@ -167,6 +201,7 @@ ParallelMeshFlattener::FieldInfo::from_node(const Node &n)
     field_assocs.clear();
     field_dtypes.clear();
     comp_names.clear();
+    cset_name.clear();
 
     const index_t nfields = n["field_names"].number_of_children();
     const index_t *ncomps = (const index_t*)n["field_ncomps"].element_ptr(0);
@@ -185,6 +220,11 @@ ParallelMeshFlattener::FieldInfo::from_node(const Node &n)
     {
         comp_names.push_back(n["comp_names"][i].as_string());
     }
+
+    if(n.has_child("cset_name"))
+    {
+        cset_name = n["cset_name"].as_string();
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -205,6 +245,7 @@ ParallelMeshFlattener::FieldInfo::to_node(Node &out) const
     {
         out["comp_names"].append().set(comp_names[i]);
     }
+    out["cset_name"].set(cset_name);
 }
 
 //-----------------------------------------------------------------------------
@@ -303,6 +344,11 @@ ParallelMeshFlattener::calculate_unique_fields(const Node &all_fields,
     for(index_t i = 0; i < all_fields.number_of_children(); i++)
     {
         const FieldInfo fi(all_fields[i]);
+        // Use the first coordset name that any rank provides.
+        if(gfi.cset_name.empty())
+        {
+            gfi.cset_name = fi.cset_name;
+        }
         for(index_t j = 0; j < (index_t)fi.field_names.size(); j++)
         {
             const std::string field_name = fi.field_names[j];
@@ -343,6 +389,7 @@ ParallelMeshFlattener::determine_global_fields(const Node &mesh) const
 
     // Need to make sure this rank has data, don't want to throw any uncaught exceptions
     std::string topo_name = "";
+    std::string cset_name = "";
     std::vector<std::string> fields_to_flatten;
     if(mesh.number_of_children() > 0)
     {
@@ -350,6 +397,7 @@ ParallelMeshFlattener::determine_global_fields(const Node &mesh) const
         {
             const Node &topo = get_topology(mesh[0]);
             topo_name = topo.name();
+            cset_name = get_coordset(mesh[0]).name();
         }
         catch(const conduit::Error &)
         {
@@ -376,6 +424,7 @@ ParallelMeshFlattener::determine_global_fields(const Node &mesh) const
         // Create the local list of field info
         Node my_fields;
         build_local_field_info(fields_to_flatten, mesh, topo_name, my_fields);
+        my_fields["cset_name"].set(cset_name);
 
         Node all_fields;
         relay::mpi::gather_using_schema(my_fields, all_fields, root, comm);
@@ -409,6 +458,49 @@ ParallelMeshFlattener::determine_global_fields(const Node &mesh) const
     return info;
 }
 
+//-----------------------------------------------------------------------------
+// Encodes the coordinate system of a rank's axes so ranks can agree on the
+// axis names using a numeric reduction. Cartesian has the lowest value so it
+// is preferred.
+static index_t
+axes_to_index_t(const std::vector<std::string> &axes)
+{
+    index_t retval = 0;
+    if(axes.size() > 1)
+    {
+        if(axes[0] == blueprint::mesh::utils::CYLINDRICAL_AXES[0])
+        {
+            retval = 1;
+            if(axes[1] == blueprint::mesh::utils::SPHERICAL_AXES[1])
+            {
+                retval = 2;
+            }
+        }
+        else if(axes[0] == blueprint::mesh::utils::LOGICAL_AXES[0])
+        {
+            retval = 3;
+        }
+    }
+    return retval;
+}
+
+//-----------------------------------------------------------------------------
+static const std::vector<std::string> &
+index_t_to_axes(index_t axes)
+{
+    switch(axes)
+    {
+    case 1:
+        return blueprint::mesh::utils::CYLINDRICAL_AXES;
+    case 2:
+        return blueprint::mesh::utils::SPHERICAL_AXES;
+    case 3:
+        return blueprint::mesh::utils::LOGICAL_AXES;
+    default: // 0
+        return blueprint::mesh::utils::CARTESIAN_AXES;
+    }
+}
+
 //-----------------------------------------------------------------------------
 void
 ParallelMeshFlattener::gather_global_mesh_metadata(const MeshInfo &my_info,
@@ -437,22 +529,7 @@ ParallelMeshFlattener::gather_global_mesh_metadata(const MeshInfo &my_info,
         my_counts.size(), mtype, root, comm);
 
     // Lastly root needs an educated guess at dimension names.
-    index_t my_axes = 0;
-    if(my_info.axes.size() > 1)
-    {
-        if(my_info.axes[0] == blueprint::mesh::utils::CYLINDRICAL_AXES[0])
-        {
-            my_axes = 1;
-            if(my_info.axes[1] == blueprint::mesh::utils::SPHERICAL_AXES[1])
-            {
-                my_axes = 2;
-            }
-        }
-        else if(my_info.axes[0] == blueprint::mesh::utils::LOGICAL_AXES[0])
-        {
-            my_axes = 3;
-        }
-    }
+    index_t my_axes = axes_to_index_t(my_info.axes);
     // Prefer cartesian
     index_t g_axes = 0;
     MPI_Reduce(&my_axes, &g_axes, 1, mtype, MPI_MIN, root, comm);
@@ -460,21 +537,7 @@ ParallelMeshFlattener::gather_global_mesh_metadata(const MeshInfo &my_info,
     if(rank == root)
     {
         // Translate the int to the actual string vector
-        switch(g_axes)
-        {
-        case 1:
-            out.axes = blueprint::mesh::utils::CYLINDRICAL_AXES;
-            break;
-        case 2:
-            out.axes = blueprint::mesh::utils::SPHERICAL_AXES;
-            break;
-        case 3:
-            out.axes = blueprint::mesh::utils::LOGICAL_AXES;
-            break;
-        default: // 0
-            out.axes = blueprint::mesh::utils::CARTESIAN_AXES;
-            break;
-        }
+        out.axes = index_t_to_axes(g_axes);
 
         out.nverts = 0;
         out.nelems = 0;
@@ -487,6 +550,42 @@ ParallelMeshFlattener::gather_global_mesh_metadata(const MeshInfo &my_info,
     }
 }
 
+//-----------------------------------------------------------------------------
+void
+ParallelMeshFlattener::gather_distributed_mesh_metadata(const MeshInfo &my_info,
+    MeshMetaData &out) const
+{
+    DEBUG_PRINT("Rank " << rank << " - gather_distributed_mesh_metadata" << std::endl);
+    out = MeshMetaData();
+    const auto mtype = relay::mpi::conduit_dtype_to_mpi_dtype(DataType::index_t());
+    const int comm_size = relay::mpi::size(comm);
+
+    // Each rank sends [nverts, nelems, coord_type, dimension, axes].
+    const int nvalues = 5;
+    const std::array<index_t, nvalues> my_data{my_info.nverts, my_info.nelems,
+        my_info.coord_type, my_info.dimension, axes_to_index_t(my_info.axes)};
+    std::vector<index_t> all_data(comm_size * nvalues);
+    MPI_Allgather(my_data.data(), nvalues, mtype, all_data.data(), nvalues,
+        mtype, comm);
+
+    // NOTE: small ints < large ints < small floats < large floats, can compute max
+    out.counts.resize(comm_size * 2);
+    index_t g_axes = std::numeric_limits<index_t>::max();
+    for(int i = 0; i < comm_size; i++)
+    {
+        const index_t *d = all_data.data() + i * nvalues;
+        out.counts[2 * i] = d[0];
+        out.counts[2 * i + 1] = d[1];
+        out.nverts += d[0];
+        out.nelems += d[1];
+        out.coord_type = std::max(out.coord_type, d[2]);
+        out.dimension = std::max(out.dimension, d[3]);
+        // Prefer cartesian
+        g_axes = std::min(g_axes, d[4]);
+    }
+    out.axes = index_t_to_axes(g_axes);
+}
+
 //-----------------------------------------------------------------------------
 void
 ParallelMeshFlattener::gather_values(int nrows, int *rank_counts,
@@ -799,12 +898,174 @@ ParallelMeshFlattener::make_root_allocations(const MeshMetaData &mdata,
     }
 }
 
+//-----------------------------------------------------------------------------
+index_t
+ParallelMeshFlattener::rebalance_table(Node &table,
+    const std::vector<index_t> &rank_counts) const
+{
+    DEBUG_PRINT("Rank " << rank << " - rebalance_table" << std::endl);
+    const int comm_size = relay::mpi::size(comm);
+
+    // The rows on each rank before and after, as global row offsets.
+    std::vector<index_t> offsets(comm_size + 1, 0);
+    std::vector<index_t> new_offsets(comm_size + 1, 0);
+    for(int i = 0; i < comm_size; i++)
+    {
+        offsets[i + 1] = offsets[i] + rank_counts[i];
+    }
+    const index_t total = offsets[comm_size];
+    for(int i = 0; i < comm_size; i++)
+    {
+        const index_t n = total / comm_size + ((i < total % comm_size) ? 1 : 0);
+        new_offsets[i + 1] = new_offsets[i] + n;
+    }
+
+    // Rows in the overlap of our old range and each rank's new range are
+    //  sent to that rank. Rows in the overlap of our new range and each
+    //  rank's old range are received from it.
+    const auto overlap = [](index_t a0, index_t a1, index_t b0, index_t b1,
+                            index_t &start) -> index_t {
+        start = std::max(a0, b0);
+        return std::max(index_t(0), std::min(a1, b1) - start);
+    };
+    std::vector<int> send_counts(comm_size), send_offsets(comm_size);
+    std::vector<int> recv_counts(comm_size), recv_offsets(comm_size);
+    const index_t max_count = std::numeric_limits<int>::max();
+    for(int i = 0; i < comm_size; i++)
+    {
+        index_t start = 0;
+        index_t n = overlap(offsets[rank], offsets[rank + 1],
+                            new_offsets[i], new_offsets[i + 1], start);
+        if(n > max_count || offsets[rank + 1] - offsets[rank] > max_count)
+        {
+            CONDUIT_ERROR("Rebalancing supports at most " << max_count
+                << " rows per rank.");
+        }
+        send_counts[i] = static_cast<int>(n);
+        send_offsets[i] = static_cast<int>(n > 0 ? start - offsets[rank] : 0);
+
+        n = overlap(new_offsets[rank], new_offsets[rank + 1],
+                    offsets[i], offsets[i + 1], start);
+        if(n > max_count || new_offsets[rank + 1] - new_offsets[rank] > max_count)
+        {
+            CONDUIT_ERROR("Rebalancing supports at most " << max_count
+                << " rows per rank.");
+        }
+        recv_counts[i] = static_cast<int>(n);
+        recv_offsets[i] = static_cast<int>(n > 0 ? start - new_offsets[rank] : 0);
+    }
+
+    // Exchange each column. All ranks have the same columns in the same order.
+    const index_t nrows = new_offsets[rank + 1] - new_offsets[rank];
+    const auto exchange = [&](Node &column) {
+        Node new_column;
+        new_column.set(DataType(column.dtype().id(), nrows));
+        const auto mtype = relay::mpi::conduit_dtype_to_mpi_dtype(column.dtype());
+        MPI_Alltoallv(column.data_ptr(), send_counts.data(), send_offsets.data(), mtype,
+            new_column.data_ptr(), recv_counts.data(), recv_offsets.data(), mtype,
+            comm);
+        column.move(new_column);
+    };
+    Node &values = table["values"];
+    for(index_t i = 0; i < values.number_of_children(); i++)
+    {
+        Node &value = values[i];
+        const index_t ncomps = value.number_of_children();
+        if(ncomps > 0)
+        {
+            // mcarray
+            for(index_t j = 0; j < ncomps; j++)
+            {
+                exchange(value[j]);
+            }
+        }
+        else
+        {
+            exchange(value);
+        }
+    }
+    return new_offsets[rank];
+}
+
+//-----------------------------------------------------------------------------
+void
+ParallelMeshFlattener::flatten_distributed(const Node &mesh,
+    const FieldInfo &global_field_info, MeshInfo &my_mesh_info,
+    Node &output) const
+{
+    DEBUG_PRINT("Rank " << rank << " - flatten_distributed" << std::endl);
+    MeshMetaData global_metadata;
+    gather_distributed_mesh_metadata(my_mesh_info, global_metadata);
+
+    // Every rank's partition has the same columns, so use the agreed upon
+    //  coordinate names.
+    my_mesh_info.coord_type = global_metadata.coord_type;
+    my_mesh_info.dimension = global_metadata.dimension;
+    my_mesh_info.axes = global_metadata.axes;
+    my_mesh_info.cset_name = global_field_info.cset_name.empty() ?
+        std::string("coords") : global_field_info.cset_name;
+
+    make_local_allocations(my_mesh_info, global_field_info, output);
+
+    if(rank_has_data(my_mesh_info))
+    {
+        index_t vert_offset = 0;
+        index_t elem_offset = 0;
+        for(index_t i = 0; i < my_mesh_info.ndomains; i++)
+        {
+            DEBUG_PRINT("Rank " << rank << " flattening domain " << i << std::endl);
+            flatten_single_domain(mesh[i], output, global_field_info.field_names,
+                my_mesh_info.domain_ids[i], vert_offset, elem_offset);
+            vert_offset += my_mesh_info.verts_per_domain[i];
+            elem_offset += my_mesh_info.elems_per_domain[i];
+        }
+
+        if(this->add_rank)
+        {
+            add_mpi_rank(my_mesh_info, 0, 0, output);
+        }
+    }
+
+    // Record where this rank's rows are in the global table.
+    const int comm_size = relay::mpi::size(comm);
+    const std::array<std::string, 2> tables{"vertex_data", "element_data"};
+    for(int t = 0; t < 2; t++)
+    {
+        Node &table = output[tables[t]];
+        std::vector<index_t> rank_counts(comm_size);
+        index_t row_offset = 0;
+        for(int i = 0; i < comm_size; i++)
+        {
+            rank_counts[i] = global_metadata.counts[2 * i + t];
+            if(i < rank)
+            {
+                row_offset += rank_counts[i];
+            }
+        }
+
+        // Tables without columns are removed on every rank by cleanup_output.
+        if(table["values"].number_of_children() == 0)
+        {
+            continue;
+        }
+
+        if(this->rebalance)
+        {
+            row_offset = rebalance_table(table, rank_counts);
+        }
+        table["state/row_offset"].set(row_offset);
+        table["state/global_rows"].set((t == 0) ? global_metadata.nverts
+                                                : global_metadata.nelems);
+    }
+}
+
 //-----------------------------------------------------------------------------
 void
 ParallelMeshFlattener::cleanup_output(Node &output) const
 {
-    // On all ranks other than root, remove data.
-    if(rank != root)
+    // On all ranks other than root, remove data. Distributed
+    //  output keeps each rank's partition.
+    if(rank != root && !this->distributed)
     {
         output.reset();
     }
@@ -835,6 +1096,14 @@ ParallelMeshFlattener::flatten_many_domains(const Node &mesh, Node &output) cons
         my_mesh_info = MeshInfo();
     }
 
+    if(this->distributed)
+    {
+        flatten_distributed(mesh, global_field_info, my_mesh_info, output);
+        cleanup_output(output);
+        DEBUG_PRINT("Rank " << rank << " done flattening." << std::endl);
+        return;
+    }
+
     // Only coord_type and dimension filled in on all ranks, everything else is only on root.
     MeshMetaData global_metadata;
     gather_global_mesh_metadata(my_mesh_info, global_metadata);
@@ -68,6 +68,8 @@ protected:
         std::vector<index_t> field_assocs;
         std::vector<index_t> field_dtypes;
         std::vector<std::string> comp_names;
+        // The name used for the coordset columns.
+        std::string cset_name;
 
         FieldInfo();
         FieldInfo(const Node &n);
@@ -102,6 +104,12 @@ protected:
     */
     void gather_global_mesh_metadata(const MeshInfo &my_info, MeshMetaData &out) const;
 
+    /**
+    @brief Populates the entire MeshMetaData struct on all ranks using a
+        single MPI_Allgather of each rank's counts and coordinate info.
+    */
+    void gather_distributed_mesh_metadata(const MeshInfo &my_info, MeshMetaData &out) const;
+
     void gather_values(int nrows,
         int *rank_counts,
         int *rank_offsets,
@@ -119,6 +127,25 @@ protected:
         const MeshInfo &my_info,
         Node &output) const;
 
+    /**
+    @brief Moves table rows between ranks so each rank holds an equal share
+        of the rows while keeping the global row order.
+    @param table The table to rebalance, its values are replaced.
+    @param rank_counts The number of rows in the table on each rank.
+    @return The global index of the first row on this rank after rebalancing.
+    */
+    index_t rebalance_table(Node &table,
+        const std::vector<index_t> &rank_counts) const;
+
+    /**
+    @brief Flattens the local domains into a table partition on each rank
+        without gathering the rows to root.
+    */
+    void flatten_distributed(const Node &mesh,
+        const FieldInfo &global_field_info,
+        MeshInfo &my_mesh_info,
+        Node &output) const;
+
     virtual void cleanup_output(Node &output) const override;
 
     virtual void flatten_many_domains(const Node &mesh,
@@ -128,6 +155,8 @@ protected:
     int root;
     int rank;
     bool add_rank;
+    bool distributed;
+    bool rebalance;
 };
 
 }
@@ -103,13 +103,16 @@ PyBlueprint_mesh_verify(PyObject *, //self
     
     bool res = false;
     
-    if(protocol != NULL)
     {
-        res = blueprint::mesh::verify(std::string(protocol), node,info);
-    }
-    else
-    {
-        res = blueprint::mesh::verify(node,info);
+        PyConduit_Allow_Threads allow_threads(py_node, py_info);
+        if(protocol != NULL)
+        {
+            res = blueprint::mesh::verify(std::string(protocol), node,info);
+        }
+        else
+        {
+            res = blueprint::mesh::verify(node,info);
+        }
     }
 
     if(res)
@@ -188,10 +191,13 @@ PyBlueprint_mesh_generate_index(PyObject *, //self
     Node &dest = *PyConduit_Node_Get_Node_Ptr(py_dest);
     
 
-    blueprint::mesh::generate_index(mesh,
-                                    std::string(ref_path),
-                                    num_domains,
-                                    dest);
+    {
+        PyConduit_Allow_Threads allow_threads(py_mesh, py_dest);
+        blueprint::mesh::generate_index(mesh,
+                                        std::string(ref_path),
+                                        num_domains,
+                                        dest);
+    }
 
     Py_RETURN_NONE;
 }
@@ -270,9 +276,12 @@ PyBlueprint_mesh_partition(PyObject *, //self
     Node &options = *PyConduit_Node_Get_Node_Ptr(py_options);
     Node &output = *PyConduit_Node_Get_Node_Ptr(py_output);
 
-    blueprint::mesh::partition(mesh,
-                               options,
-                               output);
+    {
+        PyConduit_Allow_Threads allow_threads(py_mesh, py_options, py_output);
+        blueprint::mesh::partition(mesh,
+                                   options,
+                                   output);
+    }
 
     Py_RETURN_NONE;
 }
@@ -345,7 +354,10 @@ PyBlueprint_mesh_flatten(PyObject *, //self
     const Node &options = *PyConduit_Node_Get_Node_Ptr(py_options);
     Node &output = *PyConduit_Node_Get_Node_Ptr(py_output);
 
-    blueprint::mesh::flatten(mesh, options, output);
+    {
+        PyConduit_Allow_Threads allow_threads(py_mesh, py_options, py_output);
+        blueprint::mesh::flatten(mesh, options, output);
+    }
 
     Py_RETURN_NONE;
 }
@@ -2500,6 +2500,50 @@ CONDUIT_API char* conduit_node_to_summary_string_with_options(const conduit_node
     //-------------------------------------------------------------------------
     CONDUIT_API const conduit_datatype *conduit_node_dtype(const conduit_node *cnode);
 
+//-----------------------------------------------------------------------------
+// -- leaf descriptor interface --
+//-----------------------------------------------------------------------------
+// Describes every leaf in a subtree in one pass, so host codes can cache
+// direct data access instead of fetching each path on each use.
+//
+// The descriptors and their path strings live in a single allocation, which
+// must be released with conduit_leaf_descriptors_destroy(). They stay valid
+// until the tree's structure or data allocations change.
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+typedef struct
+{
+    /// null terminated path of the leaf relative to the node described, in
+    /// the same form as conduit_node_path()
+    const char      *path;
+    /// length of path, not including the null terminator
+    conduit_index_t  path_length;
+    conduit_index_t  dtype_id;
+    conduit_index_t  number_of_elements;
+    /// bytes from the start of the leaf's buffer to element 0
+    conduit_index_t  offset;
+    /// bytes between elements
+    conduit_index_t  stride;
+    conduit_index_t  element_bytes;
+    conduit_index_t  endianness;
+    /// address of element 0 (offset is already applied)
+    void            *data_ptr;
+    /// the leaf node itself
+    conduit_node    *node;
+} conduit_leaf_descriptor;
+
+//-----------------------------------------------------------------------------
+/// Returns descriptors for all leaves under cnode, in depth first order,
+/// and sets num_leaves. Object, list, and empty nodes are not leaves. If
+/// cnode is itself a leaf it is described with an empty path. Returns NULL
+/// when there are no leaves.
+CONDUIT_API conduit_leaf_descriptor *conduit_node_leaf_descriptors(conduit_node *cnode,
+                                                                   conduit_index_t *num_leaves);
+
+//-----------------------------------------------------------------------------
+CONDUIT_API void conduit_leaf_descriptors_destroy(conduit_leaf_descriptor *descs);
+
 #ifdef __cplusplus
 }
 #endif
@@ -14,6 +14,8 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <string>
+#include <vector>
 
 #ifdef CONDUIT_PLATFORM_WINDOWS
     #define _conduit_strdup _strdup
@@ -4906,6 +4908,117 @@ conduit_node_dtype(const conduit_node *cnode)
     return c_datatype(&(cpp_node(cnode)->dtype()));
 }
 
+//-----------------------------------------------------------------------------
+// -- leaf descriptor interface --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+conduit_leaf_descriptor *
+conduit_node_leaf_descriptors(conduit_node *cnode,
+                              conduit_index_t *num_leaves)
+{
+    Node *root = cpp_node(cnode);
+
+    // gather leaves and their paths depth first
+    std::vector<Node*> leaves;
+    std::vector<std::string> paths;
+    std::vector<std::pair<Node*,std::string> > stack;
+    stack.push_back(std::make_pair(root,std::string()));
+    while(!stack.empty())
+    {
+        Node *curr = stack.back().first;
+        std::string curr_path = stack.back().second;
+        stack.pop_back();
+
+        const DataType &dtype = curr->dtype();
+        if(dtype.is_object() || dtype.is_list())
+        {
+            // push in reverse so children come out in order
+            for(index_t i = curr->number_of_children() - 1; i >= 0; i--)
+            {
+                Node *child = curr->child_ptr(i);
+                std::string child_path = curr_path;
+                if(!child_path.empty())
+                {
+                    child_path += "/";
+                }
+
+                // same form as Node::path()
+                if(dtype.is_object())
+                {
+                    const std::string &name = curr->schema().child_name(i);
+                    if(name.find('/') != std::string::npos)
+                    {
+                        child_path += "{" + name + "}";
+                    }
+                    else
+                    {
+                        child_path += name;
+                    }
+                }
+                else
+                {
+                    child_path += "[" + std::to_string(i) + "]";
+                }
+                stack.push_back(std::make_pair(child,child_path));
+            }
+        }
+        else if(!dtype.is_empty())
+        {
+            leaves.push_back(curr);
+            paths.push_back(curr_path);
+        }
+    }
+
+    *num_leaves = (conduit_index_t)leaves.size();
+    if(leaves.empty())
+    {
+        return NULL;
+    }
+
+    // one allocation: the descriptors followed by the path strings
+    size_t descs_bytes = leaves.size() * sizeof(conduit_leaf_descriptor);
+    size_t total_bytes = descs_bytes;
+    for(size_t i = 0; i < paths.size(); i++)
+    {
+        total_bytes += paths[i].size() + 1;
+    }
+
+    char *mem = (char*)malloc(total_bytes);
+    conduit_leaf_descriptor *descs = (conduit_leaf_descriptor*)mem;
+    char *path_ptr = mem + descs_bytes;
+
+    for(size_t i = 0; i < leaves.size(); i++)
+    {
+        Node *leaf = leaves[i];
+        const DataType &dtype = leaf->dtype();
+        conduit_leaf_descriptor &desc = descs[i];
+
+        memcpy(path_ptr, paths[i].c_str(), paths[i].size() + 1);
+        desc.path               = path_ptr;
+        desc.path_length        = (conduit_index_t)paths[i].size();
+        path_ptr += paths[i].size() + 1;
+
+        desc.dtype_id           = dtype.id();
+        desc.number_of_elements = dtype.number_of_elements();
+        desc.offset             = dtype.offset();
+        desc.stride             = dtype.stride();
+        desc.element_bytes      = dtype.element_bytes();
+        desc.endianness         = dtype.endianness();
+        desc.data_ptr           = leaf->element_ptr(0);
+        desc.node               = c_node(leaf);
+    }
+
+    return descs;
+}
+
+//-----------------------------------------------------------------------------
+void
+conduit_leaf_descriptors_destroy(conduit_leaf_descriptor *descs)
+{
+    free(descs);
+}
+
 }
 //-----------------------------------------------------------------------------
 // -- end extern C
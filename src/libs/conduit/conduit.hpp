@@ -26,6 +26,7 @@
 #include "conduit_generator.hpp"
 #include "conduit_utils.hpp"
 #include "conduit_data_accessor.hpp"
+#include "conduit_data_convert.hpp"
 
 #endif
 
@@ -22,6 +22,7 @@
 //-----------------------------------------------------------------------------
 #include "conduit_node.hpp"
 #include "conduit_utils.hpp"
+#include "conduit_data_convert.hpp"
 #include "conduit_log.hpp"
 
 // Easier access to the Conduit logging functions
@@ -1676,11 +1677,12 @@ template <typename T>
 void            
 DataArray<T>::set(const DataArray<int8> &values)
 { 
-    index_t num_elems = m_dtype.number_of_elements();
-    for(index_t i=0; i <num_elems; i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    utils::convert_elements(&utils::detail::convert_kernel<T,int8>,
+                            element_ptr(0),
+                            m_dtype.stride(),
+                            values.element_ptr(0),
+                            values.dtype().stride(),
+                            m_dtype.number_of_elements());
 }
 
 //---------------------------------------------------------------------------//
@@ -1688,11 +1690,12 @@ template <typename T>
 void            
 DataArray<T>::set(const DataArray<int16> &values)
 { 
-    index_t num_elems = m_dtype.number_of_elements();
-    for(index_t i=0; i <num_elems; i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    utils::convert_elements(&utils::detail::convert_kernel<T,int16>,
+                            element_ptr(0),
+                            m_dtype.stride(),
+                            values.element_ptr(0),
+                            values.dtype().stride(),
+                            m_dtype.number_of_elements());
 }
 
 //---------------------------------------------------------------------------//
@@ -1700,11 +1703,12 @@ template <typename T>
 void            
 DataArray<T>::set(const DataArray<int32> &values)
 { 
-    index_t num_elems = m_dtype.number_of_elements();
-    for(index_t i=0; i <num_elems; i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    utils::convert_elements(&utils::detail::convert_kernel<T,int32>,
+                            element_ptr(0),
+                            m_dtype.stride(),
+                            values.element_ptr(0),
+                            values.dtype().stride(),
+                            m_dtype.number_of_elements());
 }
 
 //---------------------------------------------------------------------------//
@@ -1712,11 +1716,12 @@ template <typename T>
 void            
 DataArray<T>::set(const DataArray<int64> &values)
 { 
-    index_t num_elems = m_dtype.number_of_elements();
-    for(index_t i=0; i <num_elems; i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    utils::convert_elements(&utils::detail::convert_kernel<T,int64>,
+                            element_ptr(0),
+                            m_dtype.stride(),
+                            values.element_ptr(0),
+                            values.dtype().stride(),
+                            m_dtype.number_of_elements());
 }
 
 //---------------------------------------------------------------------------//
@@ -1728,11 +1733,12 @@ template <typename T>
 void            
 DataArray<T>::set(const DataArray<uint8> &values)
 { 
-    index_t num_elems = m_dtype.number_of_elements();
-    for(index_t i=0; i <num_elems; i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    utils::convert_elements(&utils::detail::convert_kernel<T,uint8>,
+                            element_ptr(0),
+                            m_dtype.stride(),
+                            values.element_ptr(0),
+                            values.dtype().stride(),
+                            m_dtype.number_of_elements());
 }
 
 //---------------------------------------------------------------------------//
@@ -1740,11 +1746,12 @@ template <typename T>
 void            
 DataArray<T>::set(const DataArray<uint16> &values)
 { 
-    index_t num_elems = m_dtype.number_of_elements();
-    for(index_t i=0; i <num_elems; i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    utils::convert_elements(&utils::detail::convert_kernel<T,uint16>,
+                            element_ptr(0),
+                            m_dtype.stride(),
+                            values.element_ptr(0),
+                            values.dtype().stride(),
+                            m_dtype.number_of_elements());
 }
 
 //---------------------------------------------------------------------------//
@@ -1752,11 +1759,12 @@ template <typename T>
 void            
 DataArray<T>::set(const DataArray<uint32> &values)
 { 
-    index_t num_elems = m_dtype.number_of_elements();
-    for(index_t i=0; i <num_elems; i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    utils::convert_elements(&utils::detail::convert_kernel<T,uint32>,
+                            element_ptr(0),
+                            m_dtype.stride(),
+                            values.element_ptr(0),
+                            values.dtype().stride(),
+                            m_dtype.number_of_elements());
 }
 
 //---------------------------------------------------------------------------//
@@ -1764,11 +1772,12 @@ template <typename T>
 void            
 DataArray<T>::set(const DataArray<uint64> &values)
 { 
-    index_t num_elems = m_dtype.number_of_elements();
-    for(index_t i=0; i <num_elems; i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    utils::convert_elements(&utils::detail::convert_kernel<T,uint64>,
+                            element_ptr(0),
+                            m_dtype.stride(),
+                            values.element_ptr(0),
+                            values.dtype().stride(),
+                            m_dtype.number_of_elements());
 }
 
 //---------------------------------------------------------------------------//
@@ -1780,11 +1789,12 @@ template <typename T>
 void            
 DataArray<T>::set(const DataArray<float32> &values)
 { 
-    index_t num_elems = m_dtype.number_of_elements();
-    for(index_t i=0; i <num_elems; i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    utils::convert_elements(&utils::detail::convert_kernel<T,float32>,
+                            element_ptr(0),
+                            m_dtype.stride(),
+                            values.element_ptr(0),
+                            values.dtype().stride(),
+                            m_dtype.number_of_elements());
 }
 
 //---------------------------------------------------------------------------//
@@ -1792,11 +1802,12 @@ template <typename T>
 void            
 DataArray<T>::set(const DataArray<float64> &values)
 { 
-    index_t num_elems = m_dtype.number_of_elements();
-    for(index_t i=0; i <num_elems; i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    utils::convert_elements(&utils::detail::convert_kernel<T,float64>,
+                            element_ptr(0),
+                            m_dtype.stride(),
+                            values.element_ptr(0),
+                            values.dtype().stride(),
+                            m_dtype.number_of_elements());
 }
 
 
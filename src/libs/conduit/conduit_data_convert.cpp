@@ -0,0 +1,218 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_data_convert.cpp
+///
+//-----------------------------------------------------------------------------
+#include "conduit_data_convert.hpp"
+
+//-----------------------------------------------------------------------------
+// -- standard lib includes --
+//-----------------------------------------------------------------------------
+#include <algorithm>
+
+//-----------------------------------------------------------------------------
+// -- conduit includes --
+//-----------------------------------------------------------------------------
+#include "conduit_data_type.hpp"
+#include "conduit_error.hpp"
+#include "conduit_execution.hpp"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::utils --
+//-----------------------------------------------------------------------------
+namespace utils
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::utils::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+// conversions with at least this many elements are split into blocks
+static const index_t CONVERT_PARALLEL_ELEMENTS = 1024 * 1024;
+static const index_t CONVERT_BLOCK_ELEMENTS    = 64 * 1024;
+
+static const int     NUM_NUMERIC_TYPES = 10;
+
+//---------------------------------------------------------------------------//
+// maps a numeric dtype id to its row or column in the kernel table,
+// returns -1 for non numeric ids
+//---------------------------------------------------------------------------//
+static int
+numeric_type_index(index_t dtype_id)
+{
+    switch(dtype_id)
+    {
+        case DataType::INT8_ID:    return 0;
+        case DataType::INT16_ID:   return 1;
+        case DataType::INT32_ID:   return 2;
+        case DataType::INT64_ID:   return 3;
+        case DataType::UINT8_ID:   return 4;
+        case DataType::UINT16_ID:  return 5;
+        case DataType::UINT32_ID:  return 6;
+        case DataType::UINT64_ID:  return 7;
+        case DataType::FLOAT32_ID: return 8;
+        case DataType::FLOAT64_ID: return 9;
+        default:                   return -1;
+    }
+}
+
+//---------------------------------------------------------------------------//
+// fills the kernels that convert from each numeric type to D,
+// in numeric_type_index order
+//---------------------------------------------------------------------------//
+template <typename D>
+static void
+fill_convert_kernel_row(ConvertKernel *row)
+{
+    row[0] = &convert_kernel<D,int8>;
+    row[1] = &convert_kernel<D,int16>;
+    row[2] = &convert_kernel<D,int32>;
+    row[3] = &convert_kernel<D,int64>;
+    row[4] = &convert_kernel<D,uint8>;
+    row[5] = &convert_kernel<D,uint16>;
+    row[6] = &convert_kernel<D,uint32>;
+    row[7] = &convert_kernel<D,uint64>;
+    row[8] = &convert_kernel<D,float32>;
+    row[9] = &convert_kernel<D,float64>;
+}
+
+//---------------------------------------------------------------------------//
+struct ConvertKernelTable
+{
+    ConvertKernelTable()
+    {
+        fill_convert_kernel_row<int8>(kernels[0]);
+        fill_convert_kernel_row<int16>(kernels[1]);
+        fill_convert_kernel_row<int32>(kernels[2]);
+        fill_convert_kernel_row<int64>(kernels[3]);
+        fill_convert_kernel_row<uint8>(kernels[4]);
+        fill_convert_kernel_row<uint16>(kernels[5]);
+        fill_convert_kernel_row<uint32>(kernels[6]);
+        fill_convert_kernel_row<uint64>(kernels[7]);
+        fill_convert_kernel_row<float32>(kernels[8]);
+        fill_convert_kernel_row<float64>(kernels[9]);
+    }
+
+    // indexed by [dest][src]
+    ConvertKernel kernels[NUM_NUMERIC_TYPES][NUM_NUMERIC_TYPES];
+};
+
+//---------------------------------------------------------------------------//
+static const ConvertKernelTable &
+convert_kernel_table()
+{
+    // function local static, initialized once on first use
+    static const ConvertKernelTable table;
+    return table;
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::utils::detail --
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+ConvertKernel
+convert_kernel(index_t dest_dtype_id,
+               index_t src_dtype_id)
+{
+    int dest_idx = detail::numeric_type_index(dest_dtype_id);
+    int src_idx  = detail::numeric_type_index(src_dtype_id);
+
+    if(dest_idx < 0 || src_idx < 0)
+    {
+        return NULL;
+    }
+
+    return detail::convert_kernel_table().kernels[dest_idx][src_idx];
+}
+
+//---------------------------------------------------------------------------//
+void
+convert_elements(ConvertKernel kernel,
+                 void *dest,
+                 index_t dest_stride,
+                 const void *src,
+                 index_t src_stride,
+                 index_t num_elements)
+{
+    if(num_elements < detail::CONVERT_PARALLEL_ELEMENTS)
+    {
+        kernel(dest, dest_stride, src, src_stride, num_elements);
+        return;
+    }
+
+    index_t num_blocks = (num_elements + detail::CONVERT_BLOCK_ELEMENTS - 1)
+                         / detail::CONVERT_BLOCK_ELEMENTS;
+
+    uint8 *dest_bytes = static_cast<uint8*>(dest);
+    const uint8 *src_bytes = static_cast<const uint8*>(src);
+
+#if defined(CONDUIT_USE_OPENMP)
+    using policy = conduit::execution::OpenMPExec;
+#else
+    using policy = conduit::execution::SerialExec;
+#endif
+    conduit::execution::for_all<policy>(0, num_blocks, [&](index_t b)
+    {
+        index_t start = b * detail::CONVERT_BLOCK_ELEMENTS;
+        index_t count = std::min(detail::CONVERT_BLOCK_ELEMENTS,
+                                 num_elements - start);
+        kernel(dest_bytes + start * dest_stride,
+               dest_stride,
+               src_bytes  + start * src_stride,
+               src_stride,
+               count);
+    });
+}
+
+//---------------------------------------------------------------------------//
+void
+convert_elements(index_t dest_dtype_id,
+                 void *dest,
+                 index_t dest_stride,
+                 index_t src_dtype_id,
+                 const void *src,
+                 index_t src_stride,
+                 index_t num_elements)
+{
+    ConvertKernel kernel = convert_kernel(dest_dtype_id, src_dtype_id);
+
+    if(kernel == NULL)
+    {
+        CONDUIT_ERROR("Cannot convert from type "
+                      << DataType::id_to_name(src_dtype_id)
+                      << " to type "
+                      << DataType::id_to_name(dest_dtype_id)
+                      << ", only numeric types can be converted.");
+    }
+
+    convert_elements(kernel,
+                     dest,
+                     dest_stride,
+                     src,
+                     src_stride,
+                     num_elements);
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::utils --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
@@ -0,0 +1,142 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_data_convert.hpp
+///
+//-----------------------------------------------------------------------------
+
+#ifndef CONDUIT_DATA_CONVERT_HPP
+#define CONDUIT_DATA_CONVERT_HPP
+
+//-----------------------------------------------------------------------------
+// -- standard lib includes --
+//-----------------------------------------------------------------------------
+#include <cstring>
+
+//-----------------------------------------------------------------------------
+// -- conduit includes --
+//-----------------------------------------------------------------------------
+#include "conduit_core.hpp"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::utils --
+//-----------------------------------------------------------------------------
+namespace utils
+{
+
+//-----------------------------------------------------------------------------
+/// Numeric type conversion.
+///
+/// Conversions between the ten bitwidth style numeric types are done by
+/// kernels from a table with one entry per (dest, src) type pair.
+/// Each kernel casts num_elements values from src to dest, element by
+/// element, with the same semantics as a C-style cast.
+/// Contiguous, aligned buffers use a plain typed loop that the compiler
+/// can vectorize, other buffers use a strided loop.
+///
+/// The kernels assume host memory and native endianness.
+/// When dest and src have the same element size, dest may alias src, so
+/// a buffer can be converted in place.
+//-----------------------------------------------------------------------------
+    typedef void (*ConvertKernel)(void *dest,
+                                  index_t dest_stride,
+                                  const void *src,
+                                  index_t src_stride,
+                                  index_t num_elements);
+
+    // returns the kernel that converts from src_dtype_id to dest_dtype_id,
+    // or NULL if either id is not a numeric type id
+    ConvertKernel CONDUIT_API convert_kernel(index_t dest_dtype_id,
+                                             index_t src_dtype_id);
+
+    // runs a conversion kernel, splitting large conversions into blocks
+    // that run in parallel when OpenMP is enabled
+    void CONDUIT_API convert_elements(ConvertKernel kernel,
+                                      void *dest,
+                                      index_t dest_stride,
+                                      const void *src,
+                                      index_t src_stride,
+                                      index_t num_elements);
+
+    // looks up the kernel for the given type ids and runs it,
+    // throws an error if either id is not a numeric type id
+    void CONDUIT_API convert_elements(index_t dest_dtype_id,
+                                      void *dest,
+                                      index_t dest_stride,
+                                      index_t src_dtype_id,
+                                      const void *src,
+                                      index_t src_stride,
+                                      index_t num_elements);
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::utils::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+    //-------------------------------------------------------------------------
+    // conversion kernel for a (dest, src) type pair, also used by DataArray
+    // for its typed set() overloads
+    //-------------------------------------------------------------------------
+    template <typename D, typename S>
+    void
+    convert_kernel(void *dest,
+                   index_t dest_stride,
+                   const void *src,
+                   index_t src_stride,
+                   index_t num_elements)
+    {
+        // the typed loop assumes dest and src do not alias,
+        // in place conversions use the byte wise loop
+        if(dest != src &&
+           dest_stride == (index_t)sizeof(D) &&
+           src_stride  == (index_t)sizeof(S) &&
+           ((size_t)dest) % alignof(D) == 0 &&
+           ((size_t)src)  % alignof(S) == 0)
+        {
+            D *dest_vals = static_cast<D*>(dest);
+            const S *src_vals = static_cast<const S*>(src);
+            for(index_t i = 0; i < num_elements; i++)
+            {
+                dest_vals[i] = (D)src_vals[i];
+            }
+        }
+        else
+        {
+            uint8 *dest_bytes = static_cast<uint8*>(dest);
+            const uint8 *src_bytes = static_cast<const uint8*>(src);
+            for(index_t i = 0; i < num_elements; i++)
+            {
+                S src_val;
+                memcpy(&src_val, src_bytes + i * src_stride, sizeof(S));
+                D dest_val = (D)src_val;
+                memcpy(dest_bytes + i * dest_stride, &dest_val, sizeof(D));
+            }
+        }
+    }
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::utils::detail --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::utils --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
+
+#endif
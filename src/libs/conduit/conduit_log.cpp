@@ -35,12 +35,33 @@ namespace utils
 namespace log
 {
 
+//-----------------------------------------------------------------------------
+static thread_local bool log_messages_enabled = true;
+
+//-----------------------------------------------------------------------------
+void
+set_messages_enabled(bool value)
+{
+    log_messages_enabled = value;
+}
+
+//-----------------------------------------------------------------------------
+bool
+messages_enabled()
+{
+    return log_messages_enabled;
+}
+
 //-----------------------------------------------------------------------------
 void
 info(Node &info,
      const std::string &proto_name,
      const std::string &msg)
 {
+    if(!log_messages_enabled)
+    {
+        return;
+    }
     info["info"].append().set(proto_name + ": " + msg);
 }
 
@@ -50,6 +71,10 @@ optional(Node &info,
          const std::string &proto_name,
          const std::string &msg)
 {
+    if(!log_messages_enabled)
+    {
+        return;
+    }
     info["optional"].append().set(proto_name + ": " + msg);
 }
 
@@ -59,6 +84,10 @@ error(Node &info,
       const std::string &proto_name,
       const std::string &msg)
 {
+    if(!log_messages_enabled)
+    {
+        return;
+    }
     info["errors"].append().set(proto_name + ": " + msg);
 }
 
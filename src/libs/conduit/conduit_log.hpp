@@ -54,6 +54,14 @@ void CONDUIT_API validation(conduit::Node &info,
                             bool res);
 
 
+//-----------------------------------------------------------------------------
+/// Enables or disables the message producing calls (info, optional, error)
+/// on the calling thread. validation() results are always recorded since
+/// verify implementations read back "valid" flags of referenced entries.
+//-----------------------------------------------------------------------------
+void CONDUIT_API set_messages_enabled(bool value);
+bool CONDUIT_API messages_enabled();
+
 //-----------------------------------------------------------------------------
 void CONDUIT_API remove_valid(conduit::Node &info);
 //-----------------------------------------------------------------------------
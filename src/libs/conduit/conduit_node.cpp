@@ -46,6 +46,7 @@
 //-----------------------------------------------------------------------------
 #include "conduit_error.hpp"
 #include "conduit_utils.hpp"
+#include "conduit_data_convert.hpp"
 
 // Easier access to the Conduit logging functions
 using namespace conduit::utils;
@@ -9808,1567 +9809,271 @@ Node::to_long_double() const
 //---------------------------------------------------------------------------//
 
 //---------------------------------------------------------------------------//
-/// convert array to a signed integer arrays
-//---------------------------------------------------------------------------//
-
+// helper used by the to_*_array methods, converts the elements of src into a
+// new compact array in res using the numeric conversion kernel table
 //---------------------------------------------------------------------------//
-void
-Node::to_int8_array(Node &res)  const
+static void
+convert_to_array(const Node &src,
+                 const DataType &res_dtype,
+                 const std::string &res_array_name,
+                 Node &res)
 {
-    res.set(DataType::int8(dtype().number_of_elements()));
-    int8_array res_array = res.as_int8_array();
+    utils::ConvertKernel kernel = utils::convert_kernel(res_dtype.id(),
+                                                        src.dtype().id());
+    res.set(res_dtype);
 
-    switch(dtype().id())
+    if(kernel == NULL)
     {
-        /* ints */
-        case DataType::INT8_ID:
-        {
-            res_array.set(this->as_int8_array());
-            break;
-        }
-        case DataType::INT16_ID:
-        {
-            res_array.set(this->as_int16_array());
-            break;
-        }
-        case DataType::INT32_ID:
-        {
-            res_array.set(this->as_int32_array());
-            break;
-        }
-        case DataType::INT64_ID:
-        {
-            res_array.set(this->as_int64_array());
-            break;
-        }
-        /* uints */
-        case DataType::UINT8_ID:
-        {
-            res_array.set(this->as_uint8_array());
-            break;
-        }
-        case DataType::UINT16_ID:
-        {
-            res_array.set(this->as_uint16_array());
-            break;
-        }
-        case DataType::UINT32_ID:
-        {
-            res_array.set(this->as_uint32_array());
-            break;
-        }
-        case DataType::UINT64_ID:
-        {
-            res_array.set(this->as_uint64_array());
-            break;
-        }
-        /* floats */
-        case DataType::FLOAT32_ID:
-        {
-            res_array.set(this->as_float32_array());
-            break;
-        }
-        case DataType::FLOAT64_ID:
-        {
-            res_array.set(this->as_float64_array());
-            break;
-        }
-        default:
-        {
-            // error
-            CONDUIT_ERROR("Cannot convert non numeric "
-                        << dtype().name()
-                        << " type to int8_array.");
-        }
+        // error
+        CONDUIT_ERROR("Cannot convert non numeric "
+                    << src.dtype().name()
+                    << " type to " << res_array_name << ".");
     }
 
+    utils::convert_elements(kernel,
+                            res.element_ptr(0),
+                            res_dtype.stride(),
+                            src.element_ptr(0),
+                            src.dtype().stride(),
+                            res_dtype.number_of_elements());
 }
 
+//---------------------------------------------------------------------------//
+/// convert array to a signed integer arrays
+//---------------------------------------------------------------------------//
+
 //---------------------------------------------------------------------------//
 void
-Node::to_int16_array(Node &res) const
+Node::to_int8_array(Node &res) const
 {
-    res.set(DataType::int16(dtype().number_of_elements()));
-
-    int16_array res_array = res.as_int16_array();
+    convert_to_array(*this,
+                     DataType::int8(dtype().number_of_elements()),
+                     "int8_array",
+                     res);
+}
 
-    switch(dtype().id())
-    {
-        /* ints */
-        case DataType::INT8_ID:
-        {
-            res_array.set(this->as_int8_array());
-            break;
-        }
-        case DataType::INT16_ID:
-        {
-            res_array.set(this->as_int16_array());
-            break;
-        }
-        case DataType::INT32_ID:
-        {
-            res_array.set(this->as_int32_array());
-            break;
-        }
-        case DataType::INT64_ID:
-        {
-            res_array.set(this->as_int64_array());
-            break;
-        }
-        /* uints */
-        case DataType::UINT8_ID:
-        {
-            res_array.set(this->as_uint8_array());
-            break;
-        }
-        case DataType::UINT16_ID:
-        {
-            res_array.set(this->as_uint16_array());
-            break;
-        }
-        case DataType::UINT32_ID:
-        {
-            res_array.set(this->as_uint32_array());
-            break;
-        }
-        case DataType::UINT64_ID:
-        {
-            res_array.set(this->as_uint64_array());
-            break;
-        }
-        /* floats */
-        case DataType::FLOAT32_ID:
-        {
-            res_array.set(this->as_float32_array());
-            break;
-        }
-        case DataType::FLOAT64_ID:
-        {
-            res_array.set(this->as_float64_array());
-            break;
-        }
-        default:
-        {
-            // error
-            CONDUIT_ERROR("Cannot convert non numeric "
-                        << dtype().name()
-                        << " type to int16_array.");
-        }
-    }
+//---------------------------------------------------------------------------//
+void
+Node::to_int16_array(Node &res) const
+{
+    convert_to_array(*this,
+                     DataType::int16(dtype().number_of_elements()),
+                     "int16_array",
+                     res);
 }
 
 //---------------------------------------------------------------------------//
 void
 Node::to_int32_array(Node &res) const
 {
-    res.set(DataType::int32(dtype().number_of_elements()));
+    convert_to_array(*this,
+                     DataType::int32(dtype().number_of_elements()),
+                     "int32_array",
+                     res);
+}
 
-    int32_array res_array = res.as_int32_array();
+//---------------------------------------------------------------------------//
+void
+Node::to_int64_array(Node &res) const
+{
+    convert_to_array(*this,
+                     DataType::int64(dtype().number_of_elements()),
+                     "int64_array",
+                     res);
+}
 
-    switch(dtype().id())
-    {
-        /* ints */
-        case DataType::INT8_ID:
-        {
-            res_array.set(this->as_int8_array());
-            break;
-        }
-        case DataType::INT16_ID:
-        {
-            res_array.set(this->as_int16_array());
-            break;
-        }
-        case DataType::INT32_ID:
-        {
-            res_array.set(this->as_int32_array());
-            break;
-        }
-        case DataType::INT64_ID:
-        {
-            res_array.set(this->as_int64_array());
-            break;
-        }
-        /* uints */
-        case DataType::UINT8_ID:
-        {
-            res_array.set(this->as_uint8_array());
-            break;
-        }
-        case DataType::UINT16_ID:
-        {
-            res_array.set(this->as_uint16_array());
-            break;
-        }
-        case DataType::UINT32_ID:
-        {
-            res_array.set(this->as_uint32_array());
-            break;
-        }
-        case DataType::UINT64_ID:
-        {
-            res_array.set(this->as_uint64_array());
-            break;
-        }
-        /* floats */
-        case DataType::FLOAT32_ID:
-        {
-            res_array.set(this->as_float32_array());
-            break;
-        }
-        case DataType::FLOAT64_ID:
-        {
-            res_array.set(this->as_float64_array());
-            break;
-        }
-        default:
-        {
-            // error
-            CONDUIT_ERROR("Cannot convert non numeric "
-                        << dtype().name()
-                        << " type to int32_array.");
-        }
-    }
+//---------------------------------------------------------------------------//
+/// convert array to a unsigned integer arrays
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+void
+Node::to_uint8_array(Node &res) const
+{
+    convert_to_array(*this,
+                     DataType::uint8(dtype().number_of_elements()),
+                     "uint8_array",
+                     res);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::to_int64_array(Node &res) const
+Node::to_uint16_array(Node &res) const
 {
-    res.set(DataType::int64(dtype().number_of_elements()));
+    convert_to_array(*this,
+                     DataType::uint16(dtype().number_of_elements()),
+                     "uint16_array",
+                     res);
+}
 
-    int64_array res_array = res.as_int64_array();
+//---------------------------------------------------------------------------//
+void
+Node::to_uint32_array(Node &res) const
+{
+    convert_to_array(*this,
+                     DataType::uint32(dtype().number_of_elements()),
+                     "uint32_array",
+                     res);
+}
 
-    switch(dtype().id())
-    {
-        /* ints */
-        case DataType::INT8_ID:
-        {
-            res_array.set(this->as_int8_array());
-            break;
-        }
-        case DataType::INT16_ID:
-        {
-            res_array.set(this->as_int16_array());
-            break;
-        }
-        case DataType::INT32_ID:
-        {
-            res_array.set(this->as_int32_array());
-            break;
-        }
-        case DataType::INT64_ID:
-        {
-            res_array.set(this->as_int64_array());
-            break;
-        }
-        /* uints */
-        case DataType::UINT8_ID:
-        {
-            res_array.set(this->as_uint8_array());
-            break;
-        }
-        case DataType::UINT16_ID:
-        {
-            res_array.set(this->as_uint16_array());
-            break;
-        }
-        case DataType::UINT32_ID:
-        {
-            res_array.set(this->as_uint32_array());
-            break;
-        }
-        case DataType::UINT64_ID:
-        {
-            res_array.set(this->as_uint64_array());
-            break;
-        }
-        /* floats */
-        case DataType::FLOAT32_ID:
-        {
-            res_array.set(this->as_float32_array());
-            break;
-        }
-        case DataType::FLOAT64_ID:
-        {
-            res_array.set(this->as_float64_array());
-            break;
-        }
-        default:
-        {
-            // error
-            CONDUIT_ERROR("Cannot convert non numeric "
-                        << dtype().name()
-                        << " type to int64_array.");
-        }
-    }
+//---------------------------------------------------------------------------//
+void
+Node::to_uint64_array(Node &res) const
+{
+    convert_to_array(*this,
+                     DataType::uint64(dtype().number_of_elements()),
+                     "uint64_array",
+                     res);
 }
 
 //---------------------------------------------------------------------------//
-/// convert array to a unsigned integer arrays
+/// convert array to floating point arrays
 //---------------------------------------------------------------------------//
+void
+Node::to_float32_array(Node &res) const
+{
+    convert_to_array(*this,
+                     DataType::float32(dtype().number_of_elements()),
+                     "float32_array",
+                     res);
+}
 
 //---------------------------------------------------------------------------//
 void
-Node::to_uint8_array(Node &res)  const
+Node::to_float64_array(Node &res) const
 {
-    res.set(DataType::uint8(dtype().number_of_elements()));
+    convert_to_array(*this,
+                     DataType::float64(dtype().number_of_elements()),
+                     "float64_array",
+                     res);
+}
 
-    uint8_array res_array = res.as_uint8_array();
+//---------------------------------------------------------------------------//
+/// convert array to the index type
+//---------------------------------------------------------------------------//
 
-    switch(dtype().id())
-    {
-        /* ints */
-        case DataType::INT8_ID:
-        {
-            res_array.set(this->as_int8_array());
-            break;
-        }
-        case DataType::INT16_ID:
-        {
-            res_array.set(this->as_int16_array());
-            break;
-        }
-        case DataType::INT32_ID:
-        {
-            res_array.set(this->as_int32_array());
-            break;
-        }
-        case DataType::INT64_ID:
-        {
-            res_array.set(this->as_int64_array());
-            break;
-        }
-        /* uints */
-        case DataType::UINT8_ID:
-        {
-            res_array.set(this->as_uint8_array());
-            break;
-        }
-        case DataType::UINT16_ID:
-        {
-            res_array.set(this->as_uint16_array());
-            break;
-        }
-        case DataType::UINT32_ID:
-        {
-            res_array.set(this->as_uint32_array());
-            break;
-        }
-        case DataType::UINT64_ID:
-        {
-            res_array.set(this->as_uint64_array());
-            break;
-        }
-        /* floats */
-        case DataType::FLOAT32_ID:
-        {
-            res_array.set(this->as_float32_array());
-            break;
-        }
-        case DataType::FLOAT64_ID:
-        {
-            res_array.set(this->as_float64_array());
-            break;
-        }
-        default:
-        {
-            // error
-            CONDUIT_ERROR("Cannot convert non numeric "
-                        << dtype().name()
-                        << " type to uint8_array.");
-        }
-    }
-}
-
-//---------------------------------------------------------------------------//
-void
-Node::to_uint16_array(Node &res) const
-{
-    res.set(DataType::uint16(dtype().number_of_elements()));
-
-    uint16_array res_array = res.as_uint16_array();
-
-    switch(dtype().id())
-    {
-        /* ints */
-        case DataType::INT8_ID:
-        {
-            res_array.set(this->as_int8_array());
-            break;
-        }
-        case DataType::INT16_ID:
-        {
-            res_array.set(this->as_int16_array());
-            break;
-        }
-        case DataType::INT32_ID:
-        {
-            res_array.set(this->as_int32_array());
-            break;
-        }
-        case DataType::INT64_ID:
-        {
-            res_array.set(this->as_int64_array());
-            break;
-        }
-        /* uints */
-        case DataType::UINT8_ID:
-        {
-            res_array.set(this->as_uint8_array());
-            break;
-        }
-        case DataType::UINT16_ID:
-        {
-            res_array.set(this->as_uint16_array());
-            break;
-        }
-        case DataType::UINT32_ID:
-        {
-            res_array.set(this->as_uint32_array());
-            break;
-        }
-        case DataType::UINT64_ID:
-        {
-            res_array.set(this->as_uint64_array());
-            break;
-        }
-        /* floats */
-        case DataType::FLOAT32_ID:
-        {
-            res_array.set(this->as_float32_array());
-            break;
-        }
-        case DataType::FLOAT64_ID:
-        {
-            res_array.set(this->as_float64_array());
-            break;
-        }
-        default:
-        {
-            // error
-            CONDUIT_ERROR("Cannot convert non numeric "
-                        << dtype().name()
-                        << " type to uint16_array.");
-        }
-    }
-}
-
-//---------------------------------------------------------------------------//
-void
-Node::to_uint32_array(Node &res) const
-{
-    res.set(DataType::uint32(dtype().number_of_elements()));
-
-    uint32_array res_array = res.as_uint32_array();
-
-    switch(dtype().id())
-    {
-        /* ints */
-        case DataType::INT8_ID:
-        {
-            res_array.set(this->as_int8_array());
-            break;
-        }
-        case DataType::INT16_ID:
-        {
-            res_array.set(this->as_int16_array());
-            break;
-        }
-        case DataType::INT32_ID:
-        {
-            res_array.set(this->as_int32_array());
-            break;
-        }
-        case DataType::INT64_ID:
-        {
-            res_array.set(this->as_int64_array());
-            break;
-        }
-        /* uints */
-        case DataType::UINT8_ID:
-        {
-            res_array.set(this->as_uint8_array());
-            break;
-        }
-        case DataType::UINT16_ID:
-        {
-            res_array.set(this->as_uint16_array());
-            break;
-        }
-        case DataType::UINT32_ID:
-        {
-            res_array.set(this->as_uint32_array());
-            break;
-        }
-        case DataType::UINT64_ID:
-        {
-            res_array.set(this->as_uint64_array());
-            break;
-        }
-        /* floats */
-        case DataType::FLOAT32_ID:
-        {
-            res_array.set(this->as_float32_array());
-            break;
-        }
-        case DataType::FLOAT64_ID:
-        {
-            res_array.set(this->as_float64_array());
-            break;
-        }
-        default:
-        {
-            // error
-            CONDUIT_ERROR("Cannot convert non numeric "
-                        << dtype().name()
-                        << " type to uint32_array.");
-        }
-    }
-
-}
-
-//---------------------------------------------------------------------------//
-void
-Node::to_uint64_array(Node &res) const
-{
-    res.set(DataType::uint64(dtype().number_of_elements()));
-
-    uint64_array res_array = res.as_uint64_array();
-
-    switch(dtype().id())
-    {
-        /* ints */
-        case DataType::INT8_ID:
-        {
-            res_array.set(this->as_int8_array());
-            break;
-        }
-        case DataType::INT16_ID:
-        {
-            res_array.set(this->as_int16_array());
-            break;
-        }
-        case DataType::INT32_ID:
-        {
-            res_array.set(this->as_int32_array());
-            break;
-        }
-        case DataType::INT64_ID:
-        {
-            res_array.set(this->as_int64_array());
-            break;
-        }
-        /* uints */
-        case DataType::UINT8_ID:
-        {
-            res_array.set(this->as_uint8_array());
-            break;
-        }
-        case DataType::UINT16_ID:
-        {
-            res_array.set(this->as_uint16_array());
-            break;
-        }
-        case DataType::UINT32_ID:
-        {
-            res_array.set(this->as_uint32_array());
-            break;
-        }
-        case DataType::UINT64_ID:
-        {
-            res_array.set(this->as_uint64_array());
-            break;
-        }
-        /* floats */
-        case DataType::FLOAT32_ID:
-        {
-            res_array.set(this->as_float32_array());
-            break;
-        }
-        case DataType::FLOAT64_ID:
-        {
-            res_array.set(this->as_float64_array());
-            break;
-        }
-        default:
-        {
-            // error
-            CONDUIT_ERROR("Cannot convert non numeric "
-                        << dtype().name()
-                        << " type to uint64_array.");
-        }
-    }
-
-}
-
-//---------------------------------------------------------------------------//
-/// convert array to floating point arrays
-//---------------------------------------------------------------------------//
-void
-Node::to_float32_array(Node &res) const
-{
-    res.set(DataType::float32(dtype().number_of_elements()));
-
-    float32_array res_array = res.as_float32_array();
-
-    switch(dtype().id())
-    {
-        /* ints */
-        case DataType::INT8_ID:
-        {
-            res_array.set(this->as_int8_array());
-            break;
-        }
-        case DataType::INT16_ID:
-        {
-            res_array.set(this->as_int16_array());
-            break;
-        }
-        case DataType::INT32_ID:
-        {
-            res_array.set(this->as_int32_array());
-            break;
-        }
-        case DataType::INT64_ID:
-        {
-            res_array.set(this->as_int64_array());
-            break;
-        }
-        /* uints */
-        case DataType::UINT8_ID:
-        {
-            res_array.set(this->as_uint8_array());
-            break;
-        }
-        case DataType::UINT16_ID:
-        {
-            res_array.set(this->as_uint16_array());
-            break;
-        }
-        case DataType::UINT32_ID:
-        {
-            res_array.set(this->as_uint32_array());
-            break;
-        }
-        case DataType::UINT64_ID:
-        {
-            res_array.set(this->as_uint64_array());
-            break;
-        }
-        /* floats */
-        case DataType::FLOAT32_ID:
-        {
-            res_array.set(this->as_float32_array());
-            break;
-        }
-        case DataType::FLOAT64_ID:
-        {
-            res_array.set(this->as_float64_array());
-            break;
-        }
-        default:
-        {
-            // error
-            CONDUIT_ERROR("Cannot convert non numeric "
-                        << dtype().name()
-                        << " type to float32_array.");
-        }
-    }
-
-}
-
-//---------------------------------------------------------------------------//
-void
-Node::to_float64_array(Node &res) const
-{
-    res.set(DataType::float64(dtype().number_of_elements()));
-
-    float64_array res_array = res.as_float64_array();
-
-    switch(dtype().id())
-    {
-        /* ints */
-        case DataType::INT8_ID:
-        {
-            res_array.set(this->as_int8_array());
-            break;
-        }
-        case DataType::INT16_ID:
-        {
-            res_array.set(this->as_int16_array());
-            break;
-        }
-        case DataType::INT32_ID:
-        {
-            res_array.set(this->as_int32_array());
-            break;
-        }
-        case DataType::INT64_ID:
-        {
-            res_array.set(this->as_int64_array());
-            break;
-        }
-        /* uints */
-        case DataType::UINT8_ID:
-        {
-            res_array.set(this->as_uint8_array());
-            break;
-        }
-        case DataType::UINT16_ID:
-        {
-            res_array.set(this->as_uint16_array());
-            break;
-        }
-        case DataType::UINT32_ID:
-        {
-            res_array.set(this->as_uint32_array());
-            break;
-        }
-        case DataType::UINT64_ID:
-        {
-            res_array.set(this->as_uint64_array());
-            break;
-        }
-        /* floats */
-        case DataType::FLOAT32_ID:
-        {
-            res_array.set(this->as_float32_array());
-            break;
-        }
-        case DataType::FLOAT64_ID:
-        {
-            res_array.set(this->as_float64_array());
-            break;
-        }
-        default:
-        {
-            // error
-            CONDUIT_ERROR("Cannot convert non numeric "
-                        << dtype().name()
-                        << " type to float64_array.");
-        }
-    }
-}
-
-//---------------------------------------------------------------------------//
-/// convert array to the index type
-//---------------------------------------------------------------------------//
-
-//---------------------------------------------------------------------------//
-void
-Node::to_index_t_array(Node &res) const
-{
-    res.set(DataType::index_t(dtype().number_of_elements()));
-
-    index_t_array res_array = res.as_index_t_array();
-
-    switch(dtype().id())
-    {
-        /* ints */
-        case DataType::INT8_ID:
-        {
-            res_array.set(this->as_int8_array());
-            break;
-        }
-        case DataType::INT16_ID:
-        {
-            res_array.set(this->as_int16_array());
-            break;
-        }
-        case DataType::INT32_ID:
-        {
-            res_array.set(this->as_int32_array());
-            break;
-        }
-        case DataType::INT64_ID:
-        {
-            res_array.set(this->as_int64_array());
-            break;
-        }
-        /* uints */
-        case DataType::UINT8_ID:
-        {
-            res_array.set(this->as_uint8_array());
-            break;
-        }
-        case DataType::UINT16_ID:
-        {
-            res_array.set(this->as_uint16_array());
-            break;
-        }
-        case DataType::UINT32_ID:
-        {
-            res_array.set(this->as_uint32_array());
-            break;
-        }
-        case DataType::UINT64_ID:
-        {
-            res_array.set(this->as_uint64_array());
-            break;
-        }
-        /* floats */
-        case DataType::FLOAT32_ID:
-        {
-            res_array.set(this->as_float32_array());
-            break;
-        }
-        case DataType::FLOAT64_ID:
-        {
-            res_array.set(this->as_float64_array());
-            break;
-        }
-        default:
-        {
-            // error
-            CONDUIT_ERROR("Cannot convert non numeric "
-                        << dtype().name()
-                        << " type to float64_array.");
-        }
-    }
-}
-
-//---------------------------------------------------------------------------//
-/// convert array to c signed integer arrays
-//---------------------------------------------------------------------------//
-
-//---------------------------------------------------------------------------//
-void
-Node::to_char_array(Node &res) const
-{
-    res.set(DataType::c_char(dtype().number_of_elements()));
-
-    char_array res_array = res.as_char_array();
-
-    switch(dtype().id())
-    {
-        /* ints */
-        case DataType::INT8_ID:
-        {
-            res_array.set(this->as_int8_array());
-            break;
-        }
-        case DataType::INT16_ID:
-        {
-            res_array.set(this->as_int16_array());
-            break;
-        }
-        case DataType::INT32_ID:
-        {
-            res_array.set(this->as_int32_array());
-            break;
-        }
-        case DataType::INT64_ID:
-        {
-            res_array.set(this->as_int64_array());
-            break;
-        }
-        /* uints */
-        case DataType::UINT8_ID:
-        {
-            res_array.set(this->as_uint8_array());
-            break;
-        }
-        case DataType::UINT16_ID:
-        {
-            res_array.set(this->as_uint16_array());
-            break;
-        }
-        case DataType::UINT32_ID:
-        {
-            res_array.set(this->as_uint32_array());
-            break;
-        }
-        case DataType::UINT64_ID:
-        {
-            res_array.set(this->as_uint64_array());
-            break;
-        }
-        /* floats */
-        case DataType::FLOAT32_ID:
-        {
-            res_array.set(this->as_float32_array());
-            break;
-        }
-        case DataType::FLOAT64_ID:
-        {
-            res_array.set(this->as_float64_array());
-            break;
-        }
-        default:
-        {
-            // error
-            CONDUIT_ERROR("Cannot convert non numeric "
-                        << dtype().name()
-                        << " type to char_array.");
-        }
-    }
-}
-
-//---------------------------------------------------------------------------//
-void
-Node::to_short_array(Node &res) const
-{
-    res.set(DataType::c_short(dtype().number_of_elements()));
-
-    short_array res_array = res.as_short_array();
-
-    switch(dtype().id())
-    {
-        /* ints */
-        case DataType::INT8_ID:
-        {
-            res_array.set(this->as_int8_array());
-            break;
-        }
-        case DataType::INT16_ID:
-        {
-            res_array.set(this->as_int16_array());
-            break;
-        }
-        case DataType::INT32_ID:
-        {
-            res_array.set(this->as_int32_array());
-            break;
-        }
-        case DataType::INT64_ID:
-        {
-            res_array.set(this->as_int64_array());
-            break;
-        }
-        /* uints */
-        case DataType::UINT8_ID:
-        {
-            res_array.set(this->as_uint8_array());
-            break;
-        }
-        case DataType::UINT16_ID:
-        {
-            res_array.set(this->as_uint16_array());
-            break;
-        }
-        case DataType::UINT32_ID:
-        {
-            res_array.set(this->as_uint32_array());
-            break;
-        }
-        case DataType::UINT64_ID:
-        {
-            res_array.set(this->as_uint64_array());
-            break;
-        }
-        /* floats */
-        case DataType::FLOAT32_ID:
-        {
-            res_array.set(this->as_float32_array());
-            break;
-        }
-        case DataType::FLOAT64_ID:
-        {
-            res_array.set(this->as_float64_array());
-            break;
-        }
-        default:
-        {
-            // error
-            CONDUIT_ERROR("Cannot convert non numeric "
-                        << dtype().name()
-                        << " type to short_array.");
-        }
-    }
-}
-
-//---------------------------------------------------------------------------//
-void
-Node::to_int_array(Node &res) const
-{
-    res.set(DataType::c_int(dtype().number_of_elements()));
-
-    int_array res_array = res.as_int_array();
-
-    switch(dtype().id())
-    {
-        /* ints */
-        case DataType::INT8_ID:
-        {
-            res_array.set(this->as_int8_array());
-            break;
-        }
-        case DataType::INT16_ID:
-        {
-            res_array.set(this->as_int16_array());
-            break;
-        }
-        case DataType::INT32_ID:
-        {
-            res_array.set(this->as_int32_array());
-            break;
-        }
-        case DataType::INT64_ID:
-        {
-            res_array.set(this->as_int64_array());
-            break;
-        }
-        /* uints */
-        case DataType::UINT8_ID:
-        {
-            res_array.set(this->as_uint8_array());
-            break;
-        }
-        case DataType::UINT16_ID:
-        {
-            res_array.set(this->as_uint16_array());
-            break;
-        }
-        case DataType::UINT32_ID:
-        {
-            res_array.set(this->as_uint32_array());
-            break;
-        }
-        case DataType::UINT64_ID:
-        {
-            res_array.set(this->as_uint64_array());
-            break;
-        }
-        /* floats */
-        case DataType::FLOAT32_ID:
-        {
-            res_array.set(this->as_float32_array());
-            break;
-        }
-        case DataType::FLOAT64_ID:
-        {
-            res_array.set(this->as_float64_array());
-            break;
-        }
-        default:
-        {
-            // error
-            CONDUIT_ERROR("Cannot convert non numeric "
-                        << dtype().name()
-                        << " type to int_array.");
-        }
-    }
-}
-
-//---------------------------------------------------------------------------//
-void
-Node::to_long_array(Node &res) const
-{
-    res.set(DataType::c_long(dtype().number_of_elements()));
-
-    long_array res_array = res.as_long_array();
-
-    switch(dtype().id())
-    {
-        /* ints */
-        case DataType::INT8_ID:
-        {
-            res_array.set(this->as_int8_array());
-            break;
-        }
-        case DataType::INT16_ID:
-        {
-            res_array.set(this->as_int16_array());
-            break;
-        }
-        case DataType::INT32_ID:
-        {
-            res_array.set(this->as_int32_array());
-            break;
-        }
-        case DataType::INT64_ID:
-        {
-            res_array.set(this->as_int64_array());
-            break;
-        }
-        /* uints */
-        case DataType::UINT8_ID:
-        {
-            res_array.set(this->as_uint8_array());
-            break;
-        }
-        case DataType::UINT16_ID:
-        {
-            res_array.set(this->as_uint16_array());
-            break;
-        }
-        case DataType::UINT32_ID:
-        {
-            res_array.set(this->as_uint32_array());
-            break;
-        }
-        case DataType::UINT64_ID:
-        {
-            res_array.set(this->as_uint64_array());
-            break;
-        }
-        /* floats */
-        case DataType::FLOAT32_ID:
-        {
-            res_array.set(this->as_float32_array());
-            break;
-        }
-        case DataType::FLOAT64_ID:
-        {
-            res_array.set(this->as_float64_array());
-            break;
-        }
-        default:
-        {
-            // error
-            CONDUIT_ERROR("Cannot convert non numeric "
-                        << dtype().name()
-                        << " type to long_array.");
-        }
-    }
-}
-
-//---------------------------------------------------------------------------//
-#ifdef CONDUIT_HAS_LONG_LONG
 //---------------------------------------------------------------------------//
 void
-Node::to_signed_long_long_array(Node &res) const
+Node::to_index_t_array(Node &res) const
 {
-    res.set(DataType::c_signed_long_long(dtype().number_of_elements()));
-
-    signed_long_long_array res_array = res.as_signed_long_long_array();
-
-    switch(dtype().id())
-    {
-        /* ints */
-        case DataType::INT8_ID:
-        {
-            res_array.set(this->as_int8_array());
-            break;
-        }
-        case DataType::INT16_ID:
-        {
-            res_array.set(this->as_int16_array());
-            break;
-        }
-        case DataType::INT32_ID:
-        {
-            res_array.set(this->as_int32_array());
-            break;
-        }
-        case DataType::INT64_ID:
-        {
-            res_array.set(this->as_int64_array());
-            break;
-        }
-        /* uints */
-        case DataType::UINT8_ID:
-        {
-            res_array.set(this->as_uint8_array());
-            break;
-        }
-        case DataType::UINT16_ID:
-        {
-            res_array.set(this->as_uint16_array());
-            break;
-        }
-        case DataType::UINT32_ID:
-        {
-            res_array.set(this->as_uint32_array());
-            break;
-        }
-        case DataType::UINT64_ID:
-        {
-            res_array.set(this->as_uint64_array());
-            break;
-        }
-        /* floats */
-        case DataType::FLOAT32_ID:
-        {
-            res_array.set(this->as_float32_array());
-            break;
-        }
-        case DataType::FLOAT64_ID:
-        {
-            res_array.set(this->as_float64_array());
-            break;
-        }
-        default:
-        {
-            // error
-            CONDUIT_ERROR("Cannot convert non numeric "
-                        << dtype().name()
-                        << " type to unsigned_long_array.");
-        }
-    }
+    convert_to_array(*this,
+                     DataType::index_t(dtype().number_of_elements()),
+                     "float64_array",
+                     res);
 }
+
 //---------------------------------------------------------------------------//
-#endif
+/// convert array to c signed integer arrays
 //---------------------------------------------------------------------------//
 
-
-//---------------------------------------------------------------------------//
-/// convert array to c unsigned integer arrays
 //---------------------------------------------------------------------------//
 void
-Node::to_unsigned_char_array(Node &res) const
+Node::to_char_array(Node &res) const
 {
-    res.set(DataType::c_unsigned_char(dtype().number_of_elements()));
-
-    unsigned_char_array res_array = res.as_unsigned_char_array();
-
-    switch(dtype().id())
-    {
-        /* ints */
-        case DataType::INT8_ID:
-        {
-            res_array.set(this->as_int8_array());
-            break;
-        }
-        case DataType::INT16_ID:
-        {
-            res_array.set(this->as_int16_array());
-            break;
-        }
-        case DataType::INT32_ID:
-        {
-            res_array.set(this->as_int32_array());
-            break;
-        }
-        case DataType::INT64_ID:
-        {
-            res_array.set(this->as_int64_array());
-            break;
-        }
-        /* uints */
-        case DataType::UINT8_ID:
-        {
-            res_array.set(this->as_uint8_array());
-            break;
-        }
-        case DataType::UINT16_ID:
-        {
-            res_array.set(this->as_uint16_array());
-            break;
-        }
-        case DataType::UINT32_ID:
-        {
-            res_array.set(this->as_uint32_array());
-            break;
-        }
-        case DataType::UINT64_ID:
-        {
-            res_array.set(this->as_uint64_array());
-            break;
-        }
-        /* floats */
-        case DataType::FLOAT32_ID:
-        {
-            res_array.set(this->as_float32_array());
-            break;
-        }
-        case DataType::FLOAT64_ID:
-        {
-            res_array.set(this->as_float64_array());
-            break;
-        }
-        default:
-        {
-            // error
-            CONDUIT_ERROR("Cannot convert non numeric "
-                        << dtype().name()
-                        << " type to unsigned_char_array.");
-        }
-    }
+    convert_to_array(*this,
+                     DataType::c_char(dtype().number_of_elements()),
+                     "char_array",
+                     res);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::to_unsigned_short_array(Node &res) const
+Node::to_short_array(Node &res) const
 {
-    res.set(DataType::c_unsigned_short(dtype().number_of_elements()));
-
-    unsigned_short_array res_array = res.as_unsigned_short_array();
-
-    switch(dtype().id())
-    {
-        /* ints */
-        case DataType::INT8_ID:
-        {
-            res_array.set(this->as_int8_array());
-            break;
-        }
-        case DataType::INT16_ID:
-        {
-            res_array.set(this->as_int16_array());
-            break;
-        }
-        case DataType::INT32_ID:
-        {
-            res_array.set(this->as_int32_array());
-            break;
-        }
-        case DataType::INT64_ID:
-        {
-            res_array.set(this->as_int64_array());
-            break;
-        }
-        /* uints */
-        case DataType::UINT8_ID:
-        {
-            res_array.set(this->as_uint8_array());
-            break;
-        }
-        case DataType::UINT16_ID:
-        {
-            res_array.set(this->as_uint16_array());
-            break;
-        }
-        case DataType::UINT32_ID:
-        {
-            res_array.set(this->as_uint32_array());
-            break;
-        }
-        case DataType::UINT64_ID:
-        {
-            res_array.set(this->as_uint64_array());
-            break;
-        }
-        /* floats */
-        case DataType::FLOAT32_ID:
-        {
-            res_array.set(this->as_float32_array());
-            break;
-        }
-        case DataType::FLOAT64_ID:
-        {
-            res_array.set(this->as_float64_array());
-            break;
-        }
-        default:
-        {
-            // error
-            CONDUIT_ERROR("Cannot convert non numeric "
-                        << dtype().name()
-                        << " type to unsigned_short_array.");
-        }
-    }
+    convert_to_array(*this,
+                     DataType::c_short(dtype().number_of_elements()),
+                     "short_array",
+                     res);
 }
 
 //---------------------------------------------------------------------------//
 void
-Node::to_unsigned_int_array(Node &res) const
+Node::to_int_array(Node &res) const
 {
-    res.set(DataType::c_unsigned_int(dtype().number_of_elements()));
-
-    unsigned_int_array res_array = res.as_unsigned_int_array();
+    convert_to_array(*this,
+                     DataType::c_int(dtype().number_of_elements()),
+                     "int_array",
+                     res);
+}
 
-    switch(dtype().id())
-    {
-        /* ints */
-        case DataType::INT8_ID:
-        {
-            res_array.set(this->as_int8_array());
-            break;
-        }
-        case DataType::INT16_ID:
-        {
-            res_array.set(this->as_int16_array());
-            break;
-        }
-        case DataType::INT32_ID:
-        {
-            res_array.set(this->as_int32_array());
-            break;
-        }
-        case DataType::INT64_ID:
-        {
-            res_array.set(this->as_int64_array());
-            break;
-        }
-        /* uints */
-        case DataType::UINT8_ID:
-        {
-            res_array.set(this->as_uint8_array());
-            break;
-        }
-        case DataType::UINT16_ID:
-        {
-            res_array.set(this->as_uint16_array());
-            break;
-        }
-        case DataType::UINT32_ID:
-        {
-            res_array.set(this->as_uint32_array());
-            break;
-        }
-        case DataType::UINT64_ID:
-        {
-            res_array.set(this->as_uint64_array());
-            break;
-        }
-        /* floats */
-        case DataType::FLOAT32_ID:
-        {
-            res_array.set(this->as_float32_array());
-            break;
-        }
-        case DataType::FLOAT64_ID:
-        {
-            res_array.set(this->as_float64_array());
-            break;
-        }
-        default:
-        {
-            // error
-            CONDUIT_ERROR("Cannot convert non numeric "
-                        << dtype().name()
-                        << " type to unsigned_int_array.");
-        }
-    }
+//---------------------------------------------------------------------------//
+void
+Node::to_long_array(Node &res) const
+{
+    convert_to_array(*this,
+                     DataType::c_long(dtype().number_of_elements()),
+                     "long_array",
+                     res);
 }
 
+//---------------------------------------------------------------------------//
+#ifdef CONDUIT_HAS_LONG_LONG
 //---------------------------------------------------------------------------//
 void
-Node::to_unsigned_long_array(Node &res) const
+Node::to_signed_long_long_array(Node &res) const
 {
-    res.set(DataType::c_unsigned_long(dtype().number_of_elements()));
+    convert_to_array(*this,
+                     DataType::c_signed_long_long(dtype().number_of_elements()),
+                     "unsigned_long_array",
+                     res);
+}
+//---------------------------------------------------------------------------//
+#endif
+//---------------------------------------------------------------------------//
 
-    unsigned_long_array res_array = res.as_unsigned_long_array();
 
-    switch(dtype().id())
-    {
-        /* ints */
-        case DataType::INT8_ID:
-        {
-            res_array.set(this->as_int8_array());
-            break;
-        }
-        case DataType::INT16_ID:
-        {
-            res_array.set(this->as_int16_array());
-            break;
-        }
-        case DataType::INT32_ID:
-        {
-            res_array.set(this->as_int32_array());
-            break;
-        }
-        case DataType::INT64_ID:
-        {
-            res_array.set(this->as_int64_array());
-            break;
-        }
-        /* uints */
-        case DataType::UINT8_ID:
-        {
-            res_array.set(this->as_uint8_array());
-            break;
-        }
-        case DataType::UINT16_ID:
-        {
-            res_array.set(this->as_uint16_array());
-            break;
-        }
-        case DataType::UINT32_ID:
-        {
-            res_array.set(this->as_uint32_array());
-            break;
-        }
-        case DataType::UINT64_ID:
-        {
-            res_array.set(this->as_uint64_array());
-            break;
-        }
-        /* floats */
-        case DataType::FLOAT32_ID:
-        {
-            res_array.set(this->as_float32_array());
-            break;
-        }
-        case DataType::FLOAT64_ID:
-        {
-            res_array.set(this->as_float64_array());
-            break;
-        }
-        default:
-        {
-            // error
-            CONDUIT_ERROR("Cannot convert non numeric "
-                        << dtype().name()
-                        << " type to unsigned_long_array.");
-        }
-    }
+//---------------------------------------------------------------------------//
+/// convert array to c unsigned integer arrays
+//---------------------------------------------------------------------------//
+void
+Node::to_unsigned_char_array(Node &res) const
+{
+    convert_to_array(*this,
+                     DataType::c_unsigned_char(dtype().number_of_elements()),
+                     "unsigned_char_array",
+                     res);
 }
 
 //---------------------------------------------------------------------------//
-#ifdef CONDUIT_HAS_LONG_LONG
+void
+Node::to_unsigned_short_array(Node &res) const
+{
+    convert_to_array(*this,
+                     DataType::c_unsigned_short(dtype().number_of_elements()),
+                     "unsigned_short_array",
+                     res);
+}
+
 //---------------------------------------------------------------------------//
 void
-Node::to_unsigned_long_long_array(Node &res) const
+Node::to_unsigned_int_array(Node &res) const
 {
-    res.set(DataType::c_unsigned_long_long(dtype().number_of_elements()));
+    convert_to_array(*this,
+                     DataType::c_unsigned_int(dtype().number_of_elements()),
+                     "unsigned_int_array",
+                     res);
+}
 
-    unsigned_long_long_array res_array = res.as_unsigned_long_long_array();
+//---------------------------------------------------------------------------//
+void
+Node::to_unsigned_long_array(Node &res) const
+{
+    convert_to_array(*this,
+                     DataType::c_unsigned_long(dtype().number_of_elements()),
+                     "unsigned_long_array",
+                     res);
+}
 
-    switch(dtype().id())
-    {
-        /* ints */
-        case DataType::INT8_ID:
-        {
-            res_array.set(this->as_int8_array());
-            break;
-        }
-        case DataType::INT16_ID:
-        {
-            res_array.set(this->as_int16_array());
-            break;
-        }
-        case DataType::INT32_ID:
-        {
-            res_array.set(this->as_int32_array());
-            break;
-        }
-        case DataType::INT64_ID:
-        {
-            res_array.set(this->as_int64_array());
-            break;
-        }
-        /* uints */
-        case DataType::UINT8_ID:
-        {
-            res_array.set(this->as_uint8_array());
-            break;
-        }
-        case DataType::UINT16_ID:
-        {
-            res_array.set(this->as_uint16_array());
-            break;
-        }
-        case DataType::UINT32_ID:
-        {
-            res_array.set(this->as_uint32_array());
-            break;
-        }
-        case DataType::UINT64_ID:
-        {
-            res_array.set(this->as_uint64_array());
-            break;
-        }
-        /* floats */
-        case DataType::FLOAT32_ID:
-        {
-            res_array.set(this->as_float32_array());
-            break;
-        }
-        case DataType::FLOAT64_ID:
-        {
-            res_array.set(this->as_float64_array());
-            break;
-        }
-        default:
-        {
-            // error
-            CONDUIT_ERROR("Cannot convert non numeric "
-                        << dtype().name()
-                        << " type to unsigned_long_array.");
-        }
-    }
+//---------------------------------------------------------------------------//
+#ifdef CONDUIT_HAS_LONG_LONG
+//---------------------------------------------------------------------------//
+void
+Node::to_unsigned_long_long_array(Node &res) const
+{
+    convert_to_array(*this,
+                     DataType::c_unsigned_long_long(dtype().number_of_elements()),
+                     "unsigned_long_array",
+                     res);
 }
 //---------------------------------------------------------------------------//
 #endif
@@ -11379,147 +10084,20 @@ Node::to_unsigned_long_long_array(Node &res) const
 void
 Node::to_float_array(Node &res) const
 {
-    res.set(DataType::c_float(dtype().number_of_elements()));
-
-    float_array res_array = res.as_float_array();
-
-    switch(dtype().id())
-    {
-        /* ints */
-        case DataType::INT8_ID:
-        {
-            res_array.set(this->as_int8_array());
-            break;
-        }
-        case DataType::INT16_ID:
-        {
-            res_array.set(this->as_int16_array());
-            break;
-        }
-        case DataType::INT32_ID:
-        {
-            res_array.set(this->as_int32_array());
-            break;
-        }
-        case DataType::INT64_ID:
-        {
-            res_array.set(this->as_int64_array());
-            break;
-        }
-        /* uints */
-        case DataType::UINT8_ID:
-        {
-            res_array.set(this->as_uint8_array());
-            break;
-        }
-        case DataType::UINT16_ID:
-        {
-            res_array.set(this->as_uint16_array());
-            break;
-        }
-        case DataType::UINT32_ID:
-        {
-            res_array.set(this->as_uint32_array());
-            break;
-        }
-        case DataType::UINT64_ID:
-        {
-            res_array.set(this->as_uint64_array());
-            break;
-        }
-        /* floats */
-        case DataType::FLOAT32_ID:
-        {
-            res_array.set(this->as_float32_array());
-            break;
-        }
-        case DataType::FLOAT64_ID:
-        {
-            res_array.set(this->as_float64_array());
-            break;
-        }
-        default:
-        {
-            // error
-            CONDUIT_ERROR("Cannot convert non numeric "
-                        << dtype().name()
-                        << " type to float_array.");
-        }
-    }
+    convert_to_array(*this,
+                     DataType::c_float(dtype().number_of_elements()),
+                     "float_array",
+                     res);
 }
 
 //---------------------------------------------------------------------------//
 void
 Node::to_double_array(Node &res) const
 {
-    res.set(DataType::c_double(dtype().number_of_elements()));
-
-    double_array res_array = res.as_double_array();
-
-    switch(dtype().id())
-    {
-        /* ints */
-        case DataType::INT8_ID:
-        {
-            res_array.set(this->as_int8_array());
-            break;
-        }
-        case DataType::INT16_ID:
-        {
-            res_array.set(this->as_int16_array());
-            break;
-        }
-        case DataType::INT32_ID:
-        {
-            res_array.set(this->as_int32_array());
-            break;
-        }
-        case DataType::INT64_ID:
-        {
-            res_array.set(this->as_int64_array());
-            break;
-        }
-        /* uints */
-        case DataType::UINT8_ID:
-        {
-            res_array.set(this->as_uint8_array());
-            break;
-        }
-        case DataType::UINT16_ID:
-        {
-            res_array.set(this->as_uint16_array());
-            break;
-        }
-        case DataType::UINT32_ID:
-        {
-            res_array.set(this->as_uint32_array());
-            break;
-        }
-        case DataType::UINT64_ID:
-        {
-            res_array.set(this->as_uint64_array());
-            break;
-        }
-        /* floats */
-        case DataType::FLOAT32_ID:
-        {
-            res_array.set(this->as_float32_array());
-            break;
-        }
-        case DataType::FLOAT64_ID:
-        {
-            res_array.set(this->as_float64_array());
-            break;
-        }
-        default:
-        {
-            // error
-            CONDUIT_ERROR("Cannot convert non numeric "
-                        << dtype().name()
-                        << " type to double_array.");
-        }
-    }
-
+    convert_to_array(*this,
+                     DataType::c_double(dtype().number_of_elements()),
+                     "double_array",
+                     res);
 }
 
 //---------------------------------------------------------------------------//
@@ -11593,6 +10171,49 @@ Node::to_data_type(index_t dtype_id, Node &res) const
     }
 }
 
+//---------------------------------------------------------------------------//
+void
+Node::convert_to_data_type(index_t dtype_id,
+                           bool in_place_when_same_width)
+{
+    if(dtype().id() == dtype_id)
+    {
+        return;
+    }
+
+    index_t ele_bytes = DataType::default_bytes(dtype_id);
+    utils::ConvertKernel kernel = utils::convert_kernel(dtype_id,
+                                                        dtype().id());
+
+    if(in_place_when_same_width &&
+       kernel != NULL &&
+       dtype().element_bytes() == ele_bytes &&
+       dtype().endianness_matches_machine())
+    {
+        // convert each element over itself and keep the layout
+        // (offset, stride, endianness) of the existing data
+        void *ele_ptr = element_ptr(0);
+        utils::convert_elements(kernel,
+                                ele_ptr,
+                                dtype().stride(),
+                                ele_ptr,
+                                dtype().stride(),
+                                dtype().number_of_elements());
+
+        m_schema->set(DataType(dtype_id,
+                               dtype().number_of_elements(),
+                               dtype().offset(),
+                               dtype().stride(),
+                               ele_bytes,
+                               dtype().endianness()));
+        return;
+    }
+
+    Node res;
+    to_data_type(dtype_id, res);
+    move(res);
+}
+
 //-----------------------------------------------------------------------------
 // -- Value Helper class ---
 //-----------------------------------------------------------------------------
@@ -3279,6 +3279,14 @@ public:
 
     void    to_data_type(index_t dtype_id, Node &res) const;
 
+    /// converts this node's data to the given numeric type.
+    /// If in_place_when_same_width is true and the new type has the same
+    /// element size, the elements are converted in place and the existing
+    /// layout is kept. This overwrites external data.
+    /// Otherwise the node is set to a new compact array.
+    void    convert_to_data_type(index_t dtype_id,
+                                 bool in_place_when_same_width = false);
+
 //-----------------------------------------------------------------------------
 // -- Node::Value Helper class --
 //
@@ -53,6 +53,7 @@
 static const std::string file_path_sep_string(CONDUIT_UTILS_FILE_PATH_SEPARATOR);
 
 #include "conduit.hpp"
+#include "conduit_execution.hpp"
 #include "conduit_fmt/conduit_fmt.h"
 
 
@@ -118,6 +119,16 @@ void (*conduit_handle_memset)(void * ptr,
                               int value,
                               size_t num ) = default_memset_handler;
 
+//-----------------------------------------------------------------------------
+// Private namespace member that holds our strided memcpy callback.
+void (*conduit_handle_memcpy_strided)(void *dest,
+                                      size_t num_elements,
+                                      size_t ele_bytes,
+                                      size_t dest_stride,
+                                      const void *src,
+                                      size_t src_stride)
+                                = default_memcpy_strided_elements_handler;
+
 //-----------------------------------------------------------------------------
 void
 set_memcpy_handler(void(*conduit_hnd_copy)(void*,
@@ -136,6 +147,18 @@ set_memset_handler(void(*conduit_hnd_memset)(void*,
     conduit_handle_memset = conduit_hnd_memset;
 }
 
+//-----------------------------------------------------------------------------
+void
+set_memcpy_strided_elements_handler(void(*conduit_hnd_copy)(void*,
+                                                            size_t,
+                                                            size_t,
+                                                            size_t,
+                                                            const void*,
+                                                            size_t))
+{
+    conduit_handle_memcpy_strided = conduit_hnd_copy;
+}
+
 namespace detail
 {
     //
@@ -279,6 +302,202 @@ void conduit_memset(void *ptr,
 {
     conduit_handle_memset(ptr,value,num);
 }
+//-----------------------------------------------------------------------------
+// Strided copy kernels used by default_memcpy_strided_elements_handler
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+// copies of at least this many bytes are split into blocks and run in
+// parallel (when OpenMP is enabled)
+static const size_t STRIDED_COPY_PARALLEL_BYTES   = 4 * 1024 * 1024;
+static const size_t STRIDED_COPY_BLOCK_ELEMENTS   = 64 * 1024;
+
+//-----------------------------------------------------------------------------
+// copies N byte elements. memcpy with a fixed size compiles to plain loads
+// and stores, so there is no call per element.
+//-----------------------------------------------------------------------------
+template<size_t N>
+inline void
+strided_copy(uint8 *dest,
+             size_t dest_stride,
+             const uint8 *src,
+             size_t src_stride,
+             size_t num_elements)
+{
+    for(size_t i = 0; i < num_elements; i++)
+    {
+        memcpy(dest + i * dest_stride, src + i * src_stride, N);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// same as above, with strides known at compile time, which lets the
+// compiler vectorize common (de)interleaving cases like xyz coordinates.
+//-----------------------------------------------------------------------------
+template<size_t N, size_t DEST_STRIDE, size_t SRC_STRIDE>
+inline void
+strided_copy_fixed(uint8 *dest,
+                   const uint8 *src,
+                   size_t num_elements)
+{
+    for(size_t i = 0; i < num_elements; i++)
+    {
+        memcpy(dest + i * DEST_STRIDE, src + i * SRC_STRIDE, N);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// picks a fixed stride kernel for gathers from (or scatters to) 2, 3 or 4
+// way interleaved data, returns false if there is none
+//-----------------------------------------------------------------------------
+template<size_t N>
+inline bool
+strided_copy_interleaved(uint8 *dest,
+                         size_t dest_stride,
+                         const uint8 *src,
+                         size_t src_stride,
+                         size_t num_elements)
+{
+    if(dest_stride == N)
+    {
+        // gather from interleaved data
+        if(src_stride == 2 * N)
+        {
+            strided_copy_fixed<N,N,2*N>(dest,src,num_elements);
+            return true;
+        }
+        else if(src_stride == 3 * N)
+        {
+            strided_copy_fixed<N,N,3*N>(dest,src,num_elements);
+            return true;
+        }
+        else if(src_stride == 4 * N)
+        {
+            strided_copy_fixed<N,N,4*N>(dest,src,num_elements);
+            return true;
+        }
+    }
+    else if(src_stride == N)
+    {
+        // scatter to interleaved data
+        if(dest_stride == 2 * N)
+        {
+            strided_copy_fixed<N,2*N,N>(dest,src,num_elements);
+            return true;
+        }
+        else if(dest_stride == 3 * N)
+        {
+            strided_copy_fixed<N,3*N,N>(dest,src,num_elements);
+            return true;
+        }
+        else if(dest_stride == 4 * N)
+        {
+            strided_copy_fixed<N,4*N,N>(dest,src,num_elements);
+            return true;
+        }
+    }
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+// serial strided copy, dispatched on element size
+//-----------------------------------------------------------------------------
+static void
+strided_copy_block(uint8 *dest,
+                   size_t dest_stride,
+                   const uint8 *src,
+                   size_t src_stride,
+                   size_t ele_bytes,
+                   size_t num_elements)
+{
+    switch(ele_bytes)
+    {
+        case 1:
+            strided_copy<1>(dest,dest_stride,src,src_stride,num_elements);
+            break;
+        case 2:
+            strided_copy<2>(dest,dest_stride,src,src_stride,num_elements);
+            break;
+        case 4:
+            if(!strided_copy_interleaved<4>(dest,dest_stride,
+                                            src,src_stride,
+                                            num_elements))
+            {
+                strided_copy<4>(dest,dest_stride,src,src_stride,num_elements);
+            }
+            break;
+        case 8:
+            if(!strided_copy_interleaved<8>(dest,dest_stride,
+                                            src,src_stride,
+                                            num_elements))
+            {
+                strided_copy<8>(dest,dest_stride,src,src_stride,num_elements);
+            }
+            break;
+        case 16:
+            strided_copy<16>(dest,dest_stride,src,src_stride,num_elements);
+            break;
+        default:
+            for(size_t i = 0; i < num_elements; i++)
+            {
+                memcpy(dest + i * dest_stride,
+                       src + i * src_stride,
+                       ele_bytes);
+            }
+            break;
+    }
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end detail --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+void
+default_memcpy_strided_elements_handler(void *dest,
+                                        size_t num_elements,
+                                        size_t ele_bytes,
+                                        size_t dest_stride,
+                                        const void *src,
+                                        size_t src_stride)
+{
+    uint8 *dest_ptr = (uint8*) dest;
+    const uint8 *src_ptr = (const uint8*) src;
+
+    size_t num_blocks = (num_elements + detail::STRIDED_COPY_BLOCK_ELEMENTS - 1)
+                        / detail::STRIDED_COPY_BLOCK_ELEMENTS;
+
+    if(num_elements * ele_bytes < detail::STRIDED_COPY_PARALLEL_BYTES ||
+       num_blocks < 2)
+    {
+        detail::strided_copy_block(dest_ptr, dest_stride,
+                                   src_ptr, src_stride,
+                                   ele_bytes,
+                                   num_elements);
+        return;
+    }
+
+#if defined(CONDUIT_USE_OPENMP)
+    using policy = conduit::execution::OpenMPExec;
+#else
+    using policy = conduit::execution::SerialExec;
+#endif
+    conduit::execution::for_all<policy>(0, num_blocks, [&](size_t b)
+    {
+        size_t start = b * detail::STRIDED_COPY_BLOCK_ELEMENTS;
+        size_t count = std::min(detail::STRIDED_COPY_BLOCK_ELEMENTS,
+                                num_elements - start);
+        detail::strided_copy_block(dest_ptr + start * dest_stride,
+                                   dest_stride,
+                                   src_ptr + start * src_stride,
+                                   src_stride,
+                                   ele_bytes,
+                                   count);
+    });
+}
+
 //-----------------------------------------------------------------------------
 void
 conduit_memcpy_strided_elements(void *dest,
@@ -295,8 +514,31 @@ conduit_memcpy_strided_elements(void *dest,
                               src,
                               ele_bytes * num_elements);
     }
-    else // the source or dest are strided in a non compact way
+    else if(conduit_handle_memcpy_strided !=
+            default_memcpy_strided_elements_handler)
+    {
+        // a custom bulk strided handler (for example, for device memory)
+        conduit_handle_memcpy_strided(dest,
+                                      num_elements,
+                                      ele_bytes,
+                                      dest_stride,
+                                      src,
+                                      src_stride);
+    }
+    else if(conduit_handle_memcpy == default_memcpy_handler)
+    {
+        // host memory, use our strided kernels
+        default_memcpy_strided_elements_handler(dest,
+                                                num_elements,
+                                                ele_bytes,
+                                                dest_stride,
+                                                src,
+                                                src_stride);
+    }
+    else // a custom memcpy handler without a strided handler
     {
+        // the memory may not be accessible on the host, so copy each
+        // element with the custom memcpy handler
         char *src_data_ptr  = (char*) src;
         char *dest_data_ptr = (char*) dest;
         for(size_t i=0; i< num_elements; i++)
@@ -299,6 +299,11 @@ namespace utils
                                     const void *source,
                                     size_t num);
 
+    // copies num_elements elements of ele_bytes bytes between strided
+    // buffers. Compact copies use the memcpy handler. Strided copies use
+    // the strided handler if one is set. Otherwise they use the default
+    // kernels when the default memcpy handler is active, or the memcpy
+    // handler once per element when it is not.
     void CONDUIT_API conduit_memcpy_strided_elements(void *dest,
                                                      size_t num_elements,
                                                      size_t ele_bytes,
@@ -306,6 +311,27 @@ namespace utils
                                                      const void *src,
                                                      size_t src_stride);
 
+    // bulk strided copy hook, lets custom memcpy handlers (for example
+    // for device memory) copy strided elements in one call
+    void CONDUIT_API set_memcpy_strided_elements_handler(
+                            void(*conduit_hnd_copy)(void *dest,
+                                                    size_t num_elements,
+                                                    size_t ele_bytes,
+                                                    size_t dest_stride,
+                                                    const void *src,
+                                                    size_t src_stride));
+
+    // default strided copy for host memory: kernels specialized on element
+    // size (1, 2, 4, 8 and 16 bytes) and on common interleaved strides.
+    // Large copies run in parallel when OpenMP is enabled.
+    void CONDUIT_API default_memcpy_strided_elements_handler(
+                                                void *dest,
+                                                size_t num_elements,
+                                                size_t ele_bytes,
+                                                size_t dest_stride,
+                                                const void *src,
+                                                size_t src_stride);
+
     // general memset interface used by conduit
     // NOTE (cyrush): The default memset returns the orig pointer, but
     // other allocators like cuda do not.
@@ -52,6 +52,7 @@
 // -- standard lib includes -- 
 //-----------------------------------------------------------------------------
 #include <iostream>
+#include <map>
 #include <vector>
 
 //---------------------------------------------------------------------------//
@@ -5187,6 +5188,74 @@ PyConduit_Fill_DataArray_From_PyArray(DataArray<T> &conduit_array,
     NpyIter_Deallocate(iter);
 }
 
+//---------------------------------------------------------------------------//
+// Nodes in use by calls that released the GIL (see PyConduit_Allow_Threads),
+// with a count for each node. Only accessed while holding the GIL.
+//---------------------------------------------------------------------------//
+static std::map<const Node*, int> &
+PyConduit_Nodes_In_Use()
+{
+    static std::map<const Node*, int> nodes_in_use;
+    return nodes_in_use;
+}
+
+//---------------------------------------------------------------------------//
+static void
+PyConduit_Node_Begin_Use(Node *n)
+{
+    PyConduit_Nodes_In_Use()[n]++;
+}
+
+//---------------------------------------------------------------------------//
+static void
+PyConduit_Node_End_Use(Node *n)
+{
+    std::map<const Node*, int> &nodes_in_use = PyConduit_Nodes_In_Use();
+    std::map<const Node*, int>::iterator itr = nodes_in_use.find(n);
+    if(itr != nodes_in_use.end() && --itr->second == 0)
+    {
+        nodes_in_use.erase(itr);
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Returns true and sets a RuntimeError if n, one of its parents, or one of
+// its children is in use, so changing n could change data that a call
+// running without the GIL is reading or writing.
+//---------------------------------------------------------------------------//
+static bool
+PyConduit_Node_Check_In_Use(const Node *n)
+{
+    const std::map<const Node*, int> &nodes_in_use = PyConduit_Nodes_In_Use();
+    if(nodes_in_use.empty())
+    {
+        return false;
+    }
+
+    bool in_use = false;
+    for(const Node *p = n; p != NULL && !in_use; p = p->parent())
+    {
+        in_use = nodes_in_use.count(p) > 0;
+    }
+
+    std::map<const Node*, int>::const_iterator itr;
+    for(itr = nodes_in_use.begin(); itr != nodes_in_use.end() && !in_use; ++itr)
+    {
+        for(const Node *p = itr->first; p != NULL && !in_use; p = p->parent())
+        {
+            in_use = (p == n);
+        }
+    }
+
+    if(in_use)
+    {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "Cannot modify a conduit.Node while it is in use "
+                        "by a call running in another thread");
+    }
+    return in_use;
+}
+
 //---------------------------------------------------------------------------//
 // begin Node python special methods
 //---------------------------------------------------------------------------//
@@ -5296,8 +5365,9 @@ PyConduit_Node_GetItem(PyConduit_Node* self,
             Node& node = (*self->node)[ckey];
             retval = PyConduit_Convert_Node_To_Python(node);
         }
-        else
+        else if(!PyConduit_Node_Check_In_Use(self->node))
         {
+            // the [] operator creates missing paths
             retval = PyConduit_Node_Python_Wrap(&(*self->node)[ckey],0);
         }
     
@@ -5354,6 +5424,296 @@ PyConduit_Node_python_attach(PyConduit_Node *self)
 
 //---------------------------------------------------------------------------//
 
+//---------------------------------------------------------------------------//
+// N-dimensional array helpers
+//
+// Conduit leaves are one dimensional. N-d arrays are described using the
+// conventions of conduit::blueprint::ndarray::NDIndex: an object with a
+// "values" leaf and "shape", "offset", and "stride" index_t children. Dim 0
+// is the fastest varying, offset is a logical index, and stride is in
+// elements of "values". Numpy lists its dims slowest varying first, so
+// shapes and strides are reversed when moving between the two.
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+static index_t
+PyConduit_Numpy_Type_To_DataType_Id(int numpy_type)
+{
+    switch(numpy_type)
+    {
+        case NPY_INT8:    return DataType::INT8_ID;
+        case NPY_INT16:   return DataType::INT16_ID;
+        case NPY_INT32:   return DataType::INT32_ID;
+        case NPY_INT64:   return DataType::INT64_ID;
+        case NPY_UINT8:   return DataType::UINT8_ID;
+        case NPY_UINT16:  return DataType::UINT16_ID;
+        case NPY_UINT32:  return DataType::UINT32_ID;
+        case NPY_UINT64:  return DataType::UINT64_ID;
+        case NPY_FLOAT32: return DataType::FLOAT32_ID;
+        case NPY_FLOAT64: return DataType::FLOAT64_ID;
+        default:          return DataType::EMPTY_ID;
+    }
+}
+
+//---------------------------------------------------------------------------//
+static int
+PyConduit_DataType_Id_To_Numpy_Type(index_t dtype_id)
+{
+    switch(dtype_id)
+    {
+        case DataType::INT8_ID:    return NPY_INT8;
+        case DataType::INT16_ID:   return NPY_INT16;
+        case DataType::INT32_ID:   return NPY_INT32;
+        case DataType::INT64_ID:   return NPY_INT64;
+        case DataType::UINT8_ID:   return NPY_UINT8;
+        case DataType::UINT16_ID:  return NPY_UINT16;
+        case DataType::UINT32_ID:  return NPY_UINT32;
+        case DataType::UINT64_ID:  return NPY_UINT64;
+        case DataType::FLOAT32_ID: return NPY_FLOAT32;
+        case DataType::FLOAT64_ID: return NPY_FLOAT64;
+        default:                   return -1;
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Returns true if node is a numeric leaf or an object with a numeric
+// "values" leaf and a "shape".
+//---------------------------------------------------------------------------//
+static bool
+PyConduit_Node_Has_NDArray_Layout(const Node &node)
+{
+    if(node.dtype().is_number())
+    {
+        return true;
+    }
+
+    return node.dtype().is_object() &&
+           node.has_child("values") &&
+           node["values"].dtype().is_number() &&
+           node.has_child("shape") &&
+           node["shape"].dtype().is_integer();
+}
+
+//---------------------------------------------------------------------------//
+// Computes the numpy ordered shape, byte strides, and data pointer for a
+// node with an ndarray layout. A plain numeric leaf is treated as 1-D.
+// Returns false and sets err_msg if the description does not fit the
+// values leaf.
+//---------------------------------------------------------------------------//
+static bool
+PyConduit_Node_NDArray_Layout(Node &node,
+                              std::vector<Py_ssize_t> &np_shape,
+                              std::vector<Py_ssize_t> &np_strides,
+                              char *&data,
+                              std::string &err_msg)
+{
+    np_shape.clear();
+    np_strides.clear();
+    data = NULL;
+
+    if(!PyConduit_Node_Has_NDArray_Layout(node))
+    {
+        err_msg = "Node is not a numeric leaf or an ndarray with "
+                  "'values' and 'shape'";
+        return false;
+    }
+
+    if(node.dtype().is_number())
+    {
+        np_shape.push_back((Py_ssize_t)node.dtype().number_of_elements());
+        np_strides.push_back((Py_ssize_t)node.dtype().stride());
+        data = (char*)node.element_ptr(0);
+        return true;
+    }
+
+    Node &values = node["values"];
+    const index_t_accessor shape = node["shape"].as_index_t_accessor();
+    const index_t ndims = shape.number_of_elements();
+    index_t_accessor offset, stride;
+
+    if(ndims < 1)
+    {
+        err_msg = "ndarray 'shape' is empty";
+        return false;
+    }
+
+    if(node.has_child("offset"))
+    {
+        offset = node["offset"].as_index_t_accessor();
+        if(offset.number_of_elements() != ndims)
+        {
+            err_msg = "ndarray 'offset' and 'shape' differ in length";
+            return false;
+        }
+    }
+
+    if(node.has_child("stride"))
+    {
+        stride = node["stride"].as_index_t_accessor();
+        if(stride.number_of_elements() != ndims)
+        {
+            err_msg = "ndarray 'stride' and 'shape' differ in length";
+            return false;
+        }
+    }
+
+    // gather the NDIndex values, filling defaults the same way NDIndex does
+    std::vector<index_t> nd_shape(ndims), nd_offset(ndims), nd_stride(ndims);
+    index_t total = 1;
+    for(index_t d = 0; d < ndims; d++)
+    {
+        nd_shape[d]  = shape[d];
+        nd_offset[d] = offset.number_of_elements() > 0 ? offset[d] : 0;
+        if(stride.number_of_elements() > 0)
+        {
+            nd_stride[d] = stride[d];
+        }
+        else
+        {
+            nd_stride[d] = (d == 0) ? 1 :
+                nd_stride[d-1] * (nd_offset[d-1] + nd_shape[d-1]);
+        }
+
+        if(nd_shape[d] < 0)
+        {
+            err_msg = "ndarray 'shape' has a negative extent";
+            return false;
+        }
+        total *= nd_shape[d];
+    }
+
+    // the flat index range touched must fit in values
+    index_t flat_start = 0;
+    index_t flat_min   = 0;
+    index_t flat_max   = 0;
+    for(index_t d = 0; d < ndims; d++)
+    {
+        flat_start += nd_offset[d] * nd_stride[d];
+        index_t ext = (nd_shape[d] > 0 ? nd_shape[d] - 1 : 0) * nd_stride[d];
+        if(ext < 0)
+        {
+            flat_min += ext;
+        }
+        else
+        {
+            flat_max += ext;
+        }
+    }
+
+    if(total > 0 &&
+       (flat_start + flat_min < 0 ||
+        flat_start + flat_max >= values.dtype().number_of_elements()))
+    {
+        std::ostringstream oss;
+        oss << "ndarray indexes elements ["
+            << flat_start + flat_min << ", " << flat_start + flat_max
+            << "] but 'values' has "
+            << values.dtype().number_of_elements() << " elements";
+        err_msg = oss.str();
+        return false;
+    }
+
+    const Py_ssize_t elem_stride = (Py_ssize_t)values.dtype().stride();
+    np_shape.resize(ndims);
+    np_strides.resize(ndims);
+    for(index_t d = 0; d < ndims; d++)
+    {
+        np_shape[ndims - 1 - d]   = (Py_ssize_t)nd_shape[d];
+        np_strides[ndims - 1 - d] = (Py_ssize_t)nd_stride[d] * elem_stride;
+    }
+
+    data = (char*)values.data_ptr() +
+           values.dtype().offset() +
+           (Py_ssize_t)flat_start * elem_stride;
+
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+// Points node at the memory of an N-d numpy array, without a copy. The node
+// becomes an ndarray object whose "values" leaf spans every element the
+// array can reach.
+//---------------------------------------------------------------------------//
+static int
+PyConduit_Node_Set_External_NDArray(Node &node,
+                                    PyArrayObject *py_arr)
+{
+    PyArray_Descr *desc = PyArray_DESCR(py_arr);
+    index_t dtype_id = PyConduit_Numpy_Type_To_DataType_Id(desc->type_num);
+
+    if(dtype_id == DataType::EMPTY_ID)
+    {
+        PyErr_SetString(PyExc_TypeError, "Unsupported type");
+        return -1;
+    }
+
+    const int ndims = PyArray_NDIM(py_arr);
+    const npy_intp *np_shape   = PyArray_SHAPE(py_arr);
+    const npy_intp *np_strides = PyArray_STRIDES(py_arr);
+    const index_t itemsize = (index_t)PyArray_ITEMSIZE(py_arr);
+    const index_t num_ele  = (index_t)PyArray_SIZE(py_arr);
+
+    std::vector<index_t> shape(ndims), offset(ndims), stride(ndims);
+    index_t byte_min = 0;
+    index_t byte_max = 0;
+
+    for(int d = 0; d < ndims; d++)
+    {
+        // numpy dim d is NDIndex dim (ndims - 1 - d)
+        const int nd = ndims - 1 - d;
+        const index_t extent = (index_t)np_shape[d];
+        const index_t bstride = (index_t)np_strides[d];
+
+        if(extent > 1 && bstride % itemsize != 0)
+        {
+            PyErr_SetString(PyExc_TypeError,
+                            "set_external requires numpy strides that are"
+                            " multiples of the element size");
+            return -1;
+        }
+
+        shape[nd]  = extent;
+        stride[nd] = (bstride % itemsize == 0) ? bstride / itemsize : 0;
+        offset[nd] = 0;
+
+        if(extent > 1)
+        {
+            if(bstride < 0)
+            {
+                // start at the far end so flat indices stay positive
+                byte_min  += bstride * (extent - 1);
+                offset[nd] = -(extent - 1);
+            }
+            else
+            {
+                byte_max += bstride * (extent - 1);
+            }
+        }
+    }
+
+    index_t num_values = 0;
+    if(num_ele > 0)
+    {
+        num_values = (byte_max - byte_min) / itemsize + 1;
+    }
+
+    char *data = PyArray_BYTES(py_arr) + byte_min;
+
+    node.reset();
+    node["values"].set_external(DataType(dtype_id,
+                                         num_values,
+                                         0,
+                                         itemsize,
+                                         itemsize,
+                                         Endianness::DEFAULT_ID),
+                                data);
+    node["shape"].set(shape);
+    node["offset"].set(offset);
+    node["stride"].set(stride);
+
+    return 0;
+}
+
 //---------------------------------------------------------------------------//
 static PyObject *
 PyConduit_Node_value(PyConduit_Node* self)
@@ -5363,11 +5723,76 @@ PyConduit_Node_value(PyConduit_Node* self)
     return (retval);
 }
 
+//---------------------------------------------------------------------------//
+static PyObject *
+PyConduit_Node_ndarray(PyConduit_Node* self)
+{
+    std::vector<Py_ssize_t> np_shape, np_strides;
+    char *data = NULL;
+    std::string err_msg;
+
+    if(!PyConduit_Node_NDArray_Layout(*self->node,
+                                      np_shape,
+                                      np_strides,
+                                      data,
+                                      err_msg))
+    {
+        PyErr_SetString(PyExc_TypeError, err_msg.c_str());
+        return NULL;
+    }
+
+    const DataType &dtype = self->node->dtype().is_number() ?
+                            self->node->dtype() :
+                            self->node->fetch_existing("values").dtype();
+
+    std::vector<npy_intp> dims(np_shape.begin(), np_shape.end());
+    std::vector<npy_intp> strides(np_strides.begin(), np_strides.end());
+
+    PyArray_Descr *descr =
+        PyArray_DescrFromType(PyConduit_DataType_Id_To_Numpy_Type(dtype.id()));
+
+    if(!dtype.endianness_matches_machine())
+    {
+        PyArray_Descr *swapped = PyArray_DescrNewByteorder(descr, NPY_SWAP);
+        Py_DECREF(descr);
+        descr = swapped;
+    }
+
+    // steals the reference to descr
+    PyObject *retval = PyArray_NewFromDescr(&PyArray_Type,
+                                            descr,
+                                            (int)dims.size(),
+                                            &dims[0],
+                                            &strides[0],
+                                            data,
+                                            NPY_ARRAY_WRITEABLE,
+                                            NULL);
+    if(retval == NULL)
+    {
+        return NULL;
+    }
+
+    // the array keeps this node alive
+    Py_INCREF((PyObject*)self);
+    if(PyArray_SetBaseObject((PyArrayObject*)retval, (PyObject*)self) != 0)
+    {
+        Py_DECREF(retval);
+        return NULL;
+    }
+
+    return retval;
+}
+
 //---------------------------------------------------------------------------//
 static PyObject *
 PyConduit_Node_generate(PyConduit_Node* self,
                         PyObject* args)
 {
+    if(PyConduit_Node_Check_In_Use(self->node))
+    {
+        return NULL;
+    }
+
     /// TODO: sigs to support
     /// schema
     /// schema, protocol
@@ -5413,6 +5838,11 @@ PyConduit_Node_parse(PyConduit_Node *self,
                      PyObject *args,
                      PyObject *kwargs)
 {
+    if(PyConduit_Node_Check_In_Use(self->node))
+    {
+        return NULL;
+    }
+
     const char *text = NULL;
     const char *protocol  = NULL;
     
@@ -5509,6 +5939,11 @@ PyConduit_Node_load(PyConduit_Node *self,
                     PyObject *args,
                     PyObject *kwargs)
 {
+    if(PyConduit_Node_Check_In_Use(self->node))
+    {
+        return NULL;
+    }
+
     PyObject   *py_schema = NULL;
     const char *path      = NULL;
     const char *protocol  = NULL;
@@ -5591,6 +6026,11 @@ static PyObject *
 PyConduit_Node_mmap(PyConduit_Node* self,
                     PyObject* args)
 {
+    if(PyConduit_Node_Check_In_Use(self->node))
+    {
+        return NULL;
+    }
+
     /// TODO: sigs to support via kwargs: path, or path and schema
     const char *ibase;     
     if (!PyArg_ParseTuple(args, "s", &ibase))
@@ -5622,6 +6062,13 @@ PyConduit_Node_fetch(PyConduit_Node* self,
          return NULL;
      }
 
+    // fetch creates missing paths
+    if(!self->node->has_path(path) &&
+       PyConduit_Node_Check_In_Use(self->node))
+    {
+        return NULL;
+    }
+
     try
     {
         retval = PyConduit_Node_Python_Wrap(&(*self->node).fetch(path),
@@ -5685,6 +6132,13 @@ PyConduit_Node_add_child(PyConduit_Node *self,
         return (NULL);
     }
 
+    // add_child creates missing children
+    if(!self->node->has_child(name) &&
+       PyConduit_Node_Check_In_Use(self->node))
+    {
+        return NULL;
+    }
+
     try
     {
         retval = PyConduit_Node_Python_Wrap(&(*self->node).add_child(std::string(name)),
@@ -5845,6 +6299,11 @@ PyConduit_Node_child_names(PyConduit_Node *self)
 static PyObject *
 PyConduit_Node_append(PyConduit_Node* self)
 {
+    if(PyConduit_Node_Check_In_Use(self->node))
+    {
+        return NULL;
+    }
+
     return  PyConduit_Node_Python_Wrap(&(self->node->append()),0);
 }
 
@@ -5855,6 +6314,11 @@ PyConduit_Node_remove(PyConduit_Node *self,
                       PyObject *args,
                       PyObject *kwargs)
 {
+    if(PyConduit_Node_Check_In_Use(self->node))
+    {
+        return NULL;
+    }
+
     Py_ssize_t idx=-1;
     const char *path = NULL;
 
@@ -5902,6 +6366,11 @@ PyConduit_Node_remove_child(PyConduit_Node *self,
                             PyObject *args,
                             PyObject *kwargs)
 {
+    if(PyConduit_Node_Check_In_Use(self->node))
+    {
+        return NULL;
+    }
+
     const char *name = NULL;
 
     static const char *kwlist[] = {"name", NULL};
@@ -5935,6 +6404,11 @@ PyConduit_Node_rename_child(PyConduit_Node *self,
                             PyObject *args,
                             PyObject *kwargs)
 {
+    if(PyConduit_Node_Check_In_Use(self->node))
+    {
+        return NULL;
+    }
+
     const char *curr_name = NULL;
     const char *new_name = NULL;
 
@@ -6240,6 +6714,11 @@ static int PyConduit_Node_SetItem(PyConduit_Node *self,
                                   PyObject *key,
                                   PyObject *value)
 {
+    if(PyConduit_Node_Check_In_Use(self->node))
+    {
+        return (-1);
+    }
+
     if (!PyString_Check(key))
     {
         PyErr_SetString(PyExc_TypeError, "Key must be a string");
@@ -6269,6 +6748,11 @@ PyConduit_Node_iter(PyObject *self)
 static PyObject *
 PyConduit_Node_reset(PyConduit_Node *self)
 {
+    if(PyConduit_Node_Check_In_Use(self->node))
+    {
+        return NULL;
+    }
+
     self->node->reset();
     Py_RETURN_NONE;
 }
@@ -6279,6 +6763,11 @@ PyConduit_Node_move(PyConduit_Node *self,
                     PyObject *args,
                     PyObject *kwargs)
 {
+    if(PyConduit_Node_Check_In_Use(self->node))
+    {
+        return NULL;
+    }
+
     PyObject   *py_node  = NULL;
 
     static const char *kwlist[] = {"other",
@@ -6303,6 +6792,11 @@ PyConduit_Node_move(PyConduit_Node *self,
 
     Node &n_other = *PyConduit_Node_Get_Node_Ptr(py_node);
 
+    if(PyConduit_Node_Check_In_Use(&n_other))
+    {
+        return NULL;
+    }
+
     self->node->move(n_other);
     Py_RETURN_NONE;
 }
@@ -6313,6 +6807,11 @@ PyConduit_Node_swap(PyConduit_Node *self,
                     PyObject *args,
                     PyObject *kwargs)
 {
+    if(PyConduit_Node_Check_In_Use(self->node))
+    {
+        return NULL;
+    }
+
     PyObject   *py_node  = NULL;
 
     static const char *kwlist[] = {"other",
@@ -6337,6 +6836,11 @@ PyConduit_Node_swap(PyConduit_Node *self,
 
     Node &n_other = *PyConduit_Node_Get_Node_Ptr(py_node);
 
+    if(PyConduit_Node_Check_In_Use(&n_other))
+    {
+        return NULL;
+    }
+
     self->node->swap(n_other);
     Py_RETURN_NONE;
 }
@@ -6347,6 +6851,11 @@ static PyObject *
 PyConduit_Node_set(PyConduit_Node* self,
                    PyObject* args)
 {
+    if(PyConduit_Node_Check_In_Use(self->node))
+    {
+        return NULL;
+    }
+
     PyObject* py_value = NULL;
     PyObject* py_buff  = NULL;
     
@@ -6368,7 +6877,10 @@ PyConduit_Node_set(PyConduit_Node* self,
         Schema &schema = *((PyConduit_Schema*)py_value)->schema;
 
         Py_buffer buff_view;
-        PyObject_GetBuffer(py_buff, &buff_view, PyBUF_WRITE);
+        if(PyObject_GetBuffer(py_buff, &buff_view, PyBUF_WRITE) != 0)
+        {
+            return NULL;
+        }
         unsigned char *ptr = reinterpret_cast<unsigned char*>(buff_view.buf);
 
         self->node->set(schema,ptr);
@@ -6391,6 +6903,11 @@ static PyObject *
 PyConduit_Node_set_external(PyConduit_Node* self,
                             PyObject* args)
 {
+    if(PyConduit_Node_Check_In_Use(self->node))
+    {
+        return NULL;
+    }
+
     PyObject* py_value = NULL;
     PyObject* py_buff  = NULL;
 
@@ -6417,7 +6934,10 @@ PyConduit_Node_set_external(PyConduit_Node* self,
         Schema &schema = *((PyConduit_Schema*)py_value)->schema;
 
         Py_buffer buff_view;
-        PyObject_GetBuffer(py_buff, &buff_view, PyBUF_WRITE);
+        if(PyObject_GetBuffer(py_buff, &buff_view, PyBUF_WRITE) != 0)
+        {
+            return NULL;
+        }
         unsigned char *ptr = reinterpret_cast<unsigned char*>(buff_view.buf);
 
         self->node->set_external(schema,ptr);
@@ -6439,21 +6959,20 @@ PyConduit_Node_set_external(PyConduit_Node* self,
     PyArrayObject *py_arr = (PyArrayObject*)py_value;
     npy_intp num_ele = PyArray_SIZE(py_arr);
     index_t offset = 0;
-    index_t stride = (index_t) PyArray_STRIDE(py_arr, 0);
     int nd = PyArray_NDIM(py_arr);
 
+    Node& node = *self->node;
+
     if (nd > 1)
     {
-        PyErr_SetString(PyExc_TypeError,
-                        "set_external does not handle multidimensional numpy"
-                        " arrays or multidimensional complex strided views"
-                        " into numpy arrays."
-                        " Views that are effectively 1D-strided are"
-                        "supported.");
-        return (NULL);
+        if(PyConduit_Node_Set_External_NDArray(node, py_arr) != 0)
+        {
+            return (NULL);
+        }
+        Py_RETURN_NONE;
     }
 
-    Node& node = *self->node;
+    index_t stride = (index_t) PyArray_STRIDE(py_arr, 0);
 
     switch (desc->type_num) 
     {
@@ -6582,6 +7101,11 @@ PyConduit_Node_compact_to(PyConduit_Node* self,
     
     Node &n_dest = *PyConduit_Node_Get_Node_Ptr(py_node);
     
+    if(PyConduit_Node_Check_In_Use(&n_dest))
+    {
+        return NULL;
+    }
+
     self->node->compact_to(n_dest);
     Py_RETURN_NONE;
 }
@@ -6592,6 +7116,11 @@ PyConduit_Node_update(PyConduit_Node* self,
                       PyObject *args,
                       PyObject *kwargs)
 {
+    if(PyConduit_Node_Check_In_Use(self->node))
+    {
+        return NULL;
+    }
+
     PyObject   *py_node  = NULL;
     
     static const char *kwlist[] = {"other",
@@ -6626,6 +7155,11 @@ PyConduit_Node_update_compatible(PyConduit_Node* self,
                                  PyObject *args,
                                  PyObject *kwargs)
 {
+    if(PyConduit_Node_Check_In_Use(self->node))
+    {
+        return NULL;
+    }
+
     PyObject   *py_node  = NULL;
     
     static const char *kwlist[] = {"other",
@@ -6660,6 +7194,11 @@ PyConduit_Node_update_external(PyConduit_Node* self,
                                PyObject *args,
                                PyObject *kwargs)
 {
+    if(PyConduit_Node_Check_In_Use(self->node))
+    {
+        return NULL;
+    }
+
     PyObject   *py_node  = NULL;
     
     static const char *kwlist[] = {"other",
@@ -6976,6 +7515,11 @@ static PyObject *
 PyConduit_Node_endian_swap(PyConduit_Node *self,
                            PyObject *args)
 {
+    if(PyConduit_Node_Check_In_Use(self->node))
+    {
+        return NULL;
+    }
+
     Py_ssize_t value;
 
     if (!PyArg_ParseTuple(args, "n", &value))
@@ -6996,6 +7540,11 @@ PyConduit_Node_endian_swap(PyConduit_Node *self,
 static PyObject *
 PyConduit_Node_endian_swap_to_machine_default(PyConduit_Node *self)
 {
+    if(PyConduit_Node_Check_In_Use(self->node))
+    {
+        return NULL;
+    }
+
     self->node->endian_swap_to_machine_default();
     Py_RETURN_NONE; 
 }
@@ -7004,6 +7553,11 @@ PyConduit_Node_endian_swap_to_machine_default(PyConduit_Node *self)
 static PyObject *
 PyConduit_Node_endian_swap_to_little(PyConduit_Node *self)
 {
+    if(PyConduit_Node_Check_In_Use(self->node))
+    {
+        return NULL;
+    }
+
     self->node->endian_swap_to_little();
     Py_RETURN_NONE; 
 }
@@ -7012,6 +7566,11 @@ PyConduit_Node_endian_swap_to_little(PyConduit_Node *self)
 static PyObject *
 PyConduit_Node_endian_swap_to_big(PyConduit_Node *self)
 {
+    if(PyConduit_Node_Check_In_Use(self->node))
+    {
+        return NULL;
+    }
+
     self->node->endian_swap_to_big();
      Py_RETURN_NONE; 
 }
@@ -7188,6 +7747,13 @@ static PyMethodDef PyConduit_Node_METHODS[] = {
      METH_NOARGS, 
      "Value access for leaf nodes"},
     //-----------------------------------------------------------------------//
+    {"ndarray",
+     (PyCFunction)PyConduit_Node_ndarray,
+     METH_NOARGS,
+     "Returns a numpy array that shares this node's memory. Works for"
+     " numeric leaves and for ndarray nodes with 'values' and 'shape'"
+     " (plus optional 'offset' and 'stride') children"},
+    //-----------------------------------------------------------------------//
     {"generate",
      (PyCFunction)PyConduit_Node_generate,
      METH_VARARGS,  // will become kwargs
@@ -7309,6 +7875,173 @@ static PyMethodDef PyConduit_Node_METHODS[] = {
     {NULL, NULL, 0, NULL}
 };
 
+//---------------------------------------------------------------------------//
+// struct module style format for a numeric dtype. Non native byte order is
+// spelled out, which memoryview can carry but not index.
+//---------------------------------------------------------------------------//
+static const char *
+PyConduit_DataType_Buffer_Format(const DataType &dtype)
+{
+    // native, little, and big endian spellings
+    static const char *fmts[10][3] = { {"b", "<b", ">b"},
+                                       {"h", "<h", ">h"},
+                                       {"i", "<i", ">i"},
+                                       {"q", "<q", ">q"},
+                                       {"B", "<B", ">B"},
+                                       {"H", "<H", ">H"},
+                                       {"I", "<I", ">I"},
+                                       {"Q", "<Q", ">Q"},
+                                       {"f", "<f", ">f"},
+                                       {"d", "<d", ">d"} };
+    int idx = -1;
+    switch(dtype.id())
+    {
+        case DataType::INT8_ID:    idx = 0; break;
+        case DataType::INT16_ID:   idx = 1; break;
+        case DataType::INT32_ID:   idx = 2; break;
+        case DataType::INT64_ID:   idx = 3; break;
+        case DataType::UINT8_ID:   idx = 4; break;
+        case DataType::UINT16_ID:  idx = 5; break;
+        case DataType::UINT32_ID:  idx = 6; break;
+        case DataType::UINT64_ID:  idx = 7; break;
+        case DataType::FLOAT32_ID: idx = 8; break;
+        case DataType::FLOAT64_ID: idx = 9; break;
+        default: return NULL;
+    }
+
+    int order = 0;
+    if(!dtype.endianness_matches_machine())
+    {
+        order = dtype.is_little_endian() ? 1 : 2;
+    }
+
+    return fmts[idx][order];
+}
+
+//---------------------------------------------------------------------------//
+// Buffer protocol
+//
+// Numeric leaves and ndarray nodes (see PyConduit_Node_NDArray_Layout)
+// export their memory, so memoryview, numpy, and other consumers can share
+// it without a copy. The node must not be reset or reallocated while a
+// buffer is held.
+//---------------------------------------------------------------------------//
+static int
+PyConduit_Node_getbuffer(PyConduit_Node *self,
+                         Py_buffer *view,
+                         int flags)
+{
+    view->obj = NULL;
+
+    std::vector<Py_ssize_t> np_shape, np_strides;
+    char *data = NULL;
+    std::string err_msg;
+
+    if(!PyConduit_Node_NDArray_Layout(*self->node,
+                                      np_shape,
+                                      np_strides,
+                                      data,
+                                      err_msg))
+    {
+        PyErr_SetString(PyExc_BufferError, err_msg.c_str());
+        return -1;
+    }
+
+    const DataType &dtype = self->node->dtype().is_number() ?
+                            self->node->dtype() :
+                            self->node->fetch_existing("values").dtype();
+
+    const char *fmt = PyConduit_DataType_Buffer_Format(dtype);
+
+    const Py_ssize_t ndims    = (Py_ssize_t)np_shape.size();
+    const Py_ssize_t itemsize = (Py_ssize_t)dtype.element_bytes();
+
+    // check for C and Fortran ordered contiguity
+    bool c_contig = true;
+    bool f_contig = true;
+    Py_ssize_t expect = itemsize;
+    Py_ssize_t len = itemsize;
+    for(Py_ssize_t d = ndims - 1; d >= 0; d--)
+    {
+        if(np_shape[d] > 1 && np_strides[d] != expect)
+        {
+            c_contig = false;
+        }
+        expect *= np_shape[d];
+        len    *= np_shape[d];
+    }
+    expect = itemsize;
+    for(Py_ssize_t d = 0; d < ndims; d++)
+    {
+        if(np_shape[d] > 1 && np_strides[d] != expect)
+        {
+            f_contig = false;
+        }
+        expect *= np_shape[d];
+    }
+
+    if((flags & PyBUF_C_CONTIGUOUS) == PyBUF_C_CONTIGUOUS && !c_contig)
+    {
+        PyErr_SetString(PyExc_BufferError, "Node data is not C contiguous");
+        return -1;
+    }
+
+    if((flags & PyBUF_F_CONTIGUOUS) == PyBUF_F_CONTIGUOUS && !f_contig)
+    {
+        PyErr_SetString(PyExc_BufferError,
+                        "Node data is not Fortran contiguous");
+        return -1;
+    }
+
+    if((flags & PyBUF_ANY_CONTIGUOUS) == PyBUF_ANY_CONTIGUOUS &&
+       !c_contig && !f_contig)
+    {
+        PyErr_SetString(PyExc_BufferError, "Node data is not contiguous");
+        return -1;
+    }
+
+    if((flags & PyBUF_STRIDES) != PyBUF_STRIDES && !c_contig)
+    {
+        PyErr_SetString(PyExc_BufferError,
+                        "Node data is strided, request a strided buffer");
+        return -1;
+    }
+
+    // shape and strides live in internal until the buffer is released
+    Py_ssize_t *dims_and_strides = new Py_ssize_t[2 * ndims];
+    for(Py_ssize_t d = 0; d < ndims; d++)
+    {
+        dims_and_strides[d]         = np_shape[d];
+        dims_and_strides[ndims + d] = np_strides[d];
+    }
+
+    view->buf        = data;
+    view->len        = len;
+    view->readonly   = 0;
+    view->itemsize   = itemsize;
+    view->format     = (flags & PyBUF_FORMAT) ? (char*)fmt : NULL;
+    view->ndim       = (int)ndims;
+    view->shape      = (flags & PyBUF_ND) ? dims_and_strides : NULL;
+    view->strides    = ((flags & PyBUF_STRIDES) == PyBUF_STRIDES) ?
+                       dims_and_strides + ndims : NULL;
+    view->suboffsets = NULL;
+    view->internal   = dims_and_strides;
+
+    Py_INCREF((PyObject*)self);
+    view->obj = (PyObject*)self;
+
+    return 0;
+}
+
+//---------------------------------------------------------------------------//
+static void
+PyConduit_Node_releasebuffer(PyConduit_Node *, // self
+                             Py_buffer *view)
+{
+    delete [] (Py_ssize_t*)view->internal;
+    view->internal = NULL;
+}
+
 #ifdef Py_LIMITED_API
 static PyType_Slot PyConduit_Node_SLOTS[]  = {
   {Py_tp_dealloc,        (void*) PyConduit_Node_dealloc},
@@ -7319,6 +8052,8 @@ static PyType_Slot PyConduit_Node_SLOTS[]  = {
   {Py_mp_subscript,      (void*) PyConduit_Node_GetItem},
   {Py_mp_ass_subscript,  (void*) PyConduit_Node_SetItem},
   {Py_tp_iter,           (void*) PyConduit_Node_iter},
+  {Py_bf_getbuffer,      (void*) PyConduit_Node_getbuffer},
+  {Py_bf_releasebuffer,  (void*) PyConduit_Node_releasebuffer},
   {0,0},
 };
 
@@ -7339,6 +8074,12 @@ static PyMappingMethods node_as_mapping = {
    (objobjargproc)PyConduit_Node_SetItem,
 };
 
+//---------------------------------------------------------------------------//
+static PyBufferProcs node_as_buffer = {
+   (getbufferproc)PyConduit_Node_getbuffer,
+   (releasebufferproc)PyConduit_Node_releasebuffer,
+};
+
 //---------------------------------------------------------------------------//
 //---------------------------------------------------------------------------//
 
@@ -7364,7 +8105,7 @@ static PyTypeObject PyConduit_Node_TYPE = {
    (reprfunc)PyConduit_Node_str,                         /* str */
    0, /* getattro */
    0, /* setattro */
-   0, /* asbuffer */
+   &node_as_buffer, /* asbuffer */
    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,     /* flags */
    "Conduit node objects",
    0, /* traverse */
@@ -8513,6 +9254,8 @@ void CONDUIT_PYTHON_API initconduit_python(void)
     PyConduit_API[PyConduit_Node_Python_Create_INDEX] = (void *)PyConduit_Node_Python_Create;
     PyConduit_API[PyConduit_Node_Python_Wrap_INDEX] = (void *)PyConduit_Node_Python_Wrap;
     PyConduit_API[PyConduit_Node_Get_Node_Ptr_INDEX] = (void *)PyConduit_Node_Get_Node_Ptr;
+    PyConduit_API[PyConduit_Node_Begin_Use_INDEX] = (void *)PyConduit_Node_Begin_Use;
+    PyConduit_API[PyConduit_Node_End_Use_INDEX] = (void *)PyConduit_Node_End_Use;
 
     /* Create a Capsule containing the API pointer array's address */
     PyObject *py_c_api_capsule = PyCapsule_New((void *)PyConduit_API, "conduit._C_API", NULL);
@@ -68,10 +68,25 @@
 #define PyConduit_Node_Get_Node_Ptr_PROTO (PyObject* obj)
 
 
+//---------------------------------------------------------------------------//
+// void      PyConduit_Node_Begin_Use(Node *n);
+//---------------------------------------------------------------------------//
+#define PyConduit_Node_Begin_Use_INDEX 4
+#define PyConduit_Node_Begin_Use_RETURN void
+#define PyConduit_Node_Begin_Use_PROTO (conduit::Node *n)
+
+//---------------------------------------------------------------------------//
+// void      PyConduit_Node_End_Use(Node *n);
+//---------------------------------------------------------------------------//
+#define PyConduit_Node_End_Use_INDEX 5
+#define PyConduit_Node_End_Use_RETURN void
+#define PyConduit_Node_End_Use_PROTO (conduit::Node *n)
+
+
 //---------------------------------------------------------------------------//
 // Total number of CAPI pointers
 //---------------------------------------------------------------------------//
-#define PyConduit_API_number_of_entries 4
+#define PyConduit_API_number_of_entries 6
 
 //---------------------------------------------------------------------------//
 #ifdef CONDUIT_MODULE
@@ -87,6 +102,10 @@ static PyConduit_Node_Python_Wrap_RETURN PyConduit_Node_Python_Wrap PyConduit_No
 
 static PyConduit_Node_Get_Node_Ptr_RETURN PyConduit_Node_Get_Node_Ptr PyConduit_Node_Get_Node_Ptr_PROTO;
 
+static PyConduit_Node_Begin_Use_RETURN PyConduit_Node_Begin_Use PyConduit_Node_Begin_Use_PROTO;
+
+static PyConduit_Node_End_Use_RETURN PyConduit_Node_End_Use PyConduit_Node_End_Use_PROTO;
+
 
 //---------------------------------------------------------------------------//
 #else
@@ -113,6 +132,14 @@ static void **PyConduit_API;
 #define PyConduit_Node_Get_Node_Ptr  \
  (*(PyConduit_Node_Get_Node_Ptr_RETURN (*)PyConduit_Node_Get_Node_Ptr_PROTO) PyConduit_API[PyConduit_Node_Get_Node_Ptr_INDEX])
 
+//---------------------------------------------------------------------------//
+#define PyConduit_Node_Begin_Use  \
+ (*(PyConduit_Node_Begin_Use_RETURN (*)PyConduit_Node_Begin_Use_PROTO) PyConduit_API[PyConduit_Node_Begin_Use_INDEX])
+
+//---------------------------------------------------------------------------//
+#define PyConduit_Node_End_Use  \
+ (*(PyConduit_Node_End_Use_RETURN (*)PyConduit_Node_End_Use_PROTO) PyConduit_API[PyConduit_Node_End_Use_INDEX])
+
 
 
 
@@ -133,6 +160,72 @@ import_conduit(void)
 
 #endif
 
+//---------------------------------------------------------------------------//
+// PyConduit_Allow_Threads
+// Releases the GIL for the lifetime of the object, so long running C++
+// calls (I/O, mesh algorithms, MPI) do not block other Python threads.
+//
+// The given Python objects gain a reference until the GIL is reacquired,
+// so the Nodes they wrap stay alive even if another thread drops its
+// references. The given Nodes are also marked in use, and the conduit.Node
+// methods that modify a Node raise a RuntimeError while it, one of its
+// parents, or one of its children is in use. Changing a Node from another
+// thread in other ways during the call (through numpy views of its data,
+// or by passing it to another call that writes to it) is undefined
+// behavior. No Python API may be used while the GIL is released. An
+// exception thrown in the scope reacquires the GIL before any handler runs.
+//---------------------------------------------------------------------------//
+class PyConduit_Allow_Threads
+{
+public:
+    explicit PyConduit_Allow_Threads(PyObject *obj0 = NULL,
+                                     PyObject *obj1 = NULL,
+                                     PyObject *obj2 = NULL,
+                                     PyObject *obj3 = NULL)
+    : m_state(NULL)
+    {
+        m_objs[0] = obj0;
+        m_objs[1] = obj1;
+        m_objs[2] = obj2;
+        m_objs[3] = obj3;
+        for(int i = 0; i < 4; i++)
+        {
+            m_nodes[i] = NULL;
+            if(m_objs[i] != NULL)
+            {
+                Py_INCREF(m_objs[i]);
+                if(PyConduit_Node_Check(m_objs[i]))
+                {
+                    m_nodes[i] = PyConduit_Node_Get_Node_Ptr(m_objs[i]);
+                    PyConduit_Node_Begin_Use(m_nodes[i]);
+                }
+            }
+        }
+        m_state = PyEval_SaveThread();
+    }
+
+    ~PyConduit_Allow_Threads()
+    {
+        PyEval_RestoreThread(m_state);
+        for(int i = 0; i < 4; i++)
+        {
+            if(m_nodes[i] != NULL)
+            {
+                PyConduit_Node_End_Use(m_nodes[i]);
+            }
+            Py_XDECREF(m_objs[i]);
+        }
+    }
+
+private:
+    PyConduit_Allow_Threads(const PyConduit_Allow_Threads &);
+    PyConduit_Allow_Threads &operator=(const PyConduit_Allow_Threads &);
+
+    PyObject      *m_objs[4];
+    conduit::Node *m_nodes[4];
+    PyThreadState *m_state;
+};
+
 #endif
 
 
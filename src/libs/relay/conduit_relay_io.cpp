@@ -14,6 +14,7 @@
 // standard lib includes
 //-----------------------------------------------------------------------------
 #include <iostream>
+#include <mutex>
 
 // Include a helper function for figuring out protocols.
 #include "conduit_relay_io_identify_protocol.hpp"
@@ -33,6 +34,7 @@
 
 #include "conduit_relay_io_handle.hpp"
 #include "conduit_relay_io_csv.hpp"
+#include "conduit_relay_io_table_bin.hpp"
 
 //-----------------------------------------------------------------------------
 // -- begin conduit:: --
@@ -84,6 +86,9 @@ about(Node &n)
     // write table blueprints to csv
     io_protos["csv"] = "enabled";
 
+    // write table blueprints to columnar binary files
+    io_protos["table_bin"] = "enabled";
+
 #ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
     // hdf5
     io_protos["hdf5"] = "enabled";
@@ -362,6 +367,10 @@ save(const Node &node,
     {
         write_csv(node, path, options);
     }
+    else if(protocol == "table_bin")
+    {
+        write_table_bin(node, path, options);
+    }
     else if( protocol == "hdf5")
     {
 #ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
@@ -604,6 +613,10 @@ load(const std::string &path,
     {
         read_csv(path, options, node);
     }
+    else if(protocol == "table_bin")
+    {
+        read_table_bin(path, options, node);
+    }
     else if( protocol == "hdf5")
     {
 #ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
@@ -851,6 +864,80 @@ query_number_of_domains(const std::string &path)
 }
 
 
+
+//---------------------------------------------------------------------------//
+bool
+protocol_is_thread_safe(const std::string &protocol)
+{
+    if(protocol == "conduit_bin" ||
+       protocol == "json" ||
+       protocol == "conduit_json" ||
+       protocol == "conduit_base64_json" ||
+       protocol == "yaml" ||
+       protocol == "csv" ||
+       protocol == "table_bin")
+    {
+        return true;
+    }
+
+    // protocols for libraries that are not enabled never call them
+    bool hdf5_safe  = true;
+    bool silo_safe  = true;
+    bool adios_safe = true;
+#ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
+    hdf5_safe = hdf5_library_is_thread_safe();
+#endif
+#ifdef CONDUIT_RELAY_IO_SILO_ENABLED
+    silo_safe = false;
+#endif
+#ifdef CONDUIT_RELAY_IO_ADIOS_ENABLED
+    adios_safe = false;
+#endif
+
+    if(protocol == "hdf5" || protocol == "sidre_hdf5")
+    {
+        return hdf5_safe;
+    }
+    else if(protocol == "conduit_silo" || protocol == "conduit_silo_mesh")
+    {
+        return silo_safe;
+    }
+    else if(protocol == "adios")
+    {
+        return adios_safe;
+    }
+
+    // auto detected or unknown protocols
+    return hdf5_safe && silo_safe && adios_safe;
+}
+
+//---------------------------------------------------------------------------//
+static std::mutex &
+io_library_mutex()
+{
+    static std::mutex io_lib_mutex;
+    return io_lib_mutex;
+}
+
+//---------------------------------------------------------------------------//
+IOLibraryLock::IOLibraryLock(const std::string &protocol)
+: m_locked(!protocol_is_thread_safe(protocol))
+{
+    if(m_locked)
+    {
+        io_library_mutex().lock();
+    }
+}
+
+//---------------------------------------------------------------------------//
+IOLibraryLock::~IOLibraryLock()
+{
+    if(m_locked)
+    {
+        io_library_mutex().unlock();
+    }
+}
+
 }
 //-----------------------------------------------------------------------------
 // -- end conduit::relay::io --
@@ -197,6 +197,37 @@ int CONDUIT_RELAY_API query_number_of_steps(const std::string &path);
 //-----------------------------------------------------------------------------
 int CONDUIT_RELAY_API query_number_of_domains(const std::string &path);
 
+//-----------------------------------------------------------------------------
+///
+/// ``protocol_is_thread_safe`` returns true if the I/O library used by the
+/// given protocol can be called from several threads at once. Silo and
+/// ADIOS are not thread safe, HDF5 is only when it was built thread safe.
+/// An empty or unknown protocol may use any library.
+///
+//-----------------------------------------------------------------------------
+bool CONDUIT_RELAY_API protocol_is_thread_safe(const std::string &protocol);
+
+//-----------------------------------------------------------------------------
+///
+/// ``IOLibraryLock`` holds a relay wide mutex for its lifetime when the
+/// given protocol is not thread safe, to serialize calls into those I/O
+/// libraries. Relay does not take this lock itself. Callers that run relay
+/// I/O from several threads, such as the Python module, do.
+///
+//-----------------------------------------------------------------------------
+class CONDUIT_RELAY_API IOLibraryLock
+{
+public:
+    explicit IOLibraryLock(const std::string &protocol);
+            ~IOLibraryLock();
+
+private:
+    IOLibraryLock(const IOLibraryLock &);
+    IOLibraryLock &operator=(const IOLibraryLock &);
+
+    bool m_locked;
+};
+
 }
 //-----------------------------------------------------------------------------
 // -- end conduit::relay::io --
@@ -318,6 +318,22 @@ hdf5_options(Node &opts)
     HDF5Options::about(opts);
 }
 
+//-----------------------------------------------------------------------------
+bool
+hdf5_library_is_thread_safe()
+{
+#if H5_VERSION_GE(1, 8, 16)
+    hbool_t is_ts = 0;
+    if(H5is_library_threadsafe(&is_ts) < 0)
+    {
+        return false;
+    }
+    return is_ts > 0;
+#else
+    return false;
+#endif
+}
+
 //-----------------------------------------------------------------------------
 // Private class used to suppress HDF5 error messages.
 //
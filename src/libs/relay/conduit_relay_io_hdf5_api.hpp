@@ -459,6 +459,12 @@ void CONDUIT_RELAY_API hdf5_set_options(const Node &opts);
 //-----------------------------------------------------------------------------
 void CONDUIT_RELAY_API hdf5_options(Node &opts);
 
+//-----------------------------------------------------------------------------
+/// Returns true if the HDF5 library was built thread safe, so it can be
+/// called from several threads at once.
+//-----------------------------------------------------------------------------
+bool CONDUIT_RELAY_API hdf5_library_is_thread_safe();
+
 //-----------------------------------------------------------------------------
 /// Get a node that describes open hdf5 handles
 //-----------------------------------------------------------------------------
@@ -111,6 +111,10 @@ identify_protocol(const std::string &path,
     {
         io_type = "csv";
     }
+    else if(file_name_ext == "table_bin")
+    {
+        io_type = "table_bin";
+    }
 
     // default to conduit_bin
 
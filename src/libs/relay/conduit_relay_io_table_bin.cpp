@@ -0,0 +1,749 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_relay_io_table_bin.cpp
+///
+//-----------------------------------------------------------------------------
+#include "conduit_relay_io_table_bin.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "conduit_log.hpp"
+#include "conduit_execution.hpp"
+#include "conduit_blueprint_table.hpp"
+
+using conduit::utils::log::quote;
+
+// Some constants used by writer/reader
+
+// Marks the start and the end of a table file.
+static const char table_bin_magic[8] = {'C','T','A','B','L','E','0','1'};
+
+// The size of the trailer: footer schema bytes, footer data bytes, magic.
+// The byte counts are stored as little endian uint64s, the footer schema
+// records the endianness of the footer data.
+static const conduit::index_t table_bin_trailer_bytes = 24;
+
+// Column buffers start on multiples of this many bytes.
+static const conduit::index_t table_bin_alignment = 8;
+
+// Extension used for table files.
+static const std::string table_bin_ext = ".table_bin";
+
+// Prefix used for file names when the given table collection is a list
+static const std::string table_list_prefix = "table_list_";
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::relay --
+//-----------------------------------------------------------------------------
+namespace relay
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::relay::io --
+//-----------------------------------------------------------------------------
+namespace io
+{
+
+// Static functions, internal types
+
+//-----------------------------------------------------------------------------
+/**
+@brief A column of a table, which is either a values array or one component
+    of a values mcarray.
+*/
+struct TableBinColumn
+{
+    const Node *node;
+    index_t value;
+    index_t component;
+    std::string name;
+    std::string component_name;
+};
+
+//-----------------------------------------------------------------------------
+static index_t
+get_nrows(const Node &table)
+{
+    const Node &values = table["values"];
+    index_t retval = 0;
+    if(values.number_of_children() > 0)
+    {
+        const Node &ref = values[0];
+        const index_t nc = ref.number_of_children();
+        retval = nc > 0
+            ? ref[0].dtype().number_of_elements()
+            : ref.dtype().number_of_elements();
+    }
+    return retval;
+}
+
+//-----------------------------------------------------------------------------
+static std::string
+column_path(const std::string &name, const std::string &component_name)
+{
+    return component_name.empty() ? name : (name + "/" + component_name);
+}
+
+//-----------------------------------------------------------------------------
+static void
+collect_columns(const Node &values, std::vector<TableBinColumn> &columns)
+{
+    columns.clear();
+    for(index_t i = 0; i < values.number_of_children(); i++)
+    {
+        const Node &value = values[i];
+        const index_t nc = value.number_of_children();
+        if(nc > 0)
+        {
+            for(index_t c = 0; c < nc; c++)
+            {
+                columns.push_back({&value[c], i, c, value.name(), value[c].name()});
+            }
+        }
+        else
+        {
+            columns.push_back({&value, i, -1, value.name(), ""});
+        }
+    }
+
+    for(const auto &column : columns)
+    {
+        if(!column.node->dtype().is_number())
+        {
+            CONDUIT_ERROR("write_table_bin only supports numeric columns, column "
+                << quote(column_path(column.name, column.component_name))
+                << " is " << column.node->dtype().name() << ".");
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+static index_t
+aligned_bytes(index_t nbytes)
+{
+    return ((nbytes + table_bin_alignment - 1) / table_bin_alignment) *
+        table_bin_alignment;
+}
+
+//-----------------------------------------------------------------------------
+/**
+@brief Computes the row group statistics for a column and writes its data
+    at the given file offset. The column is compacted one row group at a
+    time when it is strided.
+@return true on success.
+*/
+static bool
+write_column(const Node &column, const std::string &path, index_t offset,
+    index_t nrows, index_t row_group_size, float64 *mins, float64 *maxs,
+    index_t *counts)
+{
+    const auto acc = column.as_float64_accessor();
+    const DataType &dt = column.dtype();
+    const index_t ebytes = dt.element_bytes();
+    const index_t ngroups = (nrows + row_group_size - 1) / row_group_size;
+    for(index_t g = 0; g < ngroups; g++)
+    {
+        const index_t start = g * row_group_size;
+        const index_t end = std::min(nrows, start + row_group_size);
+        float64 vmin = std::numeric_limits<float64>::max();
+        float64 vmax = std::numeric_limits<float64>::lowest();
+        index_t count = 0;
+        for(index_t i = start; i < end; i++)
+        {
+            const float64 v = acc[i];
+            // Skip NaN values.
+            if(v == v)
+            {
+                vmin = std::min(vmin, v);
+                vmax = std::max(vmax, v);
+                count++;
+            }
+        }
+        mins[g] = vmin;
+        maxs[g] = vmax;
+        counts[g] = count;
+    }
+
+    std::fstream fout(path, std::ios::in | std::ios::out | std::ios::binary);
+    if(!fout.is_open())
+    {
+        return false;
+    }
+    fout.seekp(offset);
+    if(dt.is_compact() || nrows == 0)
+    {
+        fout.write(static_cast<const char *>(column.element_ptr(0)), nrows * ebytes);
+    }
+    else
+    {
+        Node chunk, compact_chunk;
+        for(index_t g = 0; g < ngroups; g++)
+        {
+            const index_t start = g * row_group_size;
+            const index_t end = std::min(nrows, start + row_group_size);
+            chunk.set_external(DataType(dt.id(), end - start, 0, dt.stride(),
+                                        ebytes, dt.endianness()),
+                               const_cast<void *>(column.element_ptr(start)));
+            chunk.compact_to(compact_chunk);
+            fout.write(static_cast<const char *>(compact_chunk.data_ptr()),
+                       (end - start) * ebytes);
+        }
+    }
+    return fout.good();
+}
+
+//-----------------------------------------------------------------------------
+static void
+write_single_table(const Node &table, const std::string &path,
+    index_t row_group_size)
+{
+#if defined(CONDUIT_USE_OPENMP)
+    using policy = conduit::execution::OpenMPExec;
+#else
+    using policy = conduit::execution::SerialExec;
+#endif
+    const Node &values = table["values"];
+    std::vector<TableBinColumn> columns;
+    collect_columns(values, columns);
+
+    const index_t nrows = get_nrows(table);
+    const index_t ngroups = (nrows + row_group_size - 1) / row_group_size;
+    const index_t ncols = static_cast<index_t>(columns.size());
+
+    // Lay out the columns after the magic.
+    Node footer;
+    footer["version"] = 1;
+    footer["nrows"] = nrows;
+    footer["row_group_size"] = row_group_size;
+    footer["endianness"] = Endianness::machine_is_little_endian() ? "little" : "big";
+    footer["values_type"] = values.dtype().is_list() ? "list" : "object";
+    Node &n_columns = footer["columns"];
+    n_columns.set(DataType::list());
+    index_t offset = sizeof(table_bin_magic);
+    for(const auto &column : columns)
+    {
+        Node &n_column = n_columns.append();
+        n_column["name"] = column.name;
+        n_column["value"] = column.value;
+        n_column["component"] = column.component;
+        n_column["component_name"] = column.component_name;
+        n_column["type"] = column.node->dtype().name();
+        n_column["data_offset"] = offset;
+        n_column["stats/min"].set(DataType::float64(ngroups));
+        n_column["stats/max"].set(DataType::float64(ngroups));
+        n_column["stats/count"].set(DataType::index_t(ngroups));
+        offset += aligned_bytes(nrows * column.node->dtype().element_bytes());
+    }
+    const index_t data_end = offset;
+
+    // Write the magic, then each column in parallel at its offset.
+    {
+        std::ofstream fout(path, std::ios::out | std::ios::binary | std::ios::trunc);
+        if(!fout.is_open())
+        {
+            CONDUIT_ERROR("Unable to open file " << quote(path) << ".");
+        }
+        fout.write(table_bin_magic, sizeof(table_bin_magic));
+    }
+
+    std::vector<index_t> offsets(ncols);
+    std::vector<float64 *> mins(ncols), maxs(ncols);
+    std::vector<index_t *> counts(ncols);
+    for(index_t i = 0; i < ncols; i++)
+    {
+        Node &n_column = n_columns[i];
+        offsets[i] = n_column["data_offset"].to_index_t();
+        mins[i] = n_column["stats/min"].value();
+        maxs[i] = n_column["stats/max"].value();
+        counts[i] = n_column["stats/count"].value();
+    }
+
+    std::vector<int> ok(ncols, 1);
+    conduit::execution::for_all<policy>(0, ncols, [&](index_t i)
+    {
+        ok[i] = write_column(*columns[i].node, path, offsets[i], nrows,
+            row_group_size, mins[i], maxs[i], counts[i]) ? 1 : 0;
+    });
+    for(index_t i = 0; i < ncols; i++)
+    {
+        if(ok[i] == 0)
+        {
+            CONDUIT_ERROR("Unable to write column "
+                << quote(column_path(columns[i].name, columns[i].component_name))
+                << " to " << quote(path) << ".");
+        }
+    }
+
+    // Append the footer and trailer.
+    Schema footer_schema;
+    footer.schema().compact_to(footer_schema);
+    const std::string schema_json = footer_schema.to_json();
+    std::vector<uint8> footer_data;
+    footer.serialize(footer_data);
+    uint64 trailer[2] = {static_cast<uint64>(schema_json.size()),
+                         static_cast<uint64>(footer_data.size())};
+    if(Endianness::machine_is_big_endian())
+    {
+        Endianness::swap64(&trailer[0]);
+        Endianness::swap64(&trailer[1]);
+    }
+
+    std::fstream fout(path, std::ios::in | std::ios::out | std::ios::binary);
+    fout.seekp(data_end);
+    fout.write(schema_json.c_str(), schema_json.size());
+    fout.write(reinterpret_cast<const char *>(footer_data.data()), footer_data.size());
+    fout.write(reinterpret_cast<const char *>(trailer), sizeof(trailer));
+    fout.write(table_bin_magic, sizeof(table_bin_magic));
+    if(!fout.good())
+    {
+        CONDUIT_ERROR("Unable to write footer to " << quote(path) << ".");
+    }
+}
+
+//-----------------------------------------------------------------------------
+static void
+write_multiple_tables(const Node &all_tables, const std::string &base_path,
+    index_t row_group_size)
+{
+    const index_t ntables = all_tables.number_of_children();
+    if(ntables < 1)
+    {
+        return;
+    }
+
+    utils::create_directory(base_path);
+    for(index_t i = 0; i < ntables; i++)
+    {
+        const Node &table = all_tables[i];
+        const std::string name = all_tables.dtype().is_list()
+            ? table_list_prefix + std::to_string(i) : table.name();
+        const std::string full_path = base_path + utils::file_path_separator()
+            + name + table_bin_ext;
+        write_single_table(table, full_path, row_group_size);
+    }
+}
+
+//-----------------------------------------------------------------------------
+/**
+@brief Returns the row ranges to read, as sorted, non-overlapping
+    [start, end) pairs.
+*/
+static std::vector<std::pair<index_t, index_t>>
+select_rows(const Node &footer, const Node &opts)
+{
+    const index_t nrows = footer["nrows"].to_index_t();
+    index_t start = 0, end = nrows;
+    if(opts.has_child("rows"))
+    {
+        const Node &n_rows = opts["rows"];
+        if(!n_rows.dtype().is_integer() || n_rows.dtype().number_of_elements() != 2)
+        {
+            CONDUIT_ERROR("options[" << quote("rows") <<
+                "] must be an integer array containing [start, end).");
+        }
+        const auto rows = n_rows.as_index_t_accessor();
+        start = std::max(index_t(0), std::min(nrows, rows[0]));
+        end = std::max(start, std::min(nrows, rows[1]));
+    }
+
+    std::vector<std::pair<index_t, index_t>> ranges;
+    if(!opts.has_child("filter"))
+    {
+        if(end > start)
+        {
+            ranges.push_back(std::make_pair(start, end));
+        }
+        return ranges;
+    }
+
+    // Keep the row groups whose statistics overlap [min, max].
+    const Node &filter = opts["filter"];
+    if(!filter.has_child("column"))
+    {
+        CONDUIT_ERROR("options[" << quote("filter") << "] must contain "
+            << quote("column") << ".");
+    }
+    const std::string name = filter["column"].as_string();
+    const float64 fmin = filter.has_child("min") ? filter["min"].to_float64()
+                                                 : std::numeric_limits<float64>::lowest();
+    const float64 fmax = filter.has_child("max") ? filter["max"].to_float64()
+                                                 : std::numeric_limits<float64>::max();
+    const Node *stats = nullptr;
+    const Node &n_columns = footer["columns"];
+    for(index_t i = 0; i < n_columns.number_of_children(); i++)
+    {
+        const Node &n_column = n_columns[i];
+        if(column_path(n_column["name"].as_string(),
+                       n_column["component_name"].as_string()) == name)
+        {
+            stats = n_column.fetch_ptr("stats");
+            break;
+        }
+    }
+    if(stats == nullptr)
+    {
+        CONDUIT_ERROR("The filter column " << quote(name) << " does not exist.");
+    }
+
+    const index_t row_group_size = footer["row_group_size"].to_index_t();
+    const float64 *mins = stats->fetch_existing("min").value();
+    const float64 *maxs = stats->fetch_existing("max").value();
+    const index_t *counts = stats->fetch_existing("count").value();
+    const index_t ngroups = stats->fetch_existing("count").dtype().number_of_elements();
+    for(index_t g = 0; g < ngroups; g++)
+    {
+        if(counts[g] == 0 || maxs[g] < fmin || mins[g] > fmax)
+        {
+            continue;
+        }
+        const index_t gstart = std::max(start, g * row_group_size);
+        const index_t gend = std::min(end, (g + 1) * row_group_size);
+        if(gend <= gstart)
+        {
+            continue;
+        }
+        if(!ranges.empty() && ranges.back().second == gstart)
+        {
+            ranges.back().second = gend;
+        }
+        else
+        {
+            ranges.push_back(std::make_pair(gstart, gend));
+        }
+    }
+    return ranges;
+}
+
+//-----------------------------------------------------------------------------
+static bool
+column_selected(const Node &opts, const std::string &name,
+    const std::string &component_name)
+{
+    if(!opts.has_child("columns"))
+    {
+        return true;
+    }
+    const std::string path = column_path(name, component_name);
+    const Node &n_names = opts["columns"];
+    for(index_t i = 0; i < n_names.number_of_children(); i++)
+    {
+        const std::string selected = n_names[i].as_string();
+        if(selected == name || selected == path)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+static void
+read_single_table(const std::string &path, const Node &opts, Node &table)
+{
+#if defined(CONDUIT_USE_OPENMP)
+    using policy = conduit::execution::OpenMPExec;
+#else
+    using policy = conduit::execution::SerialExec;
+#endif
+    Node footer;
+    read_table_bin_info(path, footer);
+    const auto ranges = select_rows(footer, opts);
+    index_t nrows = 0;
+    for(const auto &range : ranges)
+    {
+        nrows += range.second - range.first;
+    }
+
+    // Allocate the selected columns.
+    const index_t endianness = (footer["endianness"].as_string() == "little")
+        ? Endianness::LITTLE_ID : Endianness::BIG_ID;
+    const bool is_list = footer["values_type"].as_string() == "list";
+    table.reset();
+    Node &values = table["values"];
+    values.set(is_list ? DataType::list() : DataType::object());
+    std::vector<Node *> dest_columns;
+    std::vector<index_t> offsets;
+    Node *curr_value = nullptr;
+    index_t curr_value_index = -1;
+    const Node &n_columns = footer["columns"];
+    for(index_t i = 0; i < n_columns.number_of_children(); i++)
+    {
+        const Node &n_column = n_columns[i];
+        const std::string name = n_column["name"].as_string();
+        const std::string component_name = n_column["component_name"].as_string();
+        if(!column_selected(opts, name, component_name))
+        {
+            continue;
+        }
+
+        const index_t value_index = n_column["value"].to_index_t();
+        if(value_index != curr_value_index)
+        {
+            curr_value = is_list ? &values.append() : &values[name];
+            curr_value_index = value_index;
+        }
+        Node *dest = curr_value;
+        if(n_column["component"].to_index_t() >= 0)
+        {
+            dest = component_name.empty() ? &curr_value->append()
+                                          : &curr_value->add_child(component_name);
+        }
+
+        const DataType dt(DataType::name_to_id(n_column["type"].as_string()), 1);
+        const index_t ebytes = dt.element_bytes();
+        dest->set(DataType(dt.id(), nrows, 0, ebytes, ebytes, endianness));
+        dest_columns.push_back(dest);
+        offsets.push_back(n_column["data_offset"].to_index_t());
+    }
+
+    // Read the row ranges of each column in parallel.
+    const index_t ncols = static_cast<index_t>(dest_columns.size());
+    std::vector<int> ok(ncols, 1);
+    conduit::execution::for_all<policy>(0, ncols, [&](index_t i)
+    {
+        Node &dest = *dest_columns[i];
+        const index_t ebytes = dest.dtype().element_bytes();
+        char *ptr = static_cast<char *>(dest.data_ptr());
+        std::ifstream fin(path, std::ios::in | std::ios::binary);
+        if(!fin.is_open())
+        {
+            ok[i] = 0;
+            return;
+        }
+        for(const auto &range : ranges)
+        {
+            const index_t n = range.second - range.first;
+            fin.seekg(offsets[i] + range.first * ebytes);
+            fin.read(ptr, n * ebytes);
+            ptr += n * ebytes;
+        }
+        ok[i] = fin.good() ? 1 : 0;
+    });
+    for(index_t i = 0; i < ncols; i++)
+    {
+        if(ok[i] == 0)
+        {
+            CONDUIT_ERROR("Unable to read column data from " << quote(path) << ".");
+        }
+    }
+
+    if(endianness != Endianness::machine_default())
+    {
+        table.endian_swap_to_machine_default();
+    }
+}
+
+//-----------------------------------------------------------------------------
+static void
+read_many_tables(const std::string &path, const Node &opts, Node &table)
+{
+    // Path must've been a directory
+    std::vector<std::string> dir_contents;
+    utils::list_directory_contents(path, dir_contents);
+
+    // We will only attempt to read the table files
+    const std::size_t ext_len = table_bin_ext.size();
+    std::vector<std::string> table_files;
+    for(const auto &filename : dir_contents)
+    {
+        if(utils::is_file(filename)
+            && filename.size() > ext_len
+            && filename.substr(filename.length() - ext_len) == table_bin_ext)
+        {
+            table_files.push_back(filename);
+        }
+    }
+    std::sort(table_files.begin(), table_files.end());
+
+    bool is_list = true;
+    for(const auto &filename : table_files)
+    {
+        const auto should_start = filename.rfind(utils::file_path_separator()) + 1;
+        const auto loc = filename.rfind(table_list_prefix);
+        if(loc != should_start)
+        {
+            is_list = false;
+            break;
+        }
+    }
+
+    table.reset();
+    if(is_list)
+    {
+        // Sort by the index number in the name
+        using idx_pair = std::pair<int, const std::string*>;
+        std::vector<idx_pair> list_idxs;
+        for(const std::string &name : table_files)
+        {
+            const auto offset = name.rfind(table_list_prefix) + table_list_prefix.size();
+            int idx = std::numeric_limits<int>::max();
+            try
+            {
+                idx = std::stoi(name.substr(offset));
+            }
+            catch (...)
+            {
+                idx = std::numeric_limits<int>::max();
+            }
+            list_idxs.push_back({idx, &name});
+        }
+        std::sort(list_idxs.begin(), list_idxs.end(),
+            [&](const idx_pair &p0, const idx_pair &p1)
+        {
+            return p0.first < p1.first;
+        });
+
+        for(const auto &pair : list_idxs)
+        {
+            read_single_table(*pair.second, opts, table.append());
+        }
+    }
+    else
+    {
+        for(const auto &filename : table_files)
+        {
+            const auto no_ext = filename.size() - ext_len;
+            const auto no_sep = filename.rfind(utils::file_path_separator()) + 1;
+            read_single_table(filename, opts,
+                table[filename.substr(no_sep, no_ext - no_sep)]);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+read_table_bin_info(const std::string &path, Node &info)
+{
+    std::ifstream fin(path, std::ios::in | std::ios::binary);
+    if(!fin.is_open())
+    {
+        CONDUIT_ERROR("Unable to open file " << quote(path) << ".");
+    }
+
+    char magic[sizeof(table_bin_magic)];
+    fin.read(magic, sizeof(magic));
+    fin.seekg(0, std::ios::end);
+    const index_t file_size = static_cast<index_t>(fin.tellg());
+    if(!fin.good() || file_size < index_t(sizeof(magic)) + table_bin_trailer_bytes ||
+       memcmp(magic, table_bin_magic, sizeof(magic)) != 0)
+    {
+        CONDUIT_ERROR(quote(path) << " is not a table_bin file.");
+    }
+
+    uint64 trailer[2] = {0, 0};
+    fin.seekg(file_size - table_bin_trailer_bytes);
+    fin.read(reinterpret_cast<char *>(trailer), sizeof(trailer));
+    fin.read(magic, sizeof(magic));
+    if(Endianness::machine_is_big_endian())
+    {
+        Endianness::swap64(&trailer[0]);
+        Endianness::swap64(&trailer[1]);
+    }
+    const index_t footer_bytes = static_cast<index_t>(trailer[0] + trailer[1]);
+    if(!fin.good() || memcmp(magic, table_bin_magic, sizeof(magic)) != 0 ||
+       footer_bytes > file_size - table_bin_trailer_bytes)
+    {
+        CONDUIT_ERROR(quote(path) << " has an invalid table_bin footer.");
+    }
+
+    std::string schema_json(static_cast<size_t>(trailer[0]), ' ');
+    std::vector<uint8> data(static_cast<size_t>(trailer[1]));
+    fin.seekg(file_size - table_bin_trailer_bytes - footer_bytes);
+    fin.read(&schema_json[0], schema_json.size());
+    fin.read(reinterpret_cast<char *>(data.data()), data.size());
+    if(!fin.good())
+    {
+        CONDUIT_ERROR("Unable to read the footer of " << quote(path) << ".");
+    }
+
+    info.reset();
+    info.set_data_using_schema(Schema(schema_json), data.data());
+    // The footer may come from a machine with the other endianness.
+    info.endian_swap_to_machine_default();
+}
+
+//-----------------------------------------------------------------------------
+void
+read_table_bin(const std::string &path, const Node &opts, Node &table)
+{
+    if(utils::is_directory(path))
+    {
+        read_many_tables(path, opts, table);
+    }
+    else
+    {
+        read_single_table(path, opts, table);
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+write_table_bin(const Node &table, const std::string &path, const Node &opts)
+{
+    Node info;
+    const bool ok = blueprint::table::verify(table, info);
+    if(!ok)
+    {
+        CONDUIT_ERROR("The node provided to write_table_bin must be a valid "
+            << "blueprint table!");
+    }
+
+    index_t row_group_size = 65536;
+    if(opts.has_child("row_group_size"))
+    {
+        const Node &n_row_group_size = opts["row_group_size"];
+        if(n_row_group_size.dtype().is_integer() &&
+           n_row_group_size.to_index_t() > 0)
+        {
+            row_group_size = n_row_group_size.to_index_t();
+        }
+        else
+        {
+            CONDUIT_ERROR("options[" << quote("row_group_size") <<
+                "] must be a positive integer.");
+        }
+    }
+
+    if(table.has_child("values"))
+    {
+        write_single_table(table, path, row_group_size);
+    }
+    else
+    {
+        write_multiple_tables(table, path, row_group_size);
+    }
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::relay::io --
+//-----------------------------------------------------------------------------
+
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::relay --
+//-----------------------------------------------------------------------------
+
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
@@ -0,0 +1,104 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_relay_io_table_bin.hpp
+///
+//-----------------------------------------------------------------------------
+
+#ifndef CONDUIT_RELAY_IO_TABLE_BIN_HPP
+#define CONDUIT_RELAY_IO_TABLE_BIN_HPP
+
+//-----------------------------------------------------------------------------
+// conduit lib include
+//-----------------------------------------------------------------------------
+#include "conduit.hpp"
+#include "conduit_node.hpp"
+#include "conduit_relay_exports.h"
+#include "conduit_relay_config.h"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::relay --
+//-----------------------------------------------------------------------------
+namespace relay
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::relay::io --
+//-----------------------------------------------------------------------------
+namespace io
+{
+
+//-----------------------------------------------------------------------------
+/**
+@brief Reads a columnar binary table (or a directory of them) written by
+    write_table_bin.
+
+Options:
+    "columns": A list of column names to read. A name can select a whole
+        column ("points") or one mcarray component ("points/x").
+        (Default = all columns)
+    "rows": [start, end), the range of rows to read. (Default = all rows)
+    "filter": Reads only the row groups whose statistics overlap the given
+        range of a column. It contains "column" (the name of a column or
+        mcarray component) and optionally "min" and "max". Whole row groups
+        are returned, so some rows may lie outside the range.
+*/
+CONDUIT_RELAY_API void read_table_bin(const std::string &path,
+                                      const Node &options,
+                                      Node &table);
+
+//-----------------------------------------------------------------------------
+/**
+@brief Accepts a blueprint table and writes it out to the given filename in a
+    columnar binary format. Each column is stored as one contiguous typed
+    buffer and a footer records the columns and per row group statistics
+    (min, max, count). Columns are written in parallel when OpenMP is
+    enabled. A collection of tables is written to a directory with one file
+    per table. Files are written in the byte order of the machine and can
+    be read on machines with either byte order.
+
+Options:
+    "row_group_size": The number of rows in each row group.
+        (Default = 65536)
+*/
+CONDUIT_RELAY_API void write_table_bin(const Node &table,
+                                       const std::string &path,
+                                       const Node &options);
+
+//-----------------------------------------------------------------------------
+/**
+@brief Reads the footer of a columnar binary table, which describes the
+    columns and the statistics for each row group, without reading any
+    column data. The info is returned in the byte order of the machine.
+*/
+CONDUIT_RELAY_API void read_table_bin_info(const std::string &path,
+                                           Node &info);
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::relay::io --
+//-----------------------------------------------------------------------------
+
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::relay --
+//-----------------------------------------------------------------------------
+
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit --
+//-----------------------------------------------------------------------------
+
+
+#endif
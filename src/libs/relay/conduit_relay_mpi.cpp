@@ -9,8 +9,10 @@
 //-----------------------------------------------------------------------------
 
 #include "conduit_relay_mpi.hpp"
+#include <cstring>
 #include <iostream>
 #include <limits>
+#include <map>
 
 //-----------------------------------------------------------------------------
 /// The CONDUIT_CHECK_MPI_ERROR macro is used to check return values for 
@@ -1176,6 +1178,417 @@ all_gather(Node &send_node,
 
 
 
+//-----------------------------------------------------------------------------
+// -- begin conduit::relay::mpi::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+//---------------------------------------------------------------------------//
+// Reads boolean style ("true"/"false") options used by the gather variants.
+//---------------------------------------------------------------------------//
+bool
+gather_option_enabled(const Node &options,
+                      const std::string &name)
+{
+    bool res = false;
+    if(options.has_child(name))
+    {
+        const Node &opt = options[name];
+        if(opt.dtype().is_string())
+        {
+            res = opt.as_string() == "true";
+        }
+        else if(opt.dtype().is_number())
+        {
+            res = opt.to_int() != 0;
+        }
+    }
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+/**
+ @brief Holds the communicators used for a two level (node, then across node)
+        gather. The root of the top level communicator is always rank 0 of
+        its node communicator and rank 0 of the leader communicator.
+ */
+struct GatherHierarchy
+{
+    GatherHierarchy()
+    : node_comm(MPI_COMM_NULL),
+      leader_comm(MPI_COMM_NULL),
+      node_rank(0),
+      node_size(1)
+    {}
+
+    ~GatherHierarchy()
+    {
+        if(node_comm != MPI_COMM_NULL)
+        {
+            MPI_Comm_free(&node_comm);
+        }
+        if(leader_comm != MPI_COMM_NULL)
+        {
+            MPI_Comm_free(&leader_comm);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    /// Creates the node and leader communicators. When use_shared_mem is
+    /// false, every rank is placed in its own group, so all ranks are leaders.
+    int init(int root, MPI_Comm comm, bool use_shared_mem)
+    {
+        int m_rank = mpi::rank(comm);
+        // make sure the root sorts first within its node
+        int key = (m_rank == root) ? 0 : m_rank + 1;
+
+        int mpi_error = MPI_SUCCESS;
+        if(use_shared_mem)
+        {
+            mpi_error = MPI_Comm_split_type(comm,
+                                            MPI_COMM_TYPE_SHARED,
+                                            key,
+                                            MPI_INFO_NULL,
+                                            &node_comm);
+        }
+        else
+        {
+            mpi_error = MPI_Comm_split(comm, m_rank, key, &node_comm);
+        }
+        CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+        node_rank = mpi::rank(node_comm);
+        node_size = mpi::size(node_comm);
+
+        mpi_error = MPI_Comm_split(comm,
+                                   node_rank == 0 ? 0 : MPI_UNDEFINED,
+                                   key,
+                                   &leader_comm);
+        CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+        return mpi_error;
+    }
+
+    bool is_leader() const
+    {
+        return node_rank == 0;
+    }
+
+    MPI_Comm node_comm;
+    MPI_Comm leader_comm;
+    int      node_rank;
+    int      node_size;
+};
+
+//---------------------------------------------------------------------------//
+/**
+ @brief Gathers the schema and data of every rank in a node into the node
+        leader. Ranks write their payload into their own segment of an MPI-3
+        shared memory window and the leader reads them in place.
+
+        On the leader, block is populated with:
+          ranks:      the rank (in the top level comm) of each node rank
+          schema_ids: index into schemas used by each node rank
+          sizes:      number of data bytes sent by each node rank
+          schemas:    list of the unique schema json strings
+          data:       the node ranks' compact data, in node rank order
+ */
+int
+gather_to_node_leader(const Node &n_snd_compact,
+                      int m_rank,
+                      GatherHierarchy &hier,
+                      Node &block)
+{
+    std::string schema_str = n_snd_compact.schema().to_json();
+
+    int64 snd_info[3] = { m_rank,
+                          static_cast<int64>(schema_str.length() + 1),
+                          static_cast<int64>(n_snd_compact.total_bytes_compact())};
+
+    std::vector<int64> rcv_info;
+    if(hier.is_leader())
+    {
+        rcv_info.resize(3 * hier.node_size);
+    }
+
+    int mpi_error = MPI_Gather(snd_info,
+                               3,
+                               MPI_INT64_T,
+                               rcv_info.empty() ? NULL : &rcv_info[0],
+                               3,
+                               MPI_INT64_T,
+                               0,
+                               hier.node_comm);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    // each rank owns a segment with its schema string followed by its data
+    MPI_Aint seg_size = static_cast<MPI_Aint>(snd_info[1] + snd_info[2]);
+    char    *seg_ptr  = NULL;
+    MPI_Win  win;
+
+    mpi_error = MPI_Win_allocate_shared(seg_size,
+                                        1,
+                                        MPI_INFO_NULL,
+                                        hier.node_comm,
+                                        &seg_ptr,
+                                        &win);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, win);
+
+    memcpy(seg_ptr, schema_str.c_str(), (size_t)snd_info[1]);
+    if(snd_info[2] > 0)
+    {
+        memcpy(seg_ptr + snd_info[1],
+               n_snd_compact.data_ptr(),
+               (size_t)snd_info[2]);
+    }
+
+    MPI_Win_sync(win);
+    MPI_Barrier(hier.node_comm);
+    MPI_Win_sync(win);
+
+    if(hier.is_leader())
+    {
+        int num_local = hier.node_size;
+        block["ranks"].set(DataType::int64(num_local));
+        block["schema_ids"].set(DataType::int64(num_local));
+        block["sizes"].set(DataType::int64(num_local));
+
+        int64_array ranks      = block["ranks"].value();
+        int64_array schema_ids = block["schema_ids"].value();
+        int64_array sizes      = block["sizes"].value();
+
+        index_t total_data = 0;
+        for(int i = 0; i < num_local; i++)
+        {
+            total_data += rcv_info[3 * i + 2];
+        }
+        block["data"].set(DataType::uint8(total_data));
+        char *data_ptr = (char*)block["data"].data_ptr();
+
+        // identical schemas (the common case) are only sent once
+        std::map<std::string, index_t> schema_lookup;
+        Node &schemas = block["schemas"];
+
+        index_t data_offset = 0;
+        for(int i = 0; i < num_local; i++)
+        {
+            MPI_Aint  r_size = 0;
+            int       r_disp = 1;
+            char     *r_ptr  = NULL;
+            MPI_Win_shared_query(win, i, &r_size, &r_disp, &r_ptr);
+
+            std::string r_schema(r_ptr);
+            std::map<std::string, index_t>::const_iterator itr =
+                schema_lookup.find(r_schema);
+            index_t schema_id = 0;
+            if(itr == schema_lookup.end())
+            {
+                schema_id = schemas.number_of_children();
+                schema_lookup[r_schema] = schema_id;
+                schemas.append().set(r_schema);
+            }
+            else
+            {
+                schema_id = itr->second;
+            }
+
+            ranks[i]      = rcv_info[3 * i];
+            schema_ids[i] = schema_id;
+            sizes[i]      = rcv_info[3 * i + 2];
+
+            if(sizes[i] > 0)
+            {
+                memcpy(data_ptr + data_offset,
+                       r_ptr + rcv_info[3 * i + 1],
+                       (size_t)sizes[i]);
+            }
+            data_offset += sizes[i];
+        }
+    }
+
+    // keep segments alive until the leader has read them
+    MPI_Barrier(hier.node_comm);
+    MPI_Win_unlock_all(win);
+    MPI_Win_free(&win);
+
+    return mpi_error;
+}
+
+//---------------------------------------------------------------------------//
+/**
+ @brief Gathers every rank's schema and data to root in the packed form
+        described in conduit_relay_mpi.hpp.
+ */
+int
+gather_using_schema_packed(Node &send_node,
+                           Node &packed,
+                           int root,
+                           MPI_Comm mpi_comm,
+                           bool hierarchical)
+{
+    Node n_snd_compact;
+    send_node.compact_to(n_snd_compact);
+
+    int m_size = mpi::size(mpi_comm);
+    int m_rank = mpi::rank(mpi_comm);
+
+    GatherHierarchy hier;
+    int mpi_error = hier.init(root, mpi_comm, hierarchical);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    Node block;
+    mpi_error = gather_to_node_leader(n_snd_compact, m_rank, hier, block);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    if(!hier.is_leader())
+    {
+        return mpi_error;
+    }
+
+    // only the node leaders take part in the gather across nodes,
+    // root is rank 0 of the leader comm
+    Node blocks;
+    mpi_error = mpi::gather_using_schema(block,
+                                         blocks,
+                                         0,
+                                         hier.leader_comm);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    if(m_rank != root)
+    {
+        return mpi_error;
+    }
+
+    // merge the node blocks into a rank ordered result
+    packed.reset();
+    packed["schema_ids"].set(DataType::int64(m_size));
+    packed["offsets"].set(DataType::int64(m_size));
+    packed["sizes"].set(DataType::int64(m_size));
+
+    int64_array schema_ids = packed["schema_ids"].value();
+    int64_array offsets    = packed["offsets"].value();
+    int64_array sizes      = packed["sizes"].value();
+    Node &schemas          = packed["schemas"];
+
+    std::map<std::string, index_t> schema_lookup;
+    // location of each rank's data in blocks: (block index, byte offset)
+    std::vector<index_t> src_block(m_size, 0);
+    std::vector<index_t> src_offset(m_size, 0);
+
+    index_t num_blocks = blocks.number_of_children();
+    for(index_t b = 0; b < num_blocks; b++)
+    {
+        const Node &curr = blocks.child(b);
+        int64_array b_ranks      = curr["ranks"].as_int64_array();
+        int64_array b_schema_ids = curr["schema_ids"].as_int64_array();
+        int64_array b_sizes      = curr["sizes"].as_int64_array();
+        const Node &b_schemas    = curr["schemas"];
+
+        // map block local schema ids to global schema ids
+        std::vector<index_t> b_schema_map;
+        for(index_t s = 0; s < b_schemas.number_of_children(); s++)
+        {
+            std::string s_json = b_schemas.child(s).as_string();
+            std::map<std::string, index_t>::const_iterator itr =
+                schema_lookup.find(s_json);
+            if(itr == schema_lookup.end())
+            {
+                index_t schema_id = schemas.number_of_children();
+                schema_lookup[s_json] = schema_id;
+                schemas.append().set(s_json);
+                b_schema_map.push_back(schema_id);
+            }
+            else
+            {
+                b_schema_map.push_back(itr->second);
+            }
+        }
+
+        index_t b_offset = 0;
+        for(index_t i = 0; i < b_ranks.number_of_elements(); i++)
+        {
+            index_t r = b_ranks[i];
+            schema_ids[r] = b_schema_map[b_schema_ids[i]];
+            sizes[r]      = b_sizes[i];
+            src_block[r]  = b;
+            src_offset[r] = b_offset;
+            b_offset += b_sizes[i];
+        }
+    }
+
+    index_t total_data = 0;
+    for(int r = 0; r < m_size; r++)
+    {
+        offsets[r] = total_data;
+        total_data += sizes[r];
+    }
+
+    packed["data"].set(DataType::uint8(total_data));
+    char *data_ptr = (char*)packed["data"].data_ptr();
+    for(int r = 0; r < m_size; r++)
+    {
+        if(sizes[r] > 0)
+        {
+            const Node &b_data = blocks.child(src_block[r])["data"];
+            const char *src = (const char*)b_data.element_ptr(0);
+            memcpy(data_ptr + offsets[r],
+                   src + src_offset[r],
+                   (size_t)sizes[r]);
+        }
+    }
+
+    return mpi_error;
+}
+
+//---------------------------------------------------------------------------//
+/**
+ @brief Expands a packed gather result into the list of nodes produced by
+        gather_using_schema. Each unique schema is only parsed once.
+ */
+void
+unpack_gathered(const Node &packed,
+                Node &recv_node)
+{
+    const Node &schemas = packed["schemas"];
+    index_t num_schemas = schemas.number_of_children();
+    std::vector<Schema> parsed(num_schemas);
+    for(index_t s = 0; s < num_schemas; s++)
+    {
+        parsed[s].set(schemas.child(s).as_string());
+    }
+
+    int64_array schema_ids = packed["schema_ids"].as_int64_array();
+    index_t num_ranks = schema_ids.number_of_elements();
+
+    Schema s_tmp;
+    for(index_t r = 0; r < num_ranks; r++)
+    {
+        s_tmp.append().set(parsed[schema_ids[r]]);
+    }
+
+    Schema rcv_schema;
+    s_tmp.compact_to(rcv_schema);
+    recv_node.set(rcv_schema);
+
+    // the compact list stores each rank's data back to back in rank order,
+    // which is exactly the layout of the packed data
+    index_t total_data = packed["data"].dtype().number_of_elements();
+    if(total_data > 0)
+    {
+        memcpy(recv_node.data_ptr(),
+               packed["data"].element_ptr(0),
+               (size_t)total_data);
+    }
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::relay::mpi::detail --
+//-----------------------------------------------------------------------------
+
 //---------------------------------------------------------------------------//
 int
 gather_using_schema(Node &send_node,
@@ -1462,6 +1875,84 @@ all_gather_using_schema(Node &send_node,
 }
 
 
+//---------------------------------------------------------------------------//
+int
+gather_using_schema(Node &send_node,
+                    Node &recv_node,
+                    int root,
+                    MPI_Comm mpi_comm,
+                    const Node &options)
+{
+    bool hierarchical = detail::gather_option_enabled(options,"hierarchical");
+    bool packed = options.has_child("output") &&
+                  options["output"].dtype().is_string() &&
+                  options["output"].as_string() == "packed";
+
+    if(!hierarchical && !packed)
+    {
+        return gather_using_schema(send_node, recv_node, root, mpi_comm);
+    }
+
+    Node n_packed;
+    Node &n_res = packed ? recv_node : n_packed;
+
+    int mpi_error = detail::gather_using_schema_packed(send_node,
+                                                       n_res,
+                                                       root,
+                                                       mpi_comm,
+                                                       hierarchical);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    if(!packed && mpi::rank(mpi_comm) == root)
+    {
+        detail::unpack_gathered(n_packed, recv_node);
+    }
+
+    return mpi_error;
+}
+
+//---------------------------------------------------------------------------//
+int
+all_gather_using_schema(Node &send_node,
+                        Node &recv_node,
+                        MPI_Comm mpi_comm,
+                        const Node &options)
+{
+    bool hierarchical = detail::gather_option_enabled(options,"hierarchical");
+    bool packed = options.has_child("output") &&
+                  options["output"].dtype().is_string() &&
+                  options["output"].as_string() == "packed";
+
+    if(!hierarchical && !packed)
+    {
+        return all_gather_using_schema(send_node, recv_node, mpi_comm);
+    }
+
+    Node n_packed;
+    int mpi_error = detail::gather_using_schema_packed(send_node,
+                                                       n_packed,
+                                                       0,
+                                                       mpi_comm,
+                                                       hierarchical);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    // the packed result holds each unique schema once, so it is
+    // much cheaper to broadcast than the expanded list
+    mpi_error = broadcast_using_schema(n_packed, 0, mpi_comm);
+    CONDUIT_CHECK_MPI_ERROR(mpi_error);
+
+    if(packed)
+    {
+        recv_node.set(n_packed);
+    }
+    else
+    {
+        detail::unpack_gathered(n_packed, recv_node);
+    }
+
+    return mpi_error;
+}
+
 //---------------------------------------------------------------------------//
 int
 broadcast(Node &node,
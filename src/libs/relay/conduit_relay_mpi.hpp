@@ -256,6 +256,34 @@ namespace mpi
                                                   Node &recv_node,
                                                   MPI_Comm mpi_comm);
 
+    /// gather_using_schema and all_gather_using_schema variants that
+    /// accept options:
+    ///
+    ///  hierarchical: "true" | "false" (default: "false")
+    ///    When "true", the ranks that share a compute node first gather
+    ///    their payloads into an MPI-3 shared memory window owned by a
+    ///    node leader. Only node leaders take part in the gather across
+    ///    nodes, and identical schemas are only sent once per node.
+    ///
+    ///  output: "list" | "packed" (default: "list")
+    ///    "list" produces the same result as the variants without options.
+    ///    "packed" skips expanding the per-rank list and instead provides:
+    ///      schemas:    list of the unique compact schemas (as json strings)
+    ///      schema_ids: index into schemas for each rank
+    ///      offsets:    byte offset of each rank's data in data
+    ///      sizes:      number of data bytes sent by each rank
+    ///      data:       every rank's compact data, in rank order
+    int CONDUIT_RELAY_API gather_using_schema(Node &send_node,
+                                              Node &recv_node,
+                                              int root,
+                                              MPI_Comm mpi_comm,
+                                              const Node &options);
+
+    int CONDUIT_RELAY_API all_gather_using_schema(Node &send_node,
+                                                  Node &recv_node,
+                                                  MPI_Comm mpi_comm,
+                                                  const Node &options);
+
 //-----------------------------------------------------------------------------
 /// MPI broadcast
 //-----------------------------------------------------------------------------
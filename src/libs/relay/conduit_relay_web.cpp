@@ -12,6 +12,8 @@
 // std lib includes
 //-----------------------------------------------------------------------------
 #include <string.h>
+#include <map>
+#include <memory>
 
 //-----------------------------------------------------------------------------
 // external lib includes
@@ -444,13 +446,579 @@ public:
       std::vector<WebSocket*>     m_sockets;
 };
 
+//-----------------------------------------------------------------------------
+// WebStreamEncoder Class Implementation
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// helpers for the binary streaming protocol
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+static const uint64 STREAM_HASH_SEED  = 14695981039346656037ULL;
+static const uint64 STREAM_HASH_PRIME = 1099511628211ULL;
+
+//-----------------------------------------------------------------------------
+struct StreamLeaf
+{
+    std::string  path;
+    const Node  *node;
+};
+
+//-----------------------------------------------------------------------------
+static inline uint64
+stream_hash_combine(uint64 h, uint64 v)
+{
+    return (h ^ v) * STREAM_HASH_PRIME;
+}
+
+//-----------------------------------------------------------------------------
+static uint64
+stream_hash_string(uint64 h, const std::string &s)
+{
+    for(size_t i = 0; i < s.size(); i++)
+    {
+        h = stream_hash_combine(h, (uint64)(unsigned char)s[i]);
+    }
+    // terminate so "a","bc" and "ab","c" differ
+    return stream_hash_combine(h, 0xff);
+}
+
+//-----------------------------------------------------------------------------
+// hashes 8 bytes at a time, only used to detect changed leaf data
+//-----------------------------------------------------------------------------
+static uint64
+stream_hash_bytes(const uint8 *data, size_t num_bytes)
+{
+    uint64 h = STREAM_HASH_SEED;
+    size_t num_words = num_bytes / 8;
+    for(size_t i = 0; i < num_words; i++)
+    {
+        uint64 w;
+        memcpy(&w, data + i * 8, 8);
+        h = stream_hash_combine(h, w);
+        h ^= h >> 29;
+    }
+    for(size_t i = num_words * 8; i < num_bytes; i++)
+    {
+        h = stream_hash_combine(h, (uint64)data[i]);
+    }
+    return stream_hash_combine(h, (uint64)num_bytes);
+}
+
+//-----------------------------------------------------------------------------
+// collects the leaves of node in order and adds the structure of the tree
+// to schema_hash: the type of each node, the names or count of the children
+// of each object or list, and the type, length and endianness of each leaf
+//-----------------------------------------------------------------------------
+static void
+stream_collect_leaves(const Node &node,
+                      const std::string &path,
+                      std::vector<StreamLeaf> &leaves,
+                      uint64 &schema_hash)
+{
+    const DataType &dt = node.dtype();
+    index_t dtype_id = dt.id();
+    schema_hash = stream_hash_combine(schema_hash, (uint64)dtype_id);
+    if(dtype_id == DataType::OBJECT_ID || dtype_id == DataType::LIST_ID)
+    {
+        index_t num_children = node.number_of_children();
+        schema_hash = stream_hash_combine(schema_hash, (uint64)num_children);
+        for(index_t i = 0; i < num_children; i++)
+        {
+            std::ostringstream oss;
+            if(!path.empty())
+            {
+                oss << path << "/";
+            }
+
+            if(dtype_id == DataType::OBJECT_ID)
+            {
+                const std::string &name = node.schema().child_name(i);
+                schema_hash = stream_hash_string(schema_hash, name);
+                oss << name;
+            }
+            else
+            {
+                oss << i;
+            }
+            stream_collect_leaves(node.child(i), oss.str(), leaves,
+                                  schema_hash);
+        }
+        // close the children, so a sibling can't pass for a child
+        schema_hash = stream_hash_combine(schema_hash, 0xfe);
+    }
+    else if(dtype_id != DataType::EMPTY_ID)
+    {
+        schema_hash = stream_hash_combine(schema_hash,
+                                          (uint64)dt.number_of_elements());
+        schema_hash = stream_hash_combine(schema_hash,
+                                          (uint64)dt.endianness());
+        StreamLeaf leaf;
+        leaf.path = path;
+        leaf.node = &node;
+        leaves.push_back(leaf);
+    }
+}
+
+//-----------------------------------------------------------------------------
+template<typename T>
+static inline void
+stream_write(std::vector<uint8> &msg, size_t &pos, T value)
+{
+    memcpy(msg.data() + pos, &value, sizeof(T));
+    pos += sizeof(T);
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end detail --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+WebStreamEncoder::WebStreamEncoder()
+: m_schema_hash(0),
+  m_schema_id(0),
+  m_sequence(0),
+  m_has_schema(false),
+  m_leaf_hashes()
+{
+    // empty
+}
+
+//-----------------------------------------------------------------------------
+WebStreamEncoder::~WebStreamEncoder()
+{
+    // empty
+}
+
+//-----------------------------------------------------------------------------
+void
+WebStreamEncoder::reset()
+{
+    // keep the schema id counting up, so clients can tell a new schema
+    // from the one they already hold
+    m_schema_hash = 0;
+    m_has_schema  = false;
+    m_leaf_hashes.clear();
+}
+
+//-----------------------------------------------------------------------------
+index_t
+WebStreamEncoder::schema_id() const
+{
+    return (index_t)m_schema_id;
+}
+
+//-----------------------------------------------------------------------------
+index_t
+WebStreamEncoder::number_of_leaves() const
+{
+    return (index_t)m_leaf_hashes.size();
+}
+
+//-----------------------------------------------------------------------------
+bool
+WebStreamEncoder::encode(const Node &data,
+                         bool skip_unchanged,
+                         std::string &schema_msg,
+                         std::vector<uint8> &data_msg)
+{
+    // the schema hash covers everything a client needs to decode the
+    // data messages: the tree structure and leaf types and lengths
+    std::vector<detail::StreamLeaf> leaves;
+    uint64 schema_hash = detail::STREAM_HASH_SEED;
+    detail::stream_collect_leaves(data, "", leaves, schema_hash);
+
+    size_t num_leaves = leaves.size();
+
+    size_t data_msg_bytes = 24;
+    for(size_t i = 0; i < num_leaves; i++)
+    {
+        const DataType &dt = leaves[i].node->dtype();
+        index_t num_bytes = dt.bytes_compact();
+        if(num_bytes > (index_t)0xffffffff)
+        {
+            CONDUIT_ERROR("leaf '" << leaves[i].path << "' is "
+                          << num_bytes << " bytes, which exceeds the "
+                          "binary streaming limit of 4 GiB per leaf");
+        }
+        data_msg_bytes += 8 + (((size_t)num_bytes + 7) / 8) * 8;
+    }
+
+    bool new_schema = !m_has_schema || schema_hash != m_schema_hash;
+
+    schema_msg.clear();
+
+    if(new_schema)
+    {
+        m_has_schema  = true;
+        m_schema_hash = schema_hash;
+        m_schema_id++;
+        m_leaf_hashes.assign(num_leaves, 0);
+
+        Schema s_compact;
+        data.schema().compact_to(s_compact);
+
+        std::ostringstream oss;
+        oss << "{\"type\": \"conduit_stream_schema\",\n"
+            << " \"schema_id\": " << m_schema_id << ",\n"
+            << " \"endianness\": \""
+            << (Endianness::machine_is_little_endian() ? "little" : "big")
+            << "\",\n"
+            << " \"schema\": \n";
+        s_compact.to_json_stream(oss);
+        oss << ",\n \"leaves\": [";
+        for(size_t i = 0; i < num_leaves; i++)
+        {
+            const DataType &dt = leaves[i].node->dtype();
+            oss << (i > 0 ? ",\n  " : "\n  ")
+                << "{\"path\": \""
+                << utils::escape_special_chars(leaves[i].path) << "\", "
+                << "\"dtype\": \"" << dt.name() << "\", "
+                << "\"number_of_elements\": " << dt.number_of_elements()
+                << ", "
+                << "\"element_bytes\": " << dt.element_bytes() << "}";
+        }
+        oss << "]\n}";
+        schema_msg = oss.str();
+    }
+
+    // reserve space for every leaf, unchanged leaves shrink the message
+    data_msg.resize(data_msg_bytes);
+
+    size_t pos = 0;
+    memcpy(&data_msg[pos], "CDAT", 4);
+    pos += 4;
+    detail::stream_write<uint32>(data_msg, pos, m_schema_id);
+    detail::stream_write<uint64>(data_msg, pos, m_sequence++);
+    size_t num_blocks_pos = pos;
+    detail::stream_write<uint32>(data_msg, pos, 0);
+    detail::stream_write<uint32>(data_msg, pos, 0);
+
+    uint32 num_blocks = 0;
+    for(size_t i = 0; i < num_leaves; i++)
+    {
+        const Node &leaf = *leaves[i].node;
+        size_t num_bytes = (size_t)leaf.dtype().bytes_compact();
+        uint8 *dest = data_msg.data() + pos + 8;
+
+        // compact directly into the message, so each leaf is copied once
+        if(leaf.dtype().is_compact())
+        {
+            memcpy(dest, leaf.element_ptr(0), num_bytes);
+        }
+        else
+        {
+            const DataType &dt = leaf.dtype();
+            index_t num_eles  = dt.number_of_elements();
+            index_t ele_bytes = dt.element_bytes();
+            for(index_t j = 0; j < num_eles; j++)
+            {
+                memcpy(dest + j * ele_bytes, leaf.element_ptr(j), ele_bytes);
+            }
+        }
+
+        if(skip_unchanged)
+        {
+            uint64 h = detail::stream_hash_bytes(dest, num_bytes);
+            bool changed = new_schema || h != m_leaf_hashes[i];
+            m_leaf_hashes[i] = h;
+            if(!changed)
+            {
+                continue;
+            }
+        }
+
+        size_t padded_bytes = ((num_bytes + 7) / 8) * 8;
+        detail::stream_write<uint32>(data_msg, pos, (uint32)i);
+        detail::stream_write<uint32>(data_msg, pos, (uint32)num_bytes);
+        memset(data_msg.data() + pos + num_bytes,
+               0,
+               padded_bytes - num_bytes);
+        pos += padded_bytes;
+        num_blocks++;
+    }
+
+    memcpy(&data_msg[num_blocks_pos], &num_blocks, sizeof(uint32));
+    data_msg.resize(pos);
+
+    return new_schema;
+}
+
+//-----------------------------------------------------------------------------
+// NodeSnapshotPublisher Class Implementation
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+struct NodeSnapshotPublisher::Snapshot
+{
+    index_t                              version;
+    index_t                              schema_version;
+    Node                                 root;
+    std::vector<std::shared_ptr<Node> >  leaves;
+    std::vector<std::string>             leaf_paths;
+};
+
+//-----------------------------------------------------------------------------
+// helpers for building snapshots
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+//-----------------------------------------------------------------------------
+// checks if a compact leaf buffer holds the same type and values as a leaf
+//-----------------------------------------------------------------------------
+static bool
+snapshot_leaf_matches(const Node &leaf,
+                      const Node &buffer)
+{
+    const DataType &dt     = leaf.dtype();
+    const DataType &buf_dt = buffer.dtype();
+
+    if(dt.id()                 != buf_dt.id() ||
+       dt.number_of_elements() != buf_dt.number_of_elements() ||
+       dt.element_bytes()      != buf_dt.element_bytes() ||
+       dt.endianness()         != buf_dt.endianness())
+    {
+        return false;
+    }
+
+    const uint8 *buf_ptr = (const uint8*)buffer.element_ptr(0);
+    if(dt.is_compact())
+    {
+        return memcmp(leaf.element_ptr(0),
+                      buf_ptr,
+                      (size_t)dt.bytes_compact()) == 0;
+    }
+
+    index_t num_eles  = dt.number_of_elements();
+    index_t ele_bytes = dt.element_bytes();
+    for(index_t i = 0; i < num_eles; i++)
+    {
+        if(memcmp(leaf.element_ptr(i),
+                  buf_ptr + i * ele_bytes,
+                  (size_t)ele_bytes) != 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// state used while building a snapshot
+//-----------------------------------------------------------------------------
+struct SnapshotBuilder
+{
+    const std::vector<std::shared_ptr<Node> > *prev_leaves;
+    const std::vector<std::string>            *prev_leaf_paths;
+    // maps previous leaf paths to their index, built on the first leaf
+    // that can't be matched by position
+    std::map<std::string,size_t>               prev_leaf_index;
+    std::vector<std::shared_ptr<Node> >       *leaves;
+    std::vector<std::string>                  *leaf_paths;
+    index_t                                    num_copied;
+};
+
+//-----------------------------------------------------------------------------
+// returns a buffer from the previous snapshot that matches the leaf at
+// path, or an empty pointer
+//-----------------------------------------------------------------------------
+static std::shared_ptr<Node>
+snapshot_find_leaf(SnapshotBuilder &bldr,
+                   const Node &leaf,
+                   const std::string &path)
+{
+    const std::vector<std::shared_ptr<Node> > &prev = *bldr.prev_leaves;
+    const std::vector<std::string> &prev_paths = *bldr.prev_leaf_paths;
+
+    // leaves line up by position as long as the tree structure is the same
+    size_t idx = bldr.leaves->size();
+    if(idx < prev.size() && prev_paths[idx] == path)
+    {
+        return snapshot_leaf_matches(leaf, *prev[idx]) ? prev[idx]
+                                                       : std::shared_ptr<Node>();
+    }
+
+    if(bldr.prev_leaf_index.empty())
+    {
+        for(size_t i = 0; i < prev_paths.size(); i++)
+        {
+            bldr.prev_leaf_index[prev_paths[i]] = i;
+        }
+    }
+
+    std::map<std::string,size_t>::const_iterator itr;
+    itr = bldr.prev_leaf_index.find(path);
+    if(itr != bldr.prev_leaf_index.end() &&
+       snapshot_leaf_matches(leaf, *prev[itr->second]))
+    {
+        return prev[itr->second];
+    }
+
+    return std::shared_ptr<Node>();
+}
+
+//-----------------------------------------------------------------------------
+// mirrors the tree of src into dest, with leaves that reference reference
+// counted buffers. Buffers from the previous snapshot are reused for leaves
+// that did not change.
+//-----------------------------------------------------------------------------
+static void
+snapshot_build(const Node &src,
+               const std::string &path,
+               Node &dest,
+               SnapshotBuilder &bldr)
+{
+    index_t dtype_id = src.dtype().id();
+    if(dtype_id == DataType::OBJECT_ID || dtype_id == DataType::LIST_ID)
+    {
+        bool is_obj = (dtype_id == DataType::OBJECT_ID);
+        index_t num_children = src.number_of_children();
+        for(index_t i = 0; i < num_children; i++)
+        {
+            std::ostringstream oss;
+            if(!path.empty())
+            {
+                oss << path << "/";
+            }
+
+            if(is_obj)
+            {
+                const std::string &name = src.schema().child_name(i);
+                oss << name;
+                snapshot_build(src.child(i),
+                               oss.str(),
+                               dest.add_child(name),
+                               bldr);
+            }
+            else
+            {
+                oss << "[" << i << "]";
+                snapshot_build(src.child(i),
+                               oss.str(),
+                               dest.append(),
+                               bldr);
+            }
+        }
+    }
+    else if(dtype_id != DataType::EMPTY_ID)
+    {
+        std::shared_ptr<Node> buffer = snapshot_find_leaf(bldr, src, path);
+        if(!buffer)
+        {
+            buffer = std::make_shared<Node>();
+            src.compact_to(*buffer);
+            bldr.num_copied++;
+        }
+
+        bldr.leaves->push_back(buffer);
+        bldr.leaf_paths->push_back(path);
+        dest.set_external(*buffer);
+    }
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end detail --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+NodeSnapshotPublisher::NodeSnapshotPublisher()
+: m_latest(),
+  m_publish_mutex()
+{
+    // empty
+}
+
+//-----------------------------------------------------------------------------
+NodeSnapshotPublisher::~NodeSnapshotPublisher()
+{
+    // empty
+}
+
+//-----------------------------------------------------------------------------
+index_t
+NodeSnapshotPublisher::publish(const Node &data)
+{
+    std::lock_guard<std::mutex> lock(m_publish_mutex);
+
+    std::shared_ptr<Snapshot> prev = std::atomic_load(&m_latest);
+
+    std::shared_ptr<Snapshot> snap = std::make_shared<Snapshot>();
+    std::vector<std::shared_ptr<Node> > no_leaves;
+    std::vector<std::string> no_leaf_paths;
+
+    detail::SnapshotBuilder bldr;
+    bldr.prev_leaves     = prev ? &prev->leaves : &no_leaves;
+    bldr.prev_leaf_paths = prev ? &prev->leaf_paths : &no_leaf_paths;
+    bldr.leaves          = &snap->leaves;
+    bldr.leaf_paths      = &snap->leaf_paths;
+    bldr.num_copied      = 0;
+
+    detail::snapshot_build(data, "", snap->root, bldr);
+
+    snap->version = prev ? prev->version + 1 : 1;
+    snap->schema_version = 1;
+    if(prev)
+    {
+        snap->schema_version = prev->schema_version;
+        if(!snap->root.schema().equals(prev->root.schema()))
+        {
+            snap->schema_version++;
+        }
+    }
+
+    // readers that hold the previous snapshot keep it alive
+    std::atomic_store(&m_latest, snap);
+
+    return bldr.num_copied;
+}
+
+//-----------------------------------------------------------------------------
+std::shared_ptr<const Node>
+NodeSnapshotPublisher::latest(index_t *schema_version) const
+{
+    std::shared_ptr<Snapshot> snap = std::atomic_load(&m_latest);
+    if(!snap)
+    {
+        if(schema_version != NULL)
+        {
+            *schema_version = 0;
+        }
+        return std::shared_ptr<const Node>();
+    }
+
+    if(schema_version != NULL)
+    {
+        *schema_version = snap->schema_version;
+    }
+
+    // share ownership of the whole snapshot, but point to its root
+    return std::shared_ptr<const Node>(snap, &snap->root);
+}
+
+//-----------------------------------------------------------------------------
+index_t
+NodeSnapshotPublisher::version() const
+{
+    std::shared_ptr<Snapshot> snap = std::atomic_load(&m_latest);
+    return snap ? snap->version : 0;
+}
+
 //-----------------------------------------------------------------------------
 // WebSocket Class Implementation
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
 WebSocket::WebSocket()
-: m_connection(NULL)
+: m_connection(NULL),
+  m_stream(),
+  m_stream_schema_msg(),
+  m_stream_data_msg(),
+  m_stream_mutex()
 {
     // empty
 }
@@ -527,16 +1095,57 @@ WebSocket::send(const Node &data,
     std::ostringstream oss;
     data.to_json_stream(oss,protocol);
     
-    // get the length of our  message data.
-    size_t        msg_len = oss.str().size();
+    // oss.str() returns a copy, fetch it once
+    std::string msg = oss.str();
 
     lock_context();
     {
         // send our message via civetweb's websocket interface
         mg_websocket_write(m_connection,
                            WEBSOCKET_OPCODE_TEXT,
-                           oss.str().c_str(),
-                           msg_len);
+                           msg.c_str(),
+                           msg.size());
+    }
+    unlock_context();
+}
+
+//-----------------------------------------------------------------------------
+void
+WebSocket::send_binary(const Node &data,
+                       bool skip_unchanged)
+{
+    if(m_connection == NULL)
+    {
+        CONDUIT_WARN("attempt to write to bad websocket connection");
+        return;
+    }
+
+    // the encoder state and the reused message buffers are shared by
+    // all sends on this socket, so encode and write under one lock.
+    // each connection gets its own WebSocket, so the encoder starts
+    // fresh for every client.
+    std::lock_guard<std::mutex> lock(m_stream_mutex);
+
+    // reuse our message buffers between sends
+    bool new_schema = m_stream.encode(data,
+                                      skip_unchanged,
+                                      m_stream_schema_msg,
+                                      m_stream_data_msg);
+
+    lock_context();
+    {
+        if(new_schema)
+        {
+            mg_websocket_write(m_connection,
+                               WEBSOCKET_OPCODE_TEXT,
+                               m_stream_schema_msg.c_str(),
+                               m_stream_schema_msg.size());
+        }
+
+        mg_websocket_write(m_connection,
+                           WEBSOCKET_OPCODE_BINARY,
+                           (const char*)m_stream_data_msg.data(),
+                           m_stream_data_msg.size());
     }
     unlock_context();
 }
@@ -18,6 +18,9 @@
 
 #include "conduit_relay_exports.h"
 
+#include <memory>
+#include <mutex>
+
 //
 // forward declare civetweb types so we don't need the 
 // civetweb headers in our public interface. 
@@ -186,6 +189,121 @@ private:
 
 };
 
+//-----------------------------------------------------------------------------
+/// -- Binary WebSocket Streaming Encoder -
+//-----------------------------------------------------------------------------
+//
+/// Encodes a Node using the binary streaming protocol used by
+/// WebSocket::send_binary(). The schema is sent once, as a JSON text
+/// message, and each update after that is a binary message that holds only
+/// raw leaf data.
+///
+/// The schema message is created on the first encode and again whenever the
+/// schema changes:
+///
+///   {"type": "conduit_stream_schema",
+///    "schema_id": 1,
+///    "endianness": "little",
+///    "schema": { compact conduit schema },
+///    "leaves": [ {"path": "a/b",
+///                 "dtype": "float64",
+///                 "number_of_elements": 10,
+///                 "element_bytes": 8}, ... ] }
+///
+/// Each encode creates a binary data message:
+///
+///   char[4]   "CDAT"
+///   uint32    schema id
+///   uint64    sequence number
+///   uint32    number of leaf blocks
+///   uint32    reserved (0)
+///
+///   then, for each leaf block:
+///     uint32  leaf index (into "leaves")
+///     uint32  number of data bytes
+///     bytes   compact leaf data, zero padded to a multiple of 8 bytes
+///
+/// Integers in the header use the endianness from the schema message. Leaf
+/// data starts on an 8 byte boundary, so clients can view it as a typed
+/// array without copying it.
+///
+/// When skip_unchanged is true, the data message leaves out any leaf whose
+/// data matches the previous encode. Changes are found by hashing each leaf.
+/// The first data message after a schema message always holds every leaf.
+//
+class CONDUIT_RELAY_API WebStreamEncoder
+{
+public:
+                WebStreamEncoder();
+               ~WebStreamEncoder();
+
+    /// forgets the current schema, so the next encode starts over
+    void        reset();
+
+    /// encodes data, returns true if schema_msg holds a new schema message
+    /// (otherwise schema_msg is cleared)
+    bool        encode(const Node &data,
+                       bool skip_unchanged,
+                       std::string &schema_msg,
+                       std::vector<uint8> &data_msg);
+
+    /// id of the current schema, 0 before the first encode
+    index_t     schema_id() const;
+    /// number of leaves in the current schema
+    index_t     number_of_leaves() const;
+
+private:
+    uint64                  m_schema_hash;
+    uint32                  m_schema_id;
+    uint64                  m_sequence;
+    bool                    m_has_schema;
+    std::vector<uint64>     m_leaf_hashes;
+};
+
+//-----------------------------------------------------------------------------
+/// -- Node Snapshot Publisher -
+//-----------------------------------------------------------------------------
+//
+/// Shares consistent views of a Node that a simulation keeps changing with
+/// web server threads, without stopping the simulation.
+///
+/// The simulation calls publish(), which builds an immutable snapshot and
+/// swaps it in with an atomic pointer store. Server threads call latest(),
+/// an atomic pointer load, and can read the snapshot for as long as they
+/// hold it. Readers never block the publisher.
+///
+/// Snapshot leaves are reference counted and copied on publish only when
+/// they change. A leaf that matches the previous snapshot (same path, type,
+/// length and bytes) shares that snapshot's buffer, so an unchanged
+/// mesh costs a compare instead of a copy.
+//
+class CONDUIT_RELAY_API NodeSnapshotPublisher
+{
+public:
+                NodeSnapshotPublisher();
+               ~NodeSnapshotPublisher();
+
+    /// publishes a snapshot of data, returns the number of leaves copied
+    /// (leaves that did not change are shared with the last snapshot)
+    index_t     publish(const Node &data);
+
+    /// returns the latest snapshot, or an empty pointer before the first
+    /// publish. If schema_version is not NULL, it is set to a counter that
+    /// changes only when the snapshot's schema changes.
+    std::shared_ptr<const Node> latest(index_t *schema_version = NULL) const;
+
+    /// number of snapshots published so far
+    index_t     version() const;
+
+private:
+    // holds the snapshot tree and the leaf buffers it references
+    struct Snapshot;
+
+    std::shared_ptr<Snapshot>   m_latest;
+    // serializes publishers, readers never take this lock
+    std::mutex                  m_publish_mutex;
+};
+
 //-----------------------------------------------------------------------------
 /// -- WebSocket Connection Interface -
 //-----------------------------------------------------------------------------
@@ -201,6 +319,12 @@ public:
     void           send(const Node &data,
                         const std::string &protocol="json");
 
+    /// sends data using the binary streaming protocol (see
+    /// WebStreamEncoder). The schema is sent only when it changes, and
+    /// with skip_unchanged only modified leaves are sent.
+    void           send_binary(const Node &data,
+                               bool skip_unchanged = false);
+
     // todo: receive? 
 
     bool           is_connected() const;
@@ -215,7 +339,12 @@ private:
 
     void           set_connection(mg_connection *connection);
 
-    mg_connection  *m_connection;
+    mg_connection      *m_connection;
+
+    WebStreamEncoder    m_stream;
+    std::string         m_stream_schema_msg;
+    std::vector<uint8>  m_stream_data_msg;
+    std::mutex          m_stream_mutex;
 };
 
 
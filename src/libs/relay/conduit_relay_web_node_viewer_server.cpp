@@ -12,6 +12,8 @@
 // std lib includes
 //-----------------------------------------------------------------------------
 #include <string.h>
+#include <sstream>
+#include <streambuf>
 
 //-----------------------------------------------------------------------------
 // external lib includes
@@ -44,13 +46,200 @@ namespace relay
 namespace web
 {
 
+//-----------------------------------------------------------------------------
+// -- Node Viewer Helpers  -
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+// max number of cached schema pages, the cache is cleared when exceeded
+static const size_t SCHEMA_CACHE_MAX_ENTRIES = 1024;
+
+// max size of the post data of a request, larger requests are rejected
+static const size_t POST_DATA_MAX_SIZE = 64 * 1024;
+
+//---------------------------------------------------------------------------//
+// Buffered stream that writes to a civetweb connection, so large responses
+// are sent in pieces instead of built up as one string.
+//---------------------------------------------------------------------------//
+class ConnectionStreamBuf : public std::streambuf
+{
+public:
+    ConnectionStreamBuf(struct mg_connection *conn)
+    : m_conn(conn)
+    {
+        setp(m_buffer, m_buffer + sizeof(m_buffer) - 1);
+    }
+
+    virtual ~ConnectionStreamBuf()
+    {
+        flush_buffer();
+    }
+
+protected:
+    virtual int_type overflow(int_type c)
+    {
+        if(c != traits_type::eof())
+        {
+            // we reserved one char in the buffer for this case
+            *pptr() = (char)c;
+            pbump(1);
+        }
+        return flush_buffer() ? traits_type::not_eof(c) : traits_type::eof();
+    }
+
+    virtual int sync()
+    {
+        return flush_buffer() ? 0 : -1;
+    }
+
+private:
+    bool flush_buffer()
+    {
+        std::ptrdiff_t num_bytes = pptr() - pbase();
+        bool ok = true;
+        if(num_bytes > 0)
+        {
+            ok = mg_write(m_conn, pbase(), (size_t)num_bytes) == num_bytes;
+        }
+        setp(m_buffer, m_buffer + sizeof(m_buffer) - 1);
+        return ok;
+    }
+
+    struct mg_connection *m_conn;
+    char                  m_buffer[64 * 1024];
+};
+
+//---------------------------------------------------------------------------//
+// fetches the value of a url encoded arg, returns false if it is missing
+//---------------------------------------------------------------------------//
+static bool
+request_arg(const std::string &args,
+            const std::string &name,
+            std::string &value)
+{
+    std::vector<char> buffer(args.size() + 1);
+    int res = mg_get_var(args.c_str(),
+                         args.size(),
+                         name.c_str(),
+                         &buffer[0],
+                         buffer.size());
+    if(res < 0)
+    {
+        return false;
+    }
+    value = std::string(&buffer[0], (size_t)res);
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+static index_t
+request_arg_as_index_t(const std::string &args,
+                       const std::string &name,
+                       index_t def)
+{
+    std::string value;
+    if(!request_arg(args, name, value) || value.empty())
+    {
+        return def;
+    }
+    return (index_t)utils::string_to_value<int64>(value);
+}
+
+//---------------------------------------------------------------------------//
+// limits [start, start+count) to [0, size), count < 0 selects all
+//---------------------------------------------------------------------------//
+static void
+clamp_window(index_t size, index_t &start, index_t &count)
+{
+    if(start < 0)
+    {
+        start = 0;
+    }
+
+    if(start > size)
+    {
+        start = size;
+    }
+
+    if(count < 0 || count > size - start)
+    {
+        count = size - start;
+    }
+}
+
+//---------------------------------------------------------------------------//
+// writes schema json, replacing objects and lists below the given depth
+// with a summary
+//---------------------------------------------------------------------------//
+static void
+write_schema_json(const Schema &schema,
+                  index_t depth,
+                  std::ostream &os)
+{
+    index_t dtype_id = schema.dtype().id();
+    if(dtype_id != DataType::OBJECT_ID && dtype_id != DataType::LIST_ID)
+    {
+        schema.dtype().to_json_stream(os,0,0,""," ");
+        return;
+    }
+
+    index_t num_children = schema.number_of_children();
+    if(depth == 0)
+    {
+        os << "{\"number_of_children\": " << num_children
+           << ", \"truncated\": true}";
+        return;
+    }
+
+    bool is_obj = (dtype_id == DataType::OBJECT_ID);
+    os << (is_obj ? "{" : "[");
+    for(index_t i = 0; i < num_children; i++)
+    {
+        if(i > 0)
+        {
+            os << ", ";
+        }
+
+        if(is_obj)
+        {
+            os << "\"" << utils::escape_special_chars(schema.child_name(i))
+               << "\": ";
+        }
+        write_schema_json(schema.child(i), depth - 1, os);
+    }
+    os << (is_obj ? "}" : "]");
+}
+
+//---------------------------------------------------------------------------//
+static void
+write_json_error(struct mg_connection *conn,
+                 int status,
+                 const std::string &status_msg,
+                 const std::string &msg)
+{
+    mg_printf(conn,
+              "HTTP/1.1 %d %s\r\nContent-Type: application/json\r\n\r\n",
+              status,
+              status_msg.c_str());
+    mg_printf(conn,
+              "{ \"error\": \"%s\" }",
+              utils::escape_special_chars(msg).c_str());
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end detail --
+//-----------------------------------------------------------------------------
+
 //-----------------------------------------------------------------------------
 // -- Viewer Request Handler  -
 //-----------------------------------------------------------------------------
 
 NodeViewerRequestHandler::NodeViewerRequestHandler()
 : WebRequestHandler(),
-  m_node(NULL)
+  m_node(NULL),
+  m_publisher(NULL)
 {
     // empty
 }
@@ -90,14 +279,56 @@ NodeViewerRequestHandler::handle_request(WebServer *server,
     std::string uri_cmd;
     std::string uri_next;
     utils::rsplit_string(uri,"/",uri_cmd,uri_next);
+
+    // gather args from the query string and any url encoded post data
+    std::string args;
+    if(req_info->query_string != NULL)
+    {
+        args = req_info->query_string;
+    }
+
+    // stop reading at a fixed size, so clients can't grow this process
+    // without bound with large or endless post data
+    bool too_large = req_info->content_length >
+                        (long long)detail::POST_DATA_MAX_SIZE;
+    size_t post_data_size = 0;
+    char post_data[4096];
+    int  post_data_len = 0;
+    while( !too_large &&
+           (post_data_len = mg_read(conn,
+                                    post_data,
+                                    sizeof(post_data))) > 0)
+    {
+        post_data_size += (size_t)post_data_len;
+        if(post_data_size > detail::POST_DATA_MAX_SIZE)
+        {
+            too_large = true;
+            break;
+        }
+
+        if(!args.empty() && args[args.size()-1] != '&')
+        {
+            args += "&";
+        }
+        args.append(post_data, (size_t)post_data_len);
+    }
+
+    if(too_large)
+    {
+        std::ostringstream oss;
+        oss << "post data is larger than the "
+            << detail::POST_DATA_MAX_SIZE << " byte limit";
+        detail::write_json_error(conn, 413, "Payload Too Large", oss.str());
+        return true;
+    }
     
     if(uri_cmd == "get-schema")
     {
-        return handle_get_schema(conn);
+        return handle_get_schema(conn,args);
     }
     else if(uri_cmd == "get-value")
     {
-        return handle_get_value(conn);
+        return handle_get_value(conn,args);
     }
     else if(uri_cmd == "get-base64-json")
     {
@@ -121,19 +352,47 @@ NodeViewerRequestHandler::handle_request(WebServer *server,
 // Handles a request from the client for the node's schema.
 //---------------------------------------------------------------------------//
 bool
-NodeViewerRequestHandler::handle_get_schema(struct mg_connection *conn)
+NodeViewerRequestHandler::handle_get_schema(struct mg_connection *conn,
+                                            const std::string &args)
 {
-    if(m_node != NULL)
+    index_t generation = 0;
+    std::shared_ptr<const Node> root = current_node(generation);
+    if(!root)
     {
-        mg_printf(conn,
-                  "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\n\r\n");
-        mg_printf(conn, "%s",m_node->schema().to_json(true).c_str());
+        CONDUIT_WARN("rest request for schema of NULL Node");
+        return false;
+    }
+
+    std::string path;
+    bool has_path  = detail::request_arg(args,"path",path);
+    index_t start  = detail::request_arg_as_index_t(args,"start",-1);
+    index_t count  = detail::request_arg_as_index_t(args,"count",-1);
+    index_t depth  = detail::request_arg_as_index_t(args,"depth",-1);
+    bool    paged  = has_path || start >= 0 || count >= 0 || depth >= 0;
+
+    if(paged && !path.empty() && !root->has_path(path))
+    {
+        detail::write_json_error(conn, 404, "Not Found",
+                                 "path not found: " + path);
+        return true;
+    }
+
+    mg_printf(conn,
+              "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\n\r\n");
+
+    detail::ConnectionStreamBuf sbuf(conn);
+    std::ostream os(&sbuf);
+
+    if(paged)
+    {
+        write_schema_page(*root, generation, path, start, count, depth, os);
     }
     else
     {
-        CONDUIT_WARN("rest request for schema of NULL Node");
-        return false;
+        root->schema().to_json_stream(os);
     }
+    os.flush();
+
     return true;
 }
 
@@ -141,33 +400,279 @@ NodeViewerRequestHandler::handle_get_schema(struct mg_connection *conn)
 // Handles a request from the client for a specific value in the node.
 //---------------------------------------------------------------------------//
 bool
-NodeViewerRequestHandler::handle_get_value(struct mg_connection *conn)
+NodeViewerRequestHandler::handle_get_value(struct mg_connection *conn,
+                                           const std::string &args)
 {
-    if(m_node != NULL)
+    index_t generation = 0;
+    std::shared_ptr<const Node> root = current_node(generation);
+    if(!root)
     {
-        // TODO size checks?
-        char post_data[2048];
-        char cpath[2048];
+        CONDUIT_WARN("rest request for value of NULL Node");
+        return false;
+    }
 
-        int post_data_len = mg_read(conn, post_data, sizeof(post_data));
-        
-        // TODO: path instead of cpath?
-        
-        mg_get_var(post_data, post_data_len, "cpath", cpath, sizeof(cpath));
-        // TODO: value instead of datavalue
-        mg_printf(conn,
-                  "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\n\r\n");
-        mg_printf(conn, "{ \"datavalue\": %s }",
-                  m_node->fetch(cpath).to_json().c_str());
+    std::string path;
+    // cpath is the arg name used by older clients
+    if(!detail::request_arg(args,"path",path))
+    {
+        detail::request_arg(args,"cpath",path);
+    }
+    index_t start = detail::request_arg_as_index_t(args,"start",0);
+    index_t count = detail::request_arg_as_index_t(args,"count",-1);
+
+    if(!path.empty() && !root->has_path(path))
+    {
+        detail::write_json_error(conn, 404, "Not Found",
+                                 "path not found: " + path);
+        return true;
+    }
+
+    mg_printf(conn,
+              "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\n\r\n");
+
+    detail::ConnectionStreamBuf sbuf(conn);
+    std::ostream os(&sbuf);
+    write_value_page(*root, path, start, count, os);
+    os.flush();
+
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+bool
+NodeViewerRequestHandler::write_schema_page(const std::string &path,
+                                            index_t start,
+                                            index_t count,
+                                            index_t depth,
+                                            std::ostream &os)
+{
+    index_t generation = 0;
+    std::shared_ptr<const Node> root = current_node(generation);
+    if(!root)
+    {
+        return false;
+    }
+    return write_schema_page(*root, generation, path, start, count, depth, os);
+}
+
+//---------------------------------------------------------------------------//
+bool
+NodeViewerRequestHandler::write_schema_page(const Node &root,
+                                            index_t generation,
+                                            const std::string &path,
+                                            index_t start,
+                                            index_t count,
+                                            index_t depth,
+                                            std::ostream &os)
+{
+    if(!path.empty() && !root.has_path(path))
+    {
+        return false;
+    }
+
+    const Node &node = path.empty() ? root : root.fetch_existing(path);
+    const Schema &schema = node.schema();
+    const DataType &dtype = schema.dtype();
+
+    index_t num_children = schema.number_of_children();
+    detail::clamp_window(num_children, start, count);
+
+    std::ostringstream key_oss;
+    key_oss << path << "\n" << start << "\n" << count << "\n" << depth;
+    std::string key = key_oss.str();
+
+    {
+        std::lock_guard<std::mutex> lock(m_schema_cache_mutex);
+        std::map<std::string,SchemaPage>::const_iterator itr;
+        itr = m_schema_cache.find(key);
+        if(itr != m_schema_cache.end() &&
+           itr->second.schema == &schema &&
+           itr->second.generation == generation &&
+           itr->second.dtype_id == dtype.id() &&
+           itr->second.number_of_children == num_children &&
+           itr->second.number_of_elements == dtype.number_of_elements())
+        {
+            os << itr->second.json;
+            return true;
+        }
+    }
+
+    std::ostringstream oss;
+    oss << "{\"path\": \"" << utils::escape_special_chars(path) << "\", "
+        << "\"number_of_children\": " << num_children << ", ";
+
+    if(dtype.id() == DataType::OBJECT_ID || dtype.id() == DataType::LIST_ID)
+    {
+        bool is_obj = (dtype.id() == DataType::OBJECT_ID);
+        oss << "\"start\": " << start << ", "
+            << "\"count\": " << count << ", "
+            << "\"schema\": " << (is_obj ? "{" : "[");
+        for(index_t i = start; i < start + count; i++)
+        {
+            if(i > start)
+            {
+                oss << ", ";
+            }
+
+            if(is_obj)
+            {
+                oss << "\""
+                    << utils::escape_special_chars(schema.child_name(i))
+                    << "\": ";
+            }
+            detail::write_schema_json(schema.child(i), depth, oss);
+        }
+        oss << (is_obj ? "}" : "]");
     }
     else
     {
-        CONDUIT_WARN("rest request for value of NULL Node");
+        oss << "\"number_of_elements\": " << dtype.number_of_elements()
+            << ", \"schema\": ";
+        detail::write_schema_json(schema, -1, oss);
+    }
+    oss << "}";
+
+    SchemaPage page;
+    page.schema = &schema;
+    page.generation = generation;
+    page.dtype_id = dtype.id();
+    page.number_of_children = num_children;
+    page.number_of_elements = dtype.number_of_elements();
+    page.json = oss.str();
+
+    os << page.json;
+
+    {
+        std::lock_guard<std::mutex> lock(m_schema_cache_mutex);
+        if(m_schema_cache.size() >= detail::SCHEMA_CACHE_MAX_ENTRIES)
+        {
+            m_schema_cache.clear();
+        }
+        m_schema_cache[key] = page;
+    }
+
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+bool
+NodeViewerRequestHandler::write_value_page(const std::string &path,
+                                           index_t start,
+                                           index_t count,
+                                           std::ostream &os)
+{
+    index_t generation = 0;
+    std::shared_ptr<const Node> root = current_node(generation);
+    if(!root)
+    {
         return false;
     }
+    return write_value_page(*root, path, start, count, os);
+}
+
+//---------------------------------------------------------------------------//
+bool
+NodeViewerRequestHandler::write_value_page(const Node &root,
+                                           const std::string &path,
+                                           index_t start,
+                                           index_t count,
+                                           std::ostream &os)
+{
+    if(!path.empty() && !root.has_path(path))
+    {
+        return false;
+    }
+
+    const Node &node = path.empty() ? root : root.fetch_existing(path);
+    const DataType &dtype = node.dtype();
+
+    os << "{ \"path\": \"" << utils::escape_special_chars(path) << "\", ";
+
+    if(dtype.id() == DataType::OBJECT_ID || dtype.id() == DataType::LIST_ID)
+    {
+        bool is_obj = (dtype.id() == DataType::OBJECT_ID);
+        index_t num_children = node.number_of_children();
+        detail::clamp_window(num_children, start, count);
+
+        os << "\"number_of_children\": " << num_children << ", "
+           << "\"start\": " << start << ", "
+           << "\"count\": " << count << ", "
+           << "\"datavalue\": " << (is_obj ? "{" : "[");
+        for(index_t i = start; i < start + count; i++)
+        {
+            if(i > start)
+            {
+                os << ", ";
+            }
+
+            if(is_obj)
+            {
+                os << "\""
+                   << utils::escape_special_chars(node.schema().child_name(i))
+                   << "\": ";
+            }
+            node.child(i).to_json_stream(os,"json",0,0,""," ");
+        }
+        os << (is_obj ? "}" : "]");
+    }
+    else
+    {
+        index_t num_eles = dtype.number_of_elements();
+        detail::clamp_window(num_eles, start, count);
+
+        os << "\"number_of_elements\": " << num_eles << ", "
+           << "\"start\": " << start << ", "
+           << "\"count\": " << count << ", "
+           << "\"datavalue\": ";
+
+        if(dtype.is_string() || dtype.is_empty() ||
+           (start == 0 && count == num_eles))
+        {
+            // strings are always sent whole
+            node.to_json_stream(os,"json",0,0,""," ");
+        }
+        else if(count == 0)
+        {
+            os << "[]";
+        }
+        else
+        {
+            // view the window in place, elements are written as they are
+            // read, without a copy of the whole leaf
+            DataType window(dtype.id(),
+                            count,
+                            dtype.offset() + start * dtype.stride(),
+                            dtype.stride(),
+                            dtype.element_bytes(),
+                            dtype.endianness());
+            Node n_window;
+            n_window.set_external(window,const_cast<void*>(node.data_ptr()));
+
+            if(count == 1)
+            {
+                os << "[";
+                n_window.to_json_stream(os,"json",0,0,""," ");
+                os << "]";
+            }
+            else
+            {
+                n_window.to_json_stream(os,"json",0,0,""," ");
+            }
+        }
+    }
+    os << " }";
+
     return true;
 }
 
+//---------------------------------------------------------------------------//
+void
+NodeViewerRequestHandler::clear_schema_cache()
+{
+    std::lock_guard<std::mutex> lock(m_schema_cache_mutex);
+    m_schema_cache.clear();
+}
+
 //---------------------------------------------------------------------------//
 // Handles a request from the client for a compact, base64 encoded version
 // of the node.
@@ -175,14 +680,17 @@ NodeViewerRequestHandler::handle_get_value(struct mg_connection *conn)
 bool
 NodeViewerRequestHandler::handle_get_base64_json(struct mg_connection *conn)
 {
-    if(m_node != NULL)
+    index_t generation = 0;
+    std::shared_ptr<const Node> root = current_node(generation);
+    if(root)
     {
-        std::ostringstream oss;
-        m_node->to_json_stream(oss,"conduit_base64_json");
-        
         mg_printf(conn,
                   "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\n\r\n");
-        mg_printf(conn, "%s",oss.str().c_str());
+
+        detail::ConnectionStreamBuf sbuf(conn);
+        std::ostream os(&sbuf);
+        root->to_json_stream(os,"conduit_base64_json");
+        os.flush();
     }
     else
     {
@@ -210,6 +718,40 @@ void
 NodeViewerRequestHandler::set_node(Node *node)
 {
     m_node = node;
+    clear_schema_cache();
+}
+
+//---------------------------------------------------------------------------//
+// Sets the snapshot publisher to serve views from
+//---------------------------------------------------------------------------//
+void
+NodeViewerRequestHandler::set_snapshot_publisher(NodeSnapshotPublisher *pub)
+{
+    m_publisher = pub;
+    clear_schema_cache();
+}
+
+//---------------------------------------------------------------------------//
+// Returns the node to serve a request from. With a snapshot publisher,
+// this is the latest snapshot, which stays valid while we hold it even if
+// a newer one is published.
+//---------------------------------------------------------------------------//
+std::shared_ptr<const Node>
+NodeViewerRequestHandler::current_node(index_t &generation) const
+{
+    generation = 0;
+    if(m_publisher != NULL)
+    {
+        return m_publisher->latest(&generation);
+    }
+
+    if(m_node == NULL)
+    {
+        return std::shared_ptr<const Node>();
+    }
+
+    // we don't own m_node, don't delete it
+    return std::shared_ptr<const Node>(m_node, [](const Node*){});
 }
 
 
@@ -241,6 +783,14 @@ NodeViewerServer::set_node(Node *data)
     req_handler->set_node(data);
 }
 
+//---------------------------------------------------------------------------//
+void
+NodeViewerServer::set_snapshot_publisher(NodeSnapshotPublisher *pub)
+{
+    NodeViewerRequestHandler *req_handler=(NodeViewerRequestHandler*)handler();
+    req_handler->set_snapshot_publisher(pub);
+}
+
 
 }
 //-----------------------------------------------------------------------------
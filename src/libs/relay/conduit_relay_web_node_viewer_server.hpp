@@ -19,6 +19,9 @@
 #include "conduit_relay_exports.h"
 #include "conduit_relay_web.hpp"
 
+#include <map>
+#include <mutex>
+
 //-----------------------------------------------------------------------------
 // -- begin conduit:: --
 //-----------------------------------------------------------------------------
@@ -40,6 +43,31 @@ namespace web
 //-----------------------------------------------------------------------------
 // -- Viewer Web Request Handler  -
 //-----------------------------------------------------------------------------
+//
+/// REST api:
+///
+///  get-schema
+///    no args: the schema of the whole node
+///    path, start, count, depth: a page of the schema of the node at path,
+///      holding children [start, start+count), descending at most depth
+///      levels (-1 for no limit). Deeper objects and lists are replaced by
+///      {"number_of_children": n, "truncated": true}.
+///
+///  get-value
+///    path (or cpath), start, count: the children [start, start+count)
+///      of the node at path, or the elements [start, start+count) of a leaf.
+///
+/// Args can be passed in the query string or as url encoded post data.
+/// Requests with more than 64 KiB of post data are rejected with a 413.
+/// Responses are streamed to the client. Schema pages are cached by path,
+/// window and depth. Entries are checked against the node at path, but
+/// clear_schema_cache() must be called after changes below that node.
+///
+/// Requests are served from the node passed to set_node(), or, when a
+/// snapshot publisher is set, from its latest snapshot. Snapshots give
+/// consistent views while the simulation keeps running, and the schema
+/// cache is refreshed when their schema changes.
+//
 class CONDUIT_RELAY_API NodeViewerRequestHandler : public WebRequestHandler
 {
 public:
@@ -54,18 +82,79 @@ public:
                               
     void           set_node(Node *node);
 
+    /// serve requests from the latest snapshot of pub (which takes
+    /// precedence over set_node). The handler does not take ownership.
+    void           set_snapshot_publisher(NodeSnapshotPublisher *pub);
+
+    /// writes a schema page (see get-schema) as json
+    /// returns false if the path does not exist
+    bool           write_schema_page(const std::string &path,
+                                     index_t start,
+                                     index_t count,
+                                     index_t depth,
+                                     std::ostream &os);
+
+    /// writes a value page (see get-value) as json
+    /// returns false if the path does not exist
+    bool           write_value_page(const std::string &path,
+                                    index_t start,
+                                    index_t count,
+                                    std::ostream &os);
+
+    /// drops all cached schema pages
+    void           clear_schema_cache();
+
 private:
     // catch all, used for any post or get
     bool           handle_request(WebServer *server,
                                   struct mg_connection *conn);
     // handlers for specific commands 
-    bool           handle_get_schema(struct mg_connection *conn);
-    bool           handle_get_value(struct mg_connection *conn);
+    bool           handle_get_schema(struct mg_connection *conn,
+                                     const std::string &args);
+    bool           handle_get_value(struct mg_connection *conn,
+                                    const std::string &args);
     bool           handle_get_base64_json(struct mg_connection *conn);
     bool           handle_shutdown(WebServer *server);
 
+    // the node requests are served from, generation identifies its schema
+    // for the schema cache
+    std::shared_ptr<const Node> current_node(index_t &generation) const;
+
+    bool           write_schema_page(const Node &root,
+                                     index_t generation,
+                                     const std::string &path,
+                                     index_t start,
+                                     index_t count,
+                                     index_t depth,
+                                     std::ostream &os);
+
+    bool           write_value_page(const Node &root,
+                                    const std::string &path,
+                                    index_t start,
+                                    index_t count,
+                                    std::ostream &os);
+
+    // cached schema pages, keyed by path, window and depth. a page is
+    // reused only for the same schema object (which catches a replaced
+    // subtree of a set_node() node) in the same snapshot generation
+    // (which catches a schema address reused by a newer snapshot)
+    struct SchemaPage
+    {
+        const Schema *schema;
+        index_t       generation;
+        index_t       dtype_id;
+        index_t       number_of_children;
+        index_t       number_of_elements;
+        std::string   json;
+    };
+
     // holds the node to visualize 
-    Node          *m_node;
+    Node                               *m_node;
+    // optional source of snapshots of the node to visualize
+    NodeSnapshotPublisher              *m_publisher;
+
+    std::map<std::string,SchemaPage>    m_schema_cache;
+    std::mutex                          m_schema_cache_mutex;
 };
 
 //-----------------------------------------------------------------------------
@@ -80,6 +169,7 @@ public:
     virtual ~NodeViewerServer();
 
     void    set_node(Node *node);
+    void    set_snapshot_publisher(NodeSnapshotPublisher *pub);
 
 };
 
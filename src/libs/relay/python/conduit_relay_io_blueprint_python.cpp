@@ -104,6 +104,8 @@ PyRelay_io_blueprint_write_mesh(PyObject *, //self
     
     try
     {
+        PyConduit_Allow_Threads allow_threads(py_node, py_options);
+        relay::io::IOLibraryLock io_lock(protocol_str);
         relay::io::blueprint::write_mesh(node,
                                          std::string(path),
                                          protocol_str,
@@ -189,6 +191,8 @@ PyRelay_io_blueprint_save_mesh(PyObject *, //self
     
     try
     {
+        PyConduit_Allow_Threads allow_threads(py_node, py_options);
+        relay::io::IOLibraryLock io_lock(protocol_str);
         relay::io::blueprint::save_mesh(node,
                                         std::string(path),
                                         protocol_str,
@@ -266,6 +270,9 @@ PyRelay_io_blueprint_read_mesh(PyObject *, //self
 
     try
     {
+        PyConduit_Allow_Threads allow_threads(py_node, py_options);
+        // the protocol comes from the root file, so lock for any library
+        relay::io::IOLibraryLock io_lock("");
         relay::io::blueprint::read_mesh(std::string(path),
                                         *opts_ptr,
                                         node);
@@ -340,6 +347,9 @@ PyRelay_io_blueprint_load_mesh(PyObject *, //self
 
     try
     {
+        PyConduit_Allow_Threads allow_threads(py_node, py_options);
+        // the protocol comes from the root file, so lock for any library
+        relay::io::IOLibraryLock io_lock("");
         relay::io::blueprint::load_mesh(std::string(path),
                                         *opts_ptr,
                                         node);
@@ -25,6 +25,7 @@
 // -- standard lib includes -- 
 //-----------------------------------------------------------------------------
 #include <iostream>
+#include <mutex>
 #include <vector>
 
 //---------------------------------------------------------------------------//
@@ -149,7 +150,38 @@ PyString_FromString(const char *s)
 struct PyRelay_IOHandle
 {
     PyObject_HEAD
-    IOHandle *handle;
+    IOHandle    *handle;
+    // serializes calls on this handle once the GIL is released
+    std::mutex  *handle_mutex;
+    // protocol of the open file, used to pick the relay io library lock
+    std::string *protocol;
+};
+
+//---------------------------------------------------------------------------//
+// Held while calling into an IOHandle: releases the GIL, then serializes
+// calls on the handle and into I/O libraries that are not thread safe.
+// Members are destroyed in reverse order, so the GIL is reacquired last.
+//---------------------------------------------------------------------------//
+class PyRelay_IOHandle_Lock
+{
+public:
+    explicit PyRelay_IOHandle_Lock(PyRelay_IOHandle *self,
+                                   PyObject *obj0 = NULL,
+                                   PyObject *obj1 = NULL)
+    : m_allow_threads((PyObject*)self, obj0, obj1),
+      m_handle_lock(*self->handle_mutex),
+      m_io_lock(*self->protocol)
+    {
+        // empty
+    }
+
+private:
+    PyRelay_IOHandle_Lock(const PyRelay_IOHandle_Lock &);
+    PyRelay_IOHandle_Lock &operator=(const PyRelay_IOHandle_Lock &);
+
+    PyConduit_Allow_Threads     m_allow_threads;
+    std::lock_guard<std::mutex> m_handle_lock;
+    relay::io::IOLibraryLock    m_io_lock;
 };
 
 
@@ -172,6 +204,8 @@ PyRelay_IOHandle_new(PyTypeObject *type,
     if (self)
     {
         self->handle = 0;
+        self->handle_mutex = 0;
+        self->protocol = 0;
     }
 
     return ((PyObject*)self);
@@ -185,6 +219,16 @@ PyRelay_IOHandle_dealloc(PyRelay_IOHandle *self)
     {
         delete self->handle;
     }
+
+    if(self->handle_mutex != NULL)
+    {
+        delete self->handle_mutex;
+    }
+
+    if(self->protocol != NULL)
+    {
+        delete self->protocol;
+    }
     #ifdef Py_LIMITED_API 
     freefunc tp_free = (freefunc)PyType_GetSlot(Py_TYPE((PyObject*)self), Py_tp_free);
     tp_free((PyObject*)self);
@@ -200,6 +244,8 @@ PyRelay_IOHandle_init(PyRelay_IOHandle *self,
                      PyObject*) // kwds -- unused
 {
     self->handle = new IOHandle();
+    self->handle_mutex = new std::mutex();
+    self->protocol = new std::string();
     return 0;
 }
 
@@ -257,6 +303,25 @@ PyRelay_IOHandle_open(PyRelay_IOHandle *self,
     
     try
     {
+        PyConduit_Allow_Threads allow_threads((PyObject*)self, py_options);
+        std::lock_guard<std::mutex> handle_lock(*self->handle_mutex);
+
+        std::string open_protocol = protocol_str;
+        if(open_protocol.empty())
+        {
+            relay::io::identify_protocol(std::string(path),open_protocol);
+        }
+
+        // reopening closes the current file, so lock for its protocol too
+        std::string lock_protocol = open_protocol;
+        if(self->handle->is_open() &&
+           !relay::io::protocol_is_thread_safe(*self->protocol))
+        {
+            lock_protocol = *self->protocol;
+        }
+
+        relay::io::IOLibraryLock io_lock(lock_protocol);
+        *self->protocol = open_protocol;
         self->handle->open(std::string(path),
                            protocol_str,
                            *opts_ptr);
@@ -275,8 +340,12 @@ PyRelay_IOHandle_open(PyRelay_IOHandle *self,
 static PyObject *
 PyRelay_IOHandle_is_open(PyRelay_IOHandle *self)
 {
-    //Note: is_open does not throw
-    bool res = self->handle->is_open();
+    bool res = false;
+    {
+        //Note: is_open does not throw
+        PyRelay_IOHandle_Lock handle_lock(self);
+        res = self->handle->is_open();
+    }
 
     if(res)
         Py_RETURN_TRUE;
@@ -341,6 +410,7 @@ PyRelay_IOHandle_read(PyRelay_IOHandle *self,
     
     try
     {
+        PyRelay_IOHandle_Lock handle_lock(self, py_node, py_opts);
         if(path == NULL)
         {
             self->handle->read(*node_ptr,
@@ -418,6 +488,7 @@ PyRelay_IOHandle_write(PyRelay_IOHandle *self,
 
     try
     {
+        PyRelay_IOHandle_Lock handle_lock(self, py_node, py_opts);
         if(path == NULL)
         {
             self->handle->write(*node_ptr,
@@ -462,6 +533,7 @@ PyRelay_IOHandle_list_child_names(PyRelay_IOHandle *self,
     
     try
     {
+        PyRelay_IOHandle_Lock handle_lock(self);
         if(path == NULL)
         {
             self->handle->list_child_names(cld_names);
@@ -517,6 +589,7 @@ PyRelay_IOHandle_has_path(PyRelay_IOHandle *self,
 
     try
     {
+        PyRelay_IOHandle_Lock handle_lock(self);
         res = self->handle->has_path(std::string(path));
     }
     catch(conduit::Error &e)
@@ -554,6 +627,7 @@ PyRelay_IOHandle_remove(PyRelay_IOHandle *self,
 
     try
     {
+        PyRelay_IOHandle_Lock handle_lock(self);
         self->handle->remove(std::string(path));
     }
     catch(conduit::Error &e)
@@ -572,6 +646,7 @@ PyRelay_IOHandle_close(PyRelay_IOHandle *self)
 {
     try
     {
+        PyRelay_IOHandle_Lock handle_lock(self);
         self->handle->close();
     }
     catch(conduit::Error &e)
@@ -789,7 +864,15 @@ PyRelay_io_save(PyObject *, //self
     
     try
     {
-    
+        PyConduit_Allow_Threads allow_threads(py_node, py_opts);
+        // auto detected protocols are identified the same way relay does
+        std::string lock_protocol = protocol_str;
+        if(lock_protocol.empty())
+        {
+            relay::io::identify_protocol(std::string(path),lock_protocol);
+        }
+        relay::io::IOLibraryLock io_lock(lock_protocol);
+
         relay::io::save(node,
                         std::string(path),
                         protocol_str,
@@ -875,6 +958,14 @@ PyRelay_io_save_merged(PyObject *, //self
     
     try
     {
+        PyConduit_Allow_Threads allow_threads(py_node, py_opts);
+        // auto detected protocols are identified the same way relay does
+        std::string lock_protocol = protocol_str;
+        if(lock_protocol.empty())
+        {
+            relay::io::identify_protocol(std::string(path),lock_protocol);
+        }
+        relay::io::IOLibraryLock io_lock(lock_protocol);
         relay::io::save_merged(node,
                                std::string(path),
                                protocol_str,
@@ -936,6 +1027,14 @@ PyRelay_io_load(PyObject *, //self
     
     try
     {
+        PyConduit_Allow_Threads allow_threads(py_node);
+        // auto detected protocols are identified the same way relay does
+        std::string lock_protocol = protocol_str;
+        if(lock_protocol.empty())
+        {
+            relay::io::identify_protocol(std::string(path),lock_protocol);
+        }
+        relay::io::IOLibraryLock io_lock(lock_protocol);
         relay::io::load(std::string(path),
                         protocol_str,
                         node);
@@ -998,6 +1097,14 @@ PyRelay_io_load_merged(PyObject *, //self
     
     try
     {
+        PyConduit_Allow_Threads allow_threads(py_node);
+        // auto detected protocols are identified the same way relay does
+        std::string lock_protocol = protocol_str;
+        if(lock_protocol.empty())
+        {
+            relay::io::identify_protocol(std::string(path),lock_protocol);
+        }
+        relay::io::IOLibraryLock io_lock(lock_protocol);
         relay::io::load_merged(std::string(path),
                                protocol_str,
                                node);
@@ -377,6 +377,7 @@ PyRelay_MPI_send(PyObject *, //self
 
     try
     {
+        PyConduit_Allow_Threads allow_threads(py_node);
         relay::mpi::send(node, dest, tag, comm);
     }
     catch(conduit::Error &e)
@@ -438,6 +439,7 @@ PyRelay_MPI_recv(PyObject *, //self
 
     try
     {
+        PyConduit_Allow_Threads allow_threads(py_node);
         relay::mpi::recv(node, source, tag, comm);
     }
     catch(conduit::Error &e)
@@ -498,6 +500,7 @@ PyRelay_MPI_send_using_schema(PyObject *, //self
 
     try
     {
+        PyConduit_Allow_Threads allow_threads(py_node);
         relay::mpi::send_using_schema(node, dest, tag, comm);
     }
     catch(conduit::Error &e)
@@ -558,6 +561,7 @@ PyRelay_MPI_recv_using_schema(PyObject *, //self
 
     try
     {
+        PyConduit_Allow_Threads allow_threads(py_node);
         relay::mpi::recv_using_schema(node, source, tag, comm);
     }
     catch(conduit::Error &e)
@@ -674,6 +678,7 @@ PyRelay_MPI_sum_reduce(PyObject *, //self
 
     try
     {
+        PyConduit_Allow_Threads allow_threads(py_src_node, py_recv_node);
         relay::mpi::sum_reduce(send_node,
                                recv_node,
                                root,
@@ -749,6 +754,7 @@ PyRelay_MPI_min_reduce(PyObject *, //self
 
     try
     {
+        PyConduit_Allow_Threads allow_threads(py_src_node, py_recv_node);
         relay::mpi::min_reduce(send_node,
                                recv_node,
                                root,
@@ -825,6 +831,7 @@ PyRelay_MPI_max_reduce(PyObject *, //self
 
     try
     {
+        PyConduit_Allow_Threads allow_threads(py_src_node, py_recv_node);
         relay::mpi::max_reduce(send_node,
                                recv_node,
                                root,
@@ -901,6 +908,7 @@ PyRelay_MPI_prod_reduce(PyObject *, //self
 
     try
     {
+        PyConduit_Allow_Threads allow_threads(py_src_node, py_recv_node);
         relay::mpi::prod_reduce(send_node,
                                recv_node,
                                root,
@@ -973,6 +981,7 @@ PyRelay_MPI_sum_all_reduce(PyObject *, //self
 
     try
     {
+        PyConduit_Allow_Threads allow_threads(py_src_node, py_recv_node);
         relay::mpi::sum_all_reduce(send_node,
                                    recv_node,
                                    comm);
@@ -1045,6 +1054,7 @@ PyRelay_MPI_min_all_reduce(PyObject *, //self
 
     try
     {
+        PyConduit_Allow_Threads allow_threads(py_src_node, py_recv_node);
         relay::mpi::min_all_reduce(send_node,
                                    recv_node,
                                    comm);
@@ -1116,6 +1126,7 @@ PyRelay_MPI_max_all_reduce(PyObject *, //self
 
     try
     {
+        PyConduit_Allow_Threads allow_threads(py_src_node, py_recv_node);
         relay::mpi::max_all_reduce(send_node,
                                    recv_node,
                                    comm);
@@ -1187,6 +1198,7 @@ PyRelay_MPI_prod_all_reduce(PyObject *, //self
 
     try
     {
+        PyConduit_Allow_Threads allow_threads(py_src_node, py_recv_node);
         relay::mpi::prod_all_reduce(send_node,
                                     recv_node,
                                     comm);
@@ -1451,6 +1463,7 @@ PyRelay_MPI_gather(PyObject *, //self
 
     try
     {
+        PyConduit_Allow_Threads allow_threads(py_src_node, py_recv_node);
         relay::mpi::gather(send_node,
                            recv_node,
                            root,
@@ -1523,6 +1536,7 @@ PyRelay_MPI_gather_using_schema(PyObject *, //self
 
     try
     {
+        PyConduit_Allow_Threads allow_threads(py_src_node, py_recv_node);
         relay::mpi::gather_using_schema(send_node,
                                         recv_node,
                                         root,
@@ -1592,6 +1606,7 @@ PyRelay_MPI_all_gather(PyObject *, //self
 
     try
     {
+        PyConduit_Allow_Threads allow_threads(py_src_node, py_recv_node);
         relay::mpi::all_gather(send_node,
                                recv_node,
                                comm);
@@ -1660,6 +1675,7 @@ PyRelay_MPI_all_gather_using_schema(PyObject *, //self
 
     try
     {
+        PyConduit_Allow_Threads allow_threads(py_src_node, py_recv_node);
         relay::mpi::all_gather_using_schema(send_node,
                                             recv_node,
                                             comm);
@@ -1723,6 +1739,7 @@ PyRelay_MPI_broadcast(PyObject *, //self
 
     try
     {
+        PyConduit_Allow_Threads allow_threads(py_node);
         relay::mpi::broadcast(node, root, comm);
     }
     catch(conduit::Error &e)
@@ -1780,6 +1797,7 @@ PyRelay_MPI_broadcast_using_schema(PyObject *, //self
 
     try
     {
+        PyConduit_Allow_Threads allow_threads(py_node);
         relay::mpi::broadcast_using_schema(node, root, comm);
     }
     catch(conduit::Error &e)
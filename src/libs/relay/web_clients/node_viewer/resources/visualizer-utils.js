@@ -58,6 +58,9 @@ var nodeOffset = function (d) {
 	return d.offset;
 };
 
+// max number of leaf elements requested from the server at once
+var max_value_page_size = 10000;
+
 var getNodeValue = function (d, callback) {
 	if (!d.datavalue && d.leaf && d.length !== 0) {
     var request = new XMLHttpRequest();
@@ -76,7 +79,9 @@ var getNodeValue = function (d, callback) {
       callback("Server connection error");
     };
 
-    request.send("cpath=" + d.cpath);
+    // only fetch the first page of very large leaves
+    request.send("path=" + encodeURIComponent(d.cpath) +
+                 "&start=0&count=" + max_value_page_size);
 	} else {
     callback(d.datavalue);
   }
@@ -0,0 +1,155 @@
+/*
+# Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+# Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+# other details. No copyright assignment is required to contribute to Conduit.
+*/
+
+/*
+ Decoder for conduit's binary websocket streaming protocol
+ (see conduit::relay::web::WebStreamEncoder).
+
+ The server sends a JSON schema message when the schema changes,
+ followed by binary data messages that only hold leaf values.
+ Leaf values are exposed as typed arrays (single values as numbers),
+ strings (char8_str) are decoded to JS strings. Typed arrays use the
+ browser's byte order, which matches little endian servers.
+
+ Usage:
+    connection.binaryType = "arraybuffer";
+    var decoder = new ConduitStreamDecoder();
+    connection.onmessage = function(msg)
+    {
+        if(decoder.update(msg.data))
+        {
+            // decoder.data holds the updated tree
+        }
+    }
+*/
+
+var CONDUIT_STREAM_TYPED_ARRAYS =
+{
+    "int8":    Int8Array,
+    "int16":   Int16Array,
+    "int32":   Int32Array,
+    "int64":   (typeof BigInt64Array !== "undefined") ? BigInt64Array : null,
+    "uint8":   Uint8Array,
+    "uint16":  Uint16Array,
+    "uint32":  Uint32Array,
+    "uint64":  (typeof BigUint64Array !== "undefined") ? BigUint64Array : null,
+    "float32": Float32Array,
+    "float64": Float64Array
+};
+
+function ConduitStreamDecoder()
+{
+    this.schema_id = 0;
+    this.sequence  = -1;
+    this.leaves    = [];
+    this.data      = {};
+    this.little_endian = true;
+    this.text_decoder  = new TextDecoder("utf-8");
+}
+
+// handles a websocket message payload. Returns true if this.data was
+// updated from a binary data message.
+ConduitStreamDecoder.prototype.update = function(payload)
+{
+    if(typeof payload === "string")
+    {
+        var msg = JSON.parse(payload);
+        if(msg.type === "conduit_stream_schema")
+        {
+            this.set_schema(msg);
+        }
+        return false;
+    }
+    return this.decode_data(payload);
+}
+
+ConduitStreamDecoder.prototype.set_schema = function(msg)
+{
+    this.schema_id = msg.schema_id;
+    this.little_endian = (msg.endianness === "little");
+    this.leaves = msg.leaves;
+    this.data = {};
+}
+
+ConduitStreamDecoder.prototype.set_leaf = function(path, value)
+{
+    // the root node itself can be a leaf
+    if(path === "")
+    {
+        this.data = value;
+        return;
+    }
+
+    var parts = path.split("/");
+    var curr = this.data;
+    for(var i = 0; i < parts.length - 1; i++)
+    {
+        if(!(parts[i] in curr))
+        {
+            curr[parts[i]] = {};
+        }
+        curr = curr[parts[i]];
+    }
+    curr[parts[parts.length-1]] = value;
+}
+
+ConduitStreamDecoder.prototype.decode_data = function(buffer)
+{
+    var view  = new DataView(buffer);
+    var le    = this.little_endian;
+    var magic = String.fromCharCode(view.getUint8(0), view.getUint8(1),
+                                    view.getUint8(2), view.getUint8(3));
+    if(magic !== "CDAT")
+    {
+        throw "conduit stream: bad data message";
+    }
+
+    var schema_id = view.getUint32(4,le);
+    if(schema_id !== this.schema_id)
+    {
+        // data for a schema we don't have, wait for the next schema message
+        return false;
+    }
+
+    this.sequence  = view.getUint32(8,le) + view.getUint32(12,le) * 4294967296;
+    var num_blocks = view.getUint32(16,le);
+    var pos = 24;
+    for(var i = 0; i < num_blocks; i++)
+    {
+        var leaf      = this.leaves[view.getUint32(pos,le)];
+        var num_bytes = view.getUint32(pos + 4,le);
+        pos += 8;
+
+        var value;
+        var atype = CONDUIT_STREAM_TYPED_ARRAYS[leaf.dtype];
+        if(leaf.dtype === "char8_str")
+        {
+            var bytes = new Uint8Array(buffer, pos, num_bytes);
+            // strip the null terminator
+            var end = bytes.indexOf(0);
+            value = this.text_decoder.decode(end >= 0 ? bytes.subarray(0,end)
+                                                      : bytes);
+        }
+        else if(atype)
+        {
+            // copy, so values stay valid when later messages only
+            // update other leaves
+            value = new atype(buffer.slice(pos, pos + num_bytes));
+            if(value.length === 1)
+            {
+                value = value[0];
+            }
+        }
+        else
+        {
+            value = new Uint8Array(buffer.slice(pos, pos + num_bytes));
+        }
+
+        this.set_leaf(leaf.path, value);
+        pos += Math.ceil(num_bytes / 8) * 8;
+    }
+    return true;
+}
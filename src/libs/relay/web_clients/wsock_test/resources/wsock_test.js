@@ -8,13 +8,33 @@ function websocket_test()
 {
     var wsproto = (location.protocol === 'https:') ? 'wss:' : 'ws:';
     connection = new WebSocket(wsproto + '//' + window.location.host + '/websocket');
+    // binary stream messages (send_binary) arrive as array buffers
+    connection.binaryType = "arraybuffer";
+    var decoder = new ConduitStreamDecoder();
     
     connection.onmessage = function (msg) 
     {
         var data;
         try
         {
-            data=JSON.parse(msg.data);
+            if(msg.data instanceof ArrayBuffer)
+            {
+                if(!decoder.update(msg.data))
+                {
+                    return;
+                }
+                data = decoder.data;
+            }
+            else
+            {
+                data=JSON.parse(msg.data);
+                if(data.type == "conduit_stream_schema")
+                {
+                    decoder.set_schema(data);
+                    return;
+                }
+            }
+
             if(data.type == "image")
             {
                 $("#image_display").html("<img src='" + data.data + "'/>");
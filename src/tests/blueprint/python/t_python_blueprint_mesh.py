@@ -9,6 +9,7 @@
 
 import sys
 import unittest
+import threading
 
 import conduit.blueprint as blueprint
 
@@ -221,6 +222,28 @@ class Test_Blueprint_Mesh(unittest.TestCase):
         self.assertTrue(same(expected_x1, output[1]["coordsets/coords/values/x"]))
         self.assertTrue(same(expected_y1, output[1]["coordsets/coords/values/y"]))
 
+    def test_threaded_partition(self):
+        # partition releases the GIL, run it from several threads
+        nthreads = 4
+        outputs = [Node() for i in range(nthreads)]
+        def run_partition(idx):
+            n = Node()
+            blueprint.mesh.examples.braid("hexs", 20, 20, 20, n)
+            options = Node()
+            options["target"] = idx + 1
+            conduit.blueprint.mesh.partition(n, options, outputs[idx])
+        threads = [ threading.Thread(target=run_partition, args=(i,))
+                    for i in range(nthreads) ]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+        for i in range(nthreads):
+            info = Node()
+            self.assertTrue(blueprint.mesh.verify(outputs[i],info))
+            if i > 0:
+                self.assertEqual(outputs[i].number_of_children(), i + 1)
+
 if __name__ == '__main__':
     unittest.main()
 
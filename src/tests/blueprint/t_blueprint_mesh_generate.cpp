@@ -1227,6 +1227,65 @@ TEST(conduit_blueprint_generate_unstructured, generate_centroids)
     }
 }
 
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_generate_unstructured, generate_element_geometry)
+{
+    // braid meshes span [-10, 10] along each axis
+    const std::vector<std::string> mesh_types = {"tris", "quads", "quads_poly",
+        "tets", "hexs", "wedges", "pyramids", "hexs_poly"};
+    for(const std::string &mesh_type : mesh_types)
+    {
+        const bool is_3d = mesh_type != "tris" && mesh_type != "quads" &&
+                           mesh_type != "quads_poly";
+        Node mesh;
+        mesh::examples::braid(mesh_type, 4, 4, is_3d ? 4 : 0, mesh);
+        const Node &topo = mesh["topologies/mesh"];
+        const index_t nelems = mesh::utils::topology::length(topo);
+
+        Node geom, opts;
+        mesh::topology::unstructured::generate_element_geometry(topo, geom, opts);
+
+        // The element measures tile the mesh extents.
+        float64_accessor measures = geom["measures"].as_float64_accessor();
+        ASSERT_EQ(measures.number_of_elements(), nelems);
+        float64 total = 0.;
+        for(index_t ei = 0; ei < nelems; ei++)
+        {
+            EXPECT_GT(measures[ei], 0.) << mesh_type;
+            total += measures[ei];
+        }
+        EXPECT_NEAR(total, is_3d ? 8000. : 400., 1.e-8) << mesh_type;
+
+        // Centroids match generate_centroids and lie within the boxes.
+        Node cent_topo, cent_coords, s2dmap, d2smap;
+        mesh::topology::unstructured::generate_centroids(topo, cent_topo,
+            cent_coords, s2dmap, d2smap);
+        const std::vector<std::string> axes = {"x", "y", "z"};
+        for(index_t ai = 0; ai < (is_3d ? 3 : 2); ai++)
+        {
+            float64_accessor cent = geom["centroids"][axes[ai]].as_float64_accessor();
+            float64_accessor gen_cent = cent_coords["values"][axes[ai]].as_float64_accessor();
+            float64_accessor bmin = geom["bounding_boxes/min"][axes[ai]].as_float64_accessor();
+            float64_accessor bmax = geom["bounding_boxes/max"][axes[ai]].as_float64_accessor();
+            for(index_t ei = 0; ei < nelems; ei++)
+            {
+                EXPECT_NEAR(cent[ei], gen_cent[ei], 1.e-6);
+                EXPECT_LE(bmin[ei], cent[ei]);
+                EXPECT_GE(bmax[ei], cent[ei]);
+                EXPECT_LT(bmin[ei], bmax[ei]);
+            }
+        }
+
+        // Outputs can be disabled.
+        opts["centroids"] = 0;
+        opts["bounding_boxes"] = 0;
+        mesh::topology::unstructured::generate_element_geometry(topo, geom, opts);
+        EXPECT_TRUE(geom.has_child("measures"));
+        EXPECT_FALSE(geom.has_child("centroids"));
+        EXPECT_FALSE(geom.has_child("bounding_boxes"));
+    }
+}
+
 //-----------------------------------------------------------------------------
 TEST(conduit_blueprint_generate_unstructured, generate_points)
 {
@@ -1828,3 +1887,191 @@ TEST(conduit_blueprint_generate_unstructured, generate_corners)
         }
     }
 }
+
+//-----------------------------------------------------------------------------
+// Checks that every group in the named adjset has a matching group, with the
+// same number of entities, on each of its neighbor domains.
+void
+check_symmetric_adjset(const Node &mesh, const std::string &adjset_name)
+{
+    std::map<index_t, const Node *> dom_map;
+    for(const Node *dom : blueprint::mesh::domains(mesh))
+    {
+        dom_map[(*dom)["state/domain_id"].to_index_t()] = dom;
+    }
+
+    for(const auto &dom_pair : dom_map)
+    {
+        const Node &adjset = (*dom_pair.second)["adjsets"][adjset_name];
+        Node info;
+        EXPECT_TRUE(blueprint::mesh::adjset::verify(adjset, info));
+        EXPECT_TRUE(adjset["groups"].number_of_children() > 0);
+
+        NodeConstIterator itr = adjset["groups"].children();
+        while(itr.has_next())
+        {
+            const Node &group = itr.next();
+            index_t_accessor nbrs = group["neighbors"].as_index_t_accessor();
+            for(index_t ni = 0; ni < nbrs.number_of_elements(); ni++)
+            {
+                const Node &nbr_groups = (*dom_map[nbrs[ni]])["adjsets"][adjset_name]["groups"];
+                ASSERT_TRUE(nbr_groups.has_child(itr.name()));
+                EXPECT_EQ(nbr_groups[itr.name()]["values"].dtype().number_of_elements(),
+                          group["values"].dtype().number_of_elements());
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_generate_unstructured, generate_multi_domain)
+{
+    // The domains are processed concurrently when OpenMP is enabled, so
+    // make sure the adjsets still agree across all of the domains.
+    Node mesh;
+    blueprint::mesh::examples::grid("hexs", 3, 3, 3, 2, 2, 2, mesh);
+    EXPECT_EQ(blueprint::mesh::number_of_domains(mesh), 8);
+
+    Node s2dmap, d2smap;
+    blueprint::mesh::generate_faces(mesh, "mesh_adj", "faces_adj", "faces",
+                                    s2dmap, d2smap);
+    check_symmetric_adjset(mesh, "faces_adj");
+
+    s2dmap.reset();
+    d2smap.reset();
+    blueprint::mesh::generate_corners(mesh, "mesh_adj", "corners_adj",
+                                      "corners", "corner_coords",
+                                      s2dmap, d2smap);
+    check_symmetric_adjset(mesh, "corners_adj");
+
+    for(const Node *dom : blueprint::mesh::domains(mesh))
+    {
+        Node info;
+        EXPECT_TRUE(blueprint::mesh::topology::verify((*dom)["topologies/faces"], info));
+        EXPECT_TRUE(blueprint::mesh::topology::verify((*dom)["topologies/corners"], info));
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_field, recenter)
+{
+    // braid meshes span [-10, 10] along each axis
+    Node mesh;
+    mesh::examples::braid("quads", 4, 4, 0, mesh);
+    const Node &topo = mesh["topologies/mesh"];
+    const index_t nelems = mesh::utils::topology::length(topo);
+    const index_t nverts = mesh::utils::coordset::length(mesh["coordsets/coords"]);
+
+    // vertex x coordinates and a constant element field
+    Node &fields = mesh["fields"];
+    fields.reset();
+    fields["x/association"] = "vertex";
+    fields["x/topology"] = "mesh";
+    mesh["coordsets/coords/values/x"].to_float64_array(fields["x/values"]);
+    fields["ones/association"] = "element";
+    fields["ones/topology"] = "mesh";
+    fields["ones/values"].set(std::vector<float64>(nelems, 1.));
+
+    // vertex averages are the element centroids
+    Node res, res_avg, geom, opts;
+    mesh::field::recenter(mesh, fields["x"], "element", "average", res_avg);
+    mesh::topology::unstructured::generate_element_geometry(topo, geom, opts);
+    EXPECT_EQ(res_avg["association"].as_string(), "element");
+    float64_accessor cent_x = geom["centroids/x"].as_float64_accessor();
+    float64_accessor res_x = res_avg["values"].as_float64_accessor();
+    ASSERT_EQ(res_x.number_of_elements(), nelems);
+    for(index_t ei = 0; ei < nelems; ei++)
+    {
+        EXPECT_NEAR(res_x[ei], cent_x[ei], 1.e-10);
+    }
+
+    // summing ones counts the elements that use each vertex
+    mesh::field::recenter(mesh, fields, "vertex", "sum", res);
+    EXPECT_TRUE(res.has_child("x"));
+    EXPECT_EQ(res["ones/association"].as_string(), "vertex");
+    float64_accessor counts = res["ones/values"].as_float64_accessor();
+    ASSERT_EQ(counts.number_of_elements(), nverts);
+    float64 total = 0.;
+    for(index_t vi = 0; vi < nverts; vi++)
+    {
+        EXPECT_GE(counts[vi], 1.);
+        EXPECT_LE(counts[vi], 4.);
+        total += counts[vi];
+    }
+    EXPECT_EQ(total, 4. * nelems);
+    EXPECT_EQ(counts[0], 1.);
+    EXPECT_EQ(counts[5], 4.);
+
+    // min/max bound the vertex values and weighted averages keep constants
+    Node res_min, res_max;
+    mesh::field::recenter(mesh, fields["x"], "element", "min", res_min);
+    mesh::field::recenter(mesh, fields["x"], "element", "max", res_max);
+    mesh::field::recenter(mesh, fields["ones"], "vertex", "volume_weighted", res);
+    for(index_t ei = 0; ei < nelems; ei++)
+    {
+        EXPECT_LT(res_min["values"].as_float64_accessor()[ei], res_x[ei]);
+        EXPECT_GT(res_max["values"].as_float64_accessor()[ei], res_x[ei]);
+    }
+    for(index_t vi = 0; vi < nverts; vi++)
+    {
+        EXPECT_NEAR(res["values"].as_float64_accessor()[vi], 1., 1.e-12);
+    }
+
+    // non-unstructured topologies and multi-component fields
+    Node umesh;
+    mesh::examples::braid("uniform", 4, 4, 0, umesh);
+    umesh["fields/vel/association"] = "vertex";
+    umesh["fields/vel/topology"] = "mesh";
+    umesh["fields/vel/values/u"].set(std::vector<float64>(nverts, 2.));
+    umesh["fields/vel/values/v"].set(std::vector<float64>(nverts, 3.));
+    mesh::field::recenter(umesh, umesh["fields/vel"], "element",
+                          "volume_weighted", res);
+    Node info;
+    EXPECT_TRUE(mesh::field::verify(res, info));
+    EXPECT_EQ(res["values/u"].dtype().number_of_elements(), nelems);
+    EXPECT_NEAR(res["values/u"].as_float64_accessor()[0], 2., 1.e-12);
+    EXPECT_NEAR(res["values/v"].as_float64_accessor()[nelems - 1], 3., 1.e-12);
+
+    // bad ops and targets are errors
+    EXPECT_THROW(mesh::field::recenter(mesh, fields, "vertex", "median", res),
+                 conduit::Error);
+    EXPECT_THROW(mesh::field::recenter(mesh, fields, "nothing", "sum", res),
+                 conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_field, recenter_to_faces)
+{
+    Node mesh;
+    mesh::examples::braid("hexs", 3, 3, 3, mesh);
+    const index_t nelems = mesh::utils::topology::length(mesh["topologies/mesh"]);
+    mesh["fields/ones/association"] = "element";
+    mesh["fields/ones/topology"] = "mesh";
+    mesh["fields/ones/values"].set(std::vector<float64>(nelems, 1.));
+
+    Node s2dmap, d2smap;
+    mesh::topology::unstructured::generate_faces(mesh["topologies/mesh"],
+        mesh["topologies/faces"], s2dmap, d2smap);
+    const index_t nfaces = mesh::utils::topology::length(mesh["topologies/faces"]);
+
+    // boundary faces touch one element, interior faces two
+    Node res;
+    mesh::field::recenter(mesh, mesh["fields/ones"], "faces", "sum", res);
+    EXPECT_EQ(res["topology"].as_string(), "faces");
+    EXPECT_EQ(res["association"].as_string(), "element");
+    float64_accessor counts = res["values"].as_float64_accessor();
+    ASSERT_EQ(counts.number_of_elements(), nfaces);
+    float64 total = 0.;
+    for(index_t fi = 0; fi < nfaces; fi++)
+    {
+        EXPECT_TRUE(counts[fi] == 1. || counts[fi] == 2.);
+        total += counts[fi];
+    }
+    EXPECT_EQ(total, 6. * nelems);
+
+    Node with_faces;
+    with_faces.set_external(mesh);
+    with_faces["fields/face_counts"].set_external(res);
+    Node info;
+    EXPECT_TRUE(mesh::verify(with_faces, info));
+}
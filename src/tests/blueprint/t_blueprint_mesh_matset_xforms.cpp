@@ -253,3 +253,121 @@ TEST(conduit_blueprint_mesh_matset_xforms, mesh_util_venn_to_silo_matset_values)
     }
 
 }
+
+//-----------------------------------------------------------------------------
+// Converts matset (and mat_check field) to each layout and checks that the
+// results verify, have the requested layout and have the same silo
+// representation as the input.
+static void
+check_layout_conversions(const Node &mesh)
+{
+    typedef void (*MatsetXform)(const Node &, Node &);
+    typedef void (*FieldXform)(const Node &, const Node &, Node &);
+    const MatsetXform mset_xforms[] = {
+        blueprint::mesh::matset::to_uni_buffer,
+        blueprint::mesh::matset::to_multi_buffer,
+        blueprint::mesh::matset::to_element_dominant,
+        blueprint::mesh::matset::to_material_dominant};
+    const FieldXform field_xforms[] = {
+        blueprint::mesh::field::to_uni_buffer,
+        blueprint::mesh::field::to_multi_buffer,
+        blueprint::mesh::field::to_element_dominant,
+        blueprint::mesh::field::to_material_dominant};
+
+    const Node &mset = mesh["matsets/matset"];
+    const Node &field = mesh["fields/mat_check"];
+    Node silo_baseline, field_silo_baseline;
+    blueprint::mesh::matset::to_silo(mset, silo_baseline);
+    blueprint::mesh::field::to_silo(field, mset, field_silo_baseline);
+
+    for(int xi = 0; xi < 4; xi++)
+    {
+        Node res, res_field, info;
+        mset_xforms[xi](mset, res);
+        field_xforms[xi](field, mset, res_field);
+
+        EXPECT_TRUE(blueprint::mesh::matset::verify(res, info));
+        switch(xi)
+        {
+            case 0: EXPECT_TRUE(blueprint::mesh::matset::is_uni_buffer(res)); break;
+            case 1: EXPECT_TRUE(blueprint::mesh::matset::is_multi_buffer(res)); break;
+            case 2: EXPECT_TRUE(blueprint::mesh::matset::is_element_dominant(res)); break;
+            case 3: EXPECT_TRUE(blueprint::mesh::matset::is_material_dominant(res)); break;
+        }
+
+        Node res_mesh;
+        res_mesh.set_external(mesh);
+        res_mesh["matsets/matset"].set_external(res);
+        res_mesh["fields/mat_check"].set_external(res_field);
+        EXPECT_TRUE(blueprint::mesh::verify(res_mesh, info));
+
+        Node silo, field_silo;
+        blueprint::mesh::matset::to_silo(res, silo);
+        EXPECT_FALSE(silo.diff(silo_baseline, info, CONDUIT_EPSILON, true));
+        blueprint::mesh::field::to_silo(res_field, res, field_silo);
+        EXPECT_FALSE(field_silo.diff(field_silo_baseline, info, CONDUIT_EPSILON, true));
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_matset_xforms, mesh_util_venn_layout_conversions)
+{
+    const int nx = 4, ny = 4;
+    const double radius = 0.25;
+
+    const std::string venn_types[] = {"full",
+                                      "sparse_by_material",
+                                      "sparse_by_element"};
+    for(const std::string &venn_type : venn_types)
+    {
+        CONDUIT_INFO("venn " << venn_type << " layout conversions");
+        Node mesh;
+        blueprint::mesh::examples::venn(venn_type, nx, ny, radius, mesh);
+        check_layout_conversions(mesh);
+
+        // round trip through every other layout
+        Node uni, elem_uni, multi, back, info;
+        blueprint::mesh::matset::to_uni_buffer(mesh["matsets/matset"], uni);
+        blueprint::mesh::matset::to_element_dominant(uni, elem_uni);
+        blueprint::mesh::matset::to_material_dominant(uni, multi);
+        blueprint::mesh::matset::to_multi_buffer(multi, back);
+        blueprint::mesh::matset::to_element_dominant(back, multi);
+        EXPECT_TRUE(blueprint::mesh::matset::is_multi_buffer(multi));
+        EXPECT_TRUE(blueprint::mesh::matset::is_element_dominant(multi));
+        blueprint::mesh::matset::to_uni_buffer(multi, back);
+        EXPECT_FALSE(back.diff(elem_uni, info, CONDUIT_EPSILON, true));
+    }
+
+    CONDUIT_INFO("venn sparse_by_element (converted to material based) layout conversions");
+    {
+        Node mesh;
+        blueprint::mesh::examples::venn("sparse_by_element", nx, ny, radius, mesh);
+        convert_to_material_based(mesh["topologies/topo"], mesh["matsets/matset"]);
+        check_layout_conversions(mesh);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_matset_xforms, mesh_util_layout_conversions_zero_copy)
+{
+    Node mesh;
+    blueprint::mesh::examples::venn("sparse_by_element", 4, 4, 0.25, mesh);
+    const Node &mset = mesh["matsets/matset"];
+    const Node &field = mesh["fields/mat_check"];
+
+    Node res;
+    blueprint::mesh::matset::to_uni_buffer(mset, res);
+    EXPECT_EQ(res["volume_fractions"].data_ptr(),
+              mset["volume_fractions"].data_ptr());
+    blueprint::mesh::matset::to_element_dominant(mset, res);
+    EXPECT_EQ(res["material_ids"].data_ptr(),
+              mset["material_ids"].data_ptr());
+    blueprint::mesh::field::to_uni_buffer(field, mset, res);
+    EXPECT_EQ(res["matset_values"].data_ptr(),
+              field["matset_values"].data_ptr());
+
+    // the non matset_values field entries are never copied
+    blueprint::mesh::field::to_multi_buffer(field, mset, res);
+    EXPECT_EQ(res["values"].data_ptr(), field["values"].data_ptr());
+    EXPECT_TRUE(res["matset_values"].dtype().is_object());
+}
@@ -22,6 +22,10 @@
 #include <cmath>
 #include "gtest/gtest.h"
 
+#if defined(CONDUIT_USE_OPENMP)
+#include <omp.h>
+#endif
+
 #include "blueprint_test_helpers.hpp"
 
 using std::cout;
@@ -1282,6 +1286,59 @@ TEST(conduit_blueprint_mesh_combine, to_poly)
     }
 }
 
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_combine, merge_tolerance)
+{
+    // Two unit quads that share an edge. One shared point is offset by
+    // less than the merge tolerance and one by more.
+    const double tol = 1.e-3;
+    const double near = 0.25 * tol, far = 2. * tol;
+    const conduit::float64 x0[] = {0., 1., 1., 0.};
+    const conduit::float64 y0[] = {0., 0., 1., 1.};
+    const conduit::float64 x1[] = {1. - near, 2., 2., 1. + far};
+    const conduit::float64 y1[] = {0. + near, 0., 1., 1.};
+    const conduit::int32 conn[] = {0, 1, 2, 3};
+
+    conduit::Node mesh;
+    const conduit::float64 *xs[] = {x0, x1};
+    const conduit::float64 *ys[] = {y0, y1};
+    for(int d = 0; d < 2; d++)
+    {
+        conduit::Node &dom = mesh.append();
+        dom["state/domain_id"] = d;
+        dom["coordsets/coords/type"] = "explicit";
+        dom["coordsets/coords/values/x"].set(xs[d], 4);
+        dom["coordsets/coords/values/y"].set(ys[d], 4);
+        dom["topologies/mesh/type"] = "unstructured";
+        dom["topologies/mesh/coordset"] = "coords";
+        dom["topologies/mesh/elements/shape"] = "quad";
+        dom["topologies/mesh/elements/connectivity"].set(conn, 4);
+    }
+
+    conduit::Node opts, output, info;
+    opts["target"] = 1;
+    opts["merge_tolerance"] = tol;
+    conduit::blueprint::mesh::partition(mesh, opts, output);
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(output, info));
+
+    // The near point merges into the first domain's point.
+    const conduit::Node &values = output["coordsets/coords/values"];
+    ASSERT_EQ(values["x"].dtype().number_of_elements(), 7);
+    const conduit::float64_accessor x = values["x"].as_float64_accessor();
+    const conduit::float64_accessor y = values["y"].as_float64_accessor();
+    int n_at_1_0 = 0;
+    for(conduit::index_t i = 0; i < 7; i++)
+    {
+        n_at_1_0 += (x[i] == 1. && y[i] == 0.) ? 1 : 0;
+        for(conduit::index_t j = 0; j < i; j++)
+        {
+            const double dx = x[i] - x[j], dy = y[i] - y[j];
+            EXPECT_GT(dx * dx + dy * dy, tol * tol);
+        }
+    }
+    EXPECT_EQ(n_at_1_0, 1);
+}
+
 //-----------------------------------------------------------------------------
 TEST(conduit_blueprint_mesh_combine, uniform)
 {
@@ -1942,6 +1999,53 @@ TEST(blueprint_mesh_combine, structured)
     }
 }
 
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_partition, many_domains)
+{
+    // Enough selections and output domains that extraction and assembly
+    // run concurrently when OpenMP is enabled. The concurrent runs must
+    // agree with each other and with a run on a single thread.
+    conduit::Node mesh;
+    conduit::blueprint::mesh::examples::grid("hexs", 5, 5, 5, 2, 2, 2, mesh);
+    conduit::index_t nelems = 0;
+    for(const conduit::Node *dom : conduit::blueprint::mesh::domains(mesh))
+    {
+        nelems += conduit::blueprint::mesh::topology::length((*dom)["topologies/mesh"]);
+    }
+
+    for(const int target : {3, 16})
+    {
+        conduit::Node opts, output, output2, serial_output, info;
+        opts["target"] = target;
+#if defined(CONDUIT_USE_OPENMP)
+        // Use fewer threads than domains so the domains are spread over
+        // the threads rather than run serially.
+        const int max_threads = omp_get_max_threads();
+        omp_set_num_threads(4);
+#endif
+        conduit::blueprint::mesh::partition(mesh, opts, output);
+        conduit::blueprint::mesh::partition(mesh, opts, output2);
+#if defined(CONDUIT_USE_OPENMP)
+        omp_set_num_threads(1);
+#endif
+        conduit::blueprint::mesh::partition(mesh, opts, serial_output);
+#if defined(CONDUIT_USE_OPENMP)
+        omp_set_num_threads(max_threads);
+#endif
+        EXPECT_TRUE(conduit::blueprint::mesh::verify(output, info));
+        EXPECT_EQ(conduit::blueprint::mesh::number_of_domains(output), target);
+        EXPECT_FALSE(output.diff(output2, info));
+        EXPECT_FALSE(output.diff(serial_output, info));
+
+        conduit::index_t out_nelems = 0;
+        for(const conduit::Node *dom : conduit::blueprint::mesh::domains(output))
+        {
+            out_nelems += conduit::blueprint::mesh::topology::length((*dom)["topologies/mesh"]);
+        }
+        EXPECT_EQ(out_nelems, nelems);
+    }
+}
+
 //-----------------------------------------------------------------------------
 TEST(conduit_blueprint_mesh_partition, field_selection)
 {
@@ -439,7 +439,8 @@ void kdtree_2d(int dims[2])
 
 //---------------------------------------------------------------------------
 template <typename T>
-void single_domain_point_query_3d(int dims[3], int fuzz = -1)
+void single_domain_point_query_3d(int dims[3], int fuzz = -1,
+    PointQuery::SearchMethod method = PointQuery::SEARCH_AUTO)
 {
     // Initialization.
     T *coords[3], *query_coords[3];
@@ -456,6 +457,7 @@ void single_domain_point_query_3d(int dims[3], int fuzz = -1)
 
     // Make sure we can identify all of the coordinates.
     PointQuery Q(mesh);
+    Q.setSearchMethod(method);
     const int domain0 = 0;
     for(int i = 0; i < npts; i++)
     {
@@ -489,7 +491,8 @@ void single_domain_point_query_3d(int dims[3], int fuzz = -1)
 
 //---------------------------------------------------------------------------
 template <typename T>
-void single_domain_point_query_2d(int dims[2])
+void single_domain_point_query_2d(int dims[2],
+    PointQuery::SearchMethod method = PointQuery::SEARCH_AUTO)
 {
     // Initialization.
     T *coords[2];
@@ -504,6 +507,7 @@ void single_domain_point_query_2d(int dims[2])
 
     // Make sure we can identify all of the coordinates.
     PointQuery Q(mesh);
+    Q.setSearchMethod(method);
     const int domain0 = 0;
     for(int i = 0; i < npts; i++)
     {
@@ -577,22 +581,29 @@ TEST(conduit_blueprint_mesh_query, point_query_3d)
     dims[0] = 3 + static_cast<int>(pow(PointQuery::SEARCH_THRESHOLD, 1./3.));
     dims[1] = dims[2] = dims[0];
 
-    single_domain_point_query_3d<double>(dims);
-    single_domain_point_query_3d<float>(dims);
-
-    // 2D in 3D space - large enough that accelerated search should kick in.
-    // This checks that we can locate points in a plane in 3D using the kdtree.
-    for(int fuzz = 0; fuzz < 2; fuzz++)
+    const PointQuery::SearchMethod methods[] = {PointQuery::SEARCH_AUTO,
+                                                PointQuery::SEARCH_KDTREE,
+                                                PointQuery::SEARCH_UNIFORM_GRID};
+    for(const auto method : methods)
     {
-        int dims1[] = {1, 150, 150};
-        single_domain_point_query_3d<double>(dims1, fuzz > 0 ? 0 : -1);
-        single_domain_point_query_3d<float>(dims1, fuzz > 0 ? 0 : -1);
-        int dims2[] = {150, 1, 150};
-        single_domain_point_query_3d<double>(dims2, fuzz > 0 ? 1 : -1);
-        single_domain_point_query_3d<float>(dims2, fuzz > 0 ? 1 : -1);
-        int dims3[] = {150, 150, 1};
-        single_domain_point_query_3d<double>(dims3, fuzz > 0 ? 2 : -1);
-        single_domain_point_query_3d<float>(dims3, fuzz > 0 ? 2 : -1);
+        single_domain_point_query_3d<double>(dims, -1, method);
+        single_domain_point_query_3d<float>(dims, -1, method);
+
+        // 2D in 3D space - large enough that accelerated search should kick in.
+        // This checks that we can locate points in a plane in 3D using the
+        // spatial index.
+        for(int fuzz = 0; fuzz < 2; fuzz++)
+        {
+            int dims1[] = {1, 150, 150};
+            single_domain_point_query_3d<double>(dims1, fuzz > 0 ? 0 : -1, method);
+            single_domain_point_query_3d<float>(dims1, fuzz > 0 ? 0 : -1, method);
+            int dims2[] = {150, 1, 150};
+            single_domain_point_query_3d<double>(dims2, fuzz > 0 ? 1 : -1, method);
+            single_domain_point_query_3d<float>(dims2, fuzz > 0 ? 1 : -1, method);
+            int dims3[] = {150, 150, 1};
+            single_domain_point_query_3d<double>(dims3, fuzz > 0 ? 2 : -1, method);
+            single_domain_point_query_3d<float>(dims3, fuzz > 0 ? 2 : -1, method);
+        }
     }
 }
 
@@ -605,6 +616,116 @@ TEST(conduit_blueprint_mesh_query, point_query_2d)
     dims[0] = 3 + static_cast<int>(pow(PointQuery::SEARCH_THRESHOLD, 1./2.));
     dims[1] = dims[0];
 
-    single_domain_point_query_2d<double>(dims);
-    single_domain_point_query_2d<float>(dims);
+    const PointQuery::SearchMethod methods[] = {PointQuery::SEARCH_AUTO,
+                                                PointQuery::SEARCH_KDTREE,
+                                                PointQuery::SEARCH_UNIFORM_GRID};
+    for(const auto method : methods)
+    {
+        single_domain_point_query_2d<double>(dims, method);
+        single_domain_point_query_2d<float>(dims, method);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_query, point_query_cache)
+{
+    int dims[3] = {30, 30, 30};
+    double *coords[3];
+    make_coords_3d(coords, dims);
+    int npts = dims[0] * dims[1] * dims[2];
+
+    conduit::Node mesh;
+    mesh["coordsets/coords/type"] = "explicit";
+    mesh["coordsets/coords/values/x"].set_external(coords[0], npts);
+    mesh["coordsets/coords/values/y"].set_external(coords[1], npts);
+    mesh["coordsets/coords/values/z"].set_external(coords[2], npts);
+
+    // Query the same point over several cycles. The spatial index built in
+    // the first cycle is reused.
+    PointQuery Q(mesh);
+    const int domain0 = 0;
+    const int ptid = 1234;
+    double pt[3] = {coords[0][ptid], coords[1][ptid], coords[2][ptid]};
+    for(int cycle = 0; cycle < 3; cycle++)
+    {
+        Q.reset();
+        Q.add(domain0, pt);
+        Q.execute("coords");
+        EXPECT_EQ(Q.results(domain0)[0], ptid);
+    }
+
+    // Move the point in place. The cached index does not know about it until
+    // the cache is invalidated.
+    coords[0][ptid] += 1000.;
+    double moved[3] = {coords[0][ptid], coords[1][ptid], coords[2][ptid]};
+    Q.invalidateCache(mesh["coordsets/coords"]);
+    Q.reset();
+    Q.add(domain0, moved);
+    Q.add(domain0, pt);
+    Q.execute("coords");
+    EXPECT_EQ(Q.results(domain0)[0], ptid);
+    EXPECT_EQ(Q.results(domain0)[1], Q.NotFound);
+
+    // New coordinate data (a different pointer) rebuilds the index.
+    std::vector<double> x2(coords[0], coords[0] + npts);
+    x2[ptid] = pt[0];
+    mesh["coordsets/coords/values/x"].set_external(x2);
+    Q.reset();
+    Q.add(domain0, pt);
+    Q.execute("coords");
+    EXPECT_EQ(Q.results(domain0)[0], ptid);
+
+    free_coords_3d(coords);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_query, point_query_multi_domain_batch)
+{
+    // Two domains with different coordinate types are searched in one batch.
+    int dims[3] = {30, 30, 30};
+    double *dcoords[3];
+    make_coords_3d(dcoords, dims);
+    int npts = dims[0] * dims[1] * dims[2];
+    std::vector<int> icoords[3];
+    for(int d = 0; d < 3; d++)
+        icoords[d] = std::vector<int>(dcoords[d], dcoords[d] + npts);
+
+    conduit::Node mesh;
+    conduit::Node &d0 = mesh["domain0"];
+    d0["state/domain_id"] = 0;
+    d0["coordsets/coords/type"] = "explicit";
+    d0["coordsets/coords/values/x"].set_external(dcoords[0], npts);
+    d0["coordsets/coords/values/y"].set_external(dcoords[1], npts);
+    d0["coordsets/coords/values/z"].set_external(dcoords[2], npts);
+    conduit::Node &d1 = mesh["domain1"];
+    d1["state/domain_id"] = 1;
+    d1["coordsets/coords/type"] = "explicit";
+    d1["coordsets/coords/values/x"].set_external(icoords[0]);
+    d1["coordsets/coords/values/y"].set_external(icoords[1]);
+    d1["coordsets/coords/values/z"].set_external(icoords[2]);
+
+    PointQuery Q(mesh);
+    for(int i = 0; i < npts; i += 7)
+    {
+        double pt[3] = {dcoords[0][i], dcoords[1][i], dcoords[2][i]};
+        Q.add(0, pt);
+        Q.add(1, pt);
+    }
+    double badpt[] = {0.5, 0.5, 0.5};
+    Q.add(0, badpt);
+    Q.add(1, badpt);
+    Q.execute("coords");
+
+    for(int dom = 0; dom < 2; dom++)
+    {
+        const auto &res = Q.results(dom);
+        size_t n = 0;
+        for(int i = 0; i < npts; i += 7, n++)
+        {
+            EXPECT_EQ(res[n], i);
+        }
+        EXPECT_EQ(res[n], Q.NotFound);
+    }
+
+    free_coords_3d(dcoords);
 }
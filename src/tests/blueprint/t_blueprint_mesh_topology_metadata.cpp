@@ -99,10 +99,20 @@ tmp_err_handler(const std::string &s1, const std::string &s2, int i1)
 
 //-----------------------------------------------------------------------------
 void
-test_topmd(const std::string &base, conduit::Node &topo, conduit::Node &coords)
+test_topmd(const std::string &base, conduit::Node &topo, conduit::Node &coords,
+           bool compact = false)
 {
     TopologyMetadata md(topo, coords);
     index_t maxdim = conduit::blueprint::mesh::utils::topology::dims(topo);
+    if(compact)
+    {
+        // Compacting must not change any of the results.
+        conduit::Node before, after;
+        md.memory_report(before);
+        md.compact();
+        md.memory_report(after);
+        EXPECT_TRUE(after["total"].to_index_t() <= before["total"].to_index_t());
+    }
 
     // This node will hold a representation of the metadata.
     conduit::Node rep;
@@ -542,6 +552,7 @@ test_mesh_type(const std::string &type)
         std::stringstream oss;
         oss << "topology_metadata_" << type << "_" << dtype.name();
         test_topmd(oss.str(), node["topologies/mesh"], node["coordsets/coords"]);
+        test_topmd(oss.str(), node["topologies/mesh"], node["coordsets/coords"], true);
     }
 }
 
@@ -639,6 +650,52 @@ TEST(conduit_blueprint_topology_metadata, custom_ph)
     test_mesh_type("custom_ph");
 }
 
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_topology_metadata, release)
+{
+    conduit::Node node;
+    conduit::DataType dtype(CONDUIT_INT32_ID);
+    make_dataset(node, "hexs", dtype);
+    const conduit::Node &topo = node["topologies/mesh"];
+    const conduit::Node &coords = node["coordsets/coords"];
+
+    // Only ask for the faces and the element to face map.
+    std::vector<std::pair<size_t,size_t>> desired{{3,2}, {2,0}};
+    TopologyMetadata md(topo, coords, 2, desired);
+    md.compact();
+
+    conduit::Node rep;
+    md.memory_report(rep);
+    EXPECT_TRUE(rep.has_path("levels/topo3/total"));
+    EXPECT_TRUE(rep.has_path("levels/topo2/total"));
+    EXPECT_TRUE(rep["levels/topo2/topology"].to_index_t() > 0);
+    EXPECT_TRUE(rep["levels/topo3/global_associations"].to_index_t() > 0);
+    const index_t total = rep["total"].to_index_t();
+
+    // Pull the maps we need, then release the face level.
+    conduit::Node faces, map32;
+    md.get_topology(2, faces);
+    EXPECT_TRUE(md.get_dim_map(TopologyMetadata::GLOBAL, 3, 2, map32));
+    const index_t nfaces = md.get_topology_length(2);
+
+    md.release(2);
+    EXPECT_FALSE(md.association_requested(3, 2));
+    EXPECT_FALSE(md.association_requested(2, 0));
+    conduit::Node tmp;
+    EXPECT_FALSE(md.get_dim_map(TopologyMetadata::GLOBAL, 3, 2, tmp));
+    EXPECT_THROW(md.get_topology(2), conduit::Error);
+    EXPECT_EQ(md.get_topology_length(2), nfaces);
+
+    md.memory_report(rep);
+    EXPECT_EQ(rep["levels/topo2/total"].to_index_t(), 0);
+    EXPECT_TRUE(rep["total"].to_index_t() < total);
+
+    // The data that were pulled out remain valid.
+    EXPECT_EQ(conduit::blueprint::mesh::utils::topology::length(faces), nfaces);
+    EXPECT_EQ(map32["values"].dtype().number_of_elements(),
+              md.get_topology_length(3) * 6);
+}
+
 #if 0
 // These topologies are not supported by reference::TopologyMetadata (and probably
 // not the new class either as additional connectivity handling is needed.)
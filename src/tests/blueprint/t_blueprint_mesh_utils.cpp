@@ -353,3 +353,163 @@ TEST(conduit_blueprint_mesh_utils, copy_fields)
     EXPECT_EQ(fields.number_of_children(), 1);
     EXPECT_EQ(fields[0].name(), "f4");
 }
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_utils, topology_builder)
+{
+    conduit::Node mesh;
+    conduit::blueprint::mesh::examples::braid("quads", 4, 4, 0, mesh);
+    const conduit::Node &topo = mesh["topologies/mesh"];
+    const conduit::Node &coords = mesh["coordsets/coords"];
+
+    // Add two edges that share a point, using points out of order.
+    conduit::blueprint::mesh::utils::topology::TopologyBuilder B(topo);
+    std::vector<conduit::index_t> e0{9, 5}, e1{5, 1};
+    EXPECT_EQ(B.add(e0), 0);
+    EXPECT_EQ(B.add(e1), 1);
+
+    conduit::Node out;
+    B.execute(out, "line");
+    const conduit::Node &otopo = out["topologies/mesh"];
+    const conduit::Node &ocoords = out["coordsets/coords"];
+
+    // New point ids are assigned in order of first use.
+    std::vector<conduit::index_t> conn{0, 1, 1, 2};
+    conduit::index_t_accessor oconn = otopo["elements/connectivity"].as_index_t_accessor();
+    EXPECT_EQ(oconn.number_of_elements(), 4);
+    for(conduit::index_t i = 0; i < 4; i++)
+    {
+        EXPECT_EQ(oconn[i], conn[i]);
+    }
+
+    const std::vector<conduit::index_t> orig{9, 5, 1};
+    auto x = coords["values/x"].as_double_accessor();
+    auto y = coords["values/y"].as_double_accessor();
+    auto ox = ocoords["values/x"].as_double_accessor();
+    auto oy = ocoords["values/y"].as_double_accessor();
+    EXPECT_EQ(ox.number_of_elements(), 3);
+    for(size_t i = 0; i < orig.size(); i++)
+    {
+        EXPECT_EQ(ox[i], x[orig[i]]);
+        EXPECT_EQ(oy[i], y[orig[i]]);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_utils, topology_search)
+{
+    // braid quads with 3x3 points has 4 quads.
+    conduit::Node mesh1, mesh2;
+    conduit::blueprint::mesh::examples::braid("quads", 3, 3, 0, mesh1);
+    mesh1["topologies/mesh/elements/sizes"].set(std::vector<conduit::index_t>{4,4,4,4});
+    mesh2.set(mesh1);
+
+    // Rotate the points in quad 0, reverse quad 1, make quad 2 from points
+    // of different quads, and keep quad 3. Entities match regardless of
+    // point order.
+    auto conn1 = mesh1["topologies/mesh/elements/connectivity"].as_index_t_accessor();
+    std::vector<conduit::index_t> conn2;
+    for(conduit::index_t i = 0; i < 16; i++)
+        conn2.push_back(conn1[i]);
+    std::rotate(conn2.begin(), conn2.begin() + 1, conn2.begin() + 4);
+    std::reverse(conn2.begin() + 4, conn2.begin() + 8);
+    conn2[8] = conn1[0];
+    conn2[9] = conn1[1];
+    conn2[10] = conn1[14];
+    conn2[11] = conn1[15];
+    mesh2["topologies/mesh/elements/connectivity"].set(conn2);
+
+    const conduit::Node &topo1 = mesh1["topologies/mesh"];
+    const conduit::Node &topo2 = mesh2["topologies/mesh"];
+    std::vector<int> exists = conduit::blueprint::mesh::utils::topology::search(topo1, topo2);
+    std::vector<int> expected{1, 1, 0, 1};
+    EXPECT_EQ(exists, expected);
+
+    // Move the corner point that only quad 3 uses so it can not be found.
+    conduit::float64_array x2 = mesh2["coordsets/coords/values/x"].value();
+    x2[8] += 100.;
+    exists = conduit::blueprint::mesh::utils::topology::search(topo1, topo2);
+    expected = std::vector<int>{1, 1, 0, 0};
+    EXPECT_EQ(exists, expected);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_utils, slice_fields)
+{
+    namespace bputils = conduit::blueprint::mesh::utils;
+    const conduit::index_t n = 50000;
+
+    // A contiguous float64 field, an int32 field, and an interleaved mcarray.
+    conduit::Node src;
+    std::vector<conduit::float64> f64(n);
+    std::vector<conduit::int32> i32(n);
+    std::vector<conduit::float32> xyz(3 * n);
+    for(conduit::index_t i = 0; i < n; i++)
+    {
+        f64[i] = 0.5 * i;
+        i32[i] = static_cast<conduit::int32>(n - i);
+        xyz[3 * i + 0] = static_cast<conduit::float32>(i);
+        xyz[3 * i + 1] = static_cast<conduit::float32>(2 * i);
+        xyz[3 * i + 2] = static_cast<conduit::float32>(3 * i);
+    }
+    src["a"].set(f64);
+    src["b"].set(i32);
+    src["xyz/data"].set(xyz);
+    const conduit::index_t stride = 3 * sizeof(conduit::float32);
+    src["c/x"].set_external(conduit::DataType::float32(n, 0, stride), src["xyz/data"].data_ptr());
+    src["c/y"].set_external(conduit::DataType::float32(n, sizeof(conduit::float32), stride), src["xyz/data"].data_ptr());
+    src["c/z"].set_external(conduit::DataType::float32(n, 2 * sizeof(conduit::float32), stride), src["xyz/data"].data_ptr());
+
+    // Ids with long runs, short runs, and random ids.
+    std::vector<conduit::index_t> ids;
+    for(conduit::index_t i = 100; i < 20100; i++)
+        ids.push_back(i);
+    for(conduit::index_t i = 0; i < 1000; i++)
+        ids.push_back((i * 7) % n);
+    for(conduit::index_t i = 0; i < 20000; i++)
+        ids.push_back((i * 7919 + 13) % n);
+    for(conduit::index_t i = 30000; i < 30005; i++)
+        ids.push_back(i);
+
+    conduit::Node dest;
+    std::vector<const conduit::Node *> srcs{&src["a"], &src["b"], &src["c"]};
+    std::vector<conduit::Node *> dests{&dest["a"], &dest["b"], &dest["c"]};
+    bputils::slice_fields(srcs, ids, dests);
+
+    // Check against slicing one field at a time and against the sources.
+    conduit::Node dest1;
+    std::vector<int> int_ids(ids.begin(), ids.end());
+    bputils::slice_field(src["c"], int_ids, dest1["c"]);
+    bputils::slice_array(src["b"], int_ids, dest1["b"]);
+    conduit::Node info;
+    EXPECT_FALSE(dest["c"].diff(dest1["c"], info));
+    EXPECT_FALSE(dest["b"].diff(dest1["b"], info));
+
+    EXPECT_TRUE(dest["a"].dtype().is_float64());
+    EXPECT_TRUE(dest["b"].dtype().is_int32());
+    EXPECT_TRUE(dest["c/y"].dtype().is_float32());
+    EXPECT_TRUE(dest["c/y"].dtype().is_compact());
+    auto a = dest["a"].as_float64_array();
+    auto b = dest["b"].as_int32_array();
+    auto x = dest["c/x"].as_float32_array();
+    auto y = dest["c/y"].as_float32_array();
+    auto z = dest["c/z"].as_float32_array();
+    ASSERT_EQ(a.number_of_elements(), static_cast<conduit::index_t>(ids.size()));
+    for(size_t i = 0; i < ids.size(); i++)
+    {
+        const conduit::index_t id = ids[i];
+        EXPECT_EQ(a[i], f64[id]);
+        EXPECT_EQ(b[i], i32[id]);
+        EXPECT_EQ(x[i], xyz[3 * id + 0]);
+        EXPECT_EQ(y[i], xyz[3 * id + 1]);
+        EXPECT_EQ(z[i], xyz[3 * id + 2]);
+    }
+
+    // Slicing in place replaces the values.
+    std::vector<conduit::index_t> few{4, 2, 0};
+    bputils::slice_array(dest["a"], few, dest["a"]);
+    auto a2 = dest["a"].as_float64_array();
+    ASSERT_EQ(a2.number_of_elements(), 3);
+    EXPECT_EQ(a2[0], f64[ids[4]]);
+    EXPECT_EQ(a2[2], f64[ids[0]]);
+}
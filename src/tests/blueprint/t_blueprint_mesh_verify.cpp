@@ -228,6 +228,15 @@ bool verify_mesh_multi_domain_protocol(const Node &n, Node &info)
 }
 
 
+bool verify_mesh_bool_agrees(const Node &n, Node &info)
+{
+    // the boolean-only verify must agree with the info producing verify
+    const bool res = blueprint::mesh::verify(n,info);
+    EXPECT_EQ(blueprint::mesh::verify(n), res);
+    return res;
+}
+
+
 /// Helper for mesh verify checks ///
 
 #define CHECK_MESH(verify, n, info, expected)    \
@@ -2466,9 +2475,11 @@ TEST(conduit_blueprint_mesh_verify, mesh_general)
     VerifyFun verify_mesh_funs[] = {
         blueprint::mesh::verify, // single_domain verify
         blueprint::mesh::verify, // multi_domain verify
-        verify_mesh_multi_domain_protocol};
+        verify_mesh_multi_domain_protocol,
+        verify_mesh_bool_agrees, // single_domain boolean verify
+        verify_mesh_bool_agrees}; // multi_domain boolean verify
 
-    for(index_t fi = 0; fi < 3; fi++)
+    for(index_t fi = 0; fi < 5; fi++)
     {
         VerifyFun verify_mesh = verify_mesh_funs[fi];
 
@@ -2479,7 +2490,7 @@ TEST(conduit_blueprint_mesh_verify, mesh_general)
         blueprint::mesh::examples::braid("quads",10,10,0,mesh_data);
 
         Node* domain_ptr = NULL;
-        if(fi == 0)
+        if(fi == 0 || fi == 3)
         {
             mesh.set_external(mesh_data);
             domain_ptr = &mesh;
@@ -2746,6 +2757,172 @@ TEST(conduit_blueprint_mesh_verify, mesh_bad_spacing_name)
     blueprint::mesh::generate_index(n_test,"",1,n_idx);
 }
 
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_verify, mesh_verify_cache)
+{
+    Node mesh;
+    blueprint::mesh::examples::grid("uniform",5,5,0,2,2,1,mesh);
+
+    EXPECT_FALSE(blueprint::mesh::verify_cache_enabled());
+    EXPECT_TRUE(blueprint::mesh::verify(mesh));
+    EXPECT_EQ(blueprint::mesh::verify_cache_size(), 0);
+
+    blueprint::mesh::set_verify_cache_enabled(true);
+    EXPECT_TRUE(blueprint::mesh::verify(mesh));
+    // domains differ in their origins (and domain ids)
+    EXPECT_EQ(blueprint::mesh::verify_cache_size(), 4);
+    EXPECT_TRUE(blueprint::mesh::verify(mesh));
+    EXPECT_EQ(blueprint::mesh::verify_cache_size(), 4);
+
+    // changed strings change the fingerprint, invalid results are not cached
+    Node &dom = mesh.child(0);
+    dom["topologies/mesh/coordset"].set("missing");
+    EXPECT_FALSE(blueprint::mesh::verify(mesh));
+    EXPECT_EQ(blueprint::mesh::verify_cache_size(), 4);
+    dom["topologies/mesh/coordset"].set("coords");
+    EXPECT_TRUE(blueprint::mesh::verify(mesh));
+
+    EXPECT_EQ(blueprint::mesh::verify_cache_size(), 4);
+
+    // so do structural changes, including the order of children
+    Node coordsets = dom["coordsets"];
+    dom.remove("coordsets");
+    EXPECT_FALSE(blueprint::mesh::verify(mesh));
+    dom["coordsets"].set(coordsets);
+    EXPECT_TRUE(blueprint::mesh::verify(mesh));
+    EXPECT_EQ(blueprint::mesh::verify_cache_size(), 5);
+
+    blueprint::mesh::clear_verify_cache();
+    EXPECT_EQ(blueprint::mesh::verify_cache_size(), 0);
+    EXPECT_TRUE(blueprint::mesh::verify(mesh.child(1)));
+    EXPECT_EQ(blueprint::mesh::verify_cache_size(), 1);
+
+    blueprint::mesh::set_verify_cache_enabled(false);
+    EXPECT_EQ(blueprint::mesh::verify_cache_size(), 0);
+    EXPECT_TRUE(blueprint::mesh::verify(mesh));
+    EXPECT_EQ(blueprint::mesh::verify_cache_size(), 0);
+
+    // messages are restored after a boolean verify
+    EXPECT_TRUE(conduit::utils::log::messages_enabled());
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_verify, mesh_deep_topology)
+{
+    Node opts, info;
+    opts["deep"] = 1;
+
+    Node mesh;
+    blueprint::mesh::examples::braid("hexs",4,4,4,mesh);
+    EXPECT_TRUE(blueprint::mesh::verify(mesh,info,opts));
+
+    // out of range point references are reported by index
+    Node &conn = mesh["topologies/mesh/elements/connectivity"];
+    const index_t npts = mesh["coordsets/coords/values/x"].dtype().number_of_elements();
+    int32_array conn_vals = conn.value();
+    conn_vals[5] = static_cast<int32>(npts);
+    conn_vals[17] = -1;
+    EXPECT_TRUE(blueprint::mesh::verify(mesh,info));
+    EXPECT_FALSE(blueprint::mesh::verify(mesh,info,opts));
+    const Node &conn_info = info["topologies/mesh/elements/connectivity"];
+    EXPECT_EQ(conn_info["valid"].as_string(), "false");
+    index_t_accessor bad = conn_info["invalid_indices"].as_index_t_accessor();
+    ASSERT_EQ(bad.number_of_elements(), 2);
+    EXPECT_EQ(bad[0], 5);
+    EXPECT_EQ(bad[1], 17);
+
+    // only the first max_errors indices are reported
+    opts["max_errors"] = 1;
+    EXPECT_FALSE(blueprint::mesh::verify(mesh,info,opts));
+    EXPECT_EQ(info["topologies/mesh/elements/connectivity/invalid_indices"].dtype().number_of_elements(), 1);
+    opts.remove("max_errors");
+
+    // polygonal sizes and offsets
+    blueprint::mesh::examples::braid("quads_poly",4,4,0,mesh);
+    blueprint::mesh::utils::topology::unstructured::generate_offsets_inline(mesh["topologies/mesh"]);
+    EXPECT_TRUE(blueprint::mesh::verify(mesh,info,opts));
+    Node &offsets = mesh["topologies/mesh/elements/offsets"];
+    Node offsets_idx;
+    offsets.to_data_type(DataType::index_t().id(), offsets_idx);
+    offsets.set(offsets_idx);
+    index_t_array offsets_vals = offsets.value();
+    offsets_vals[3] = 0;
+    EXPECT_FALSE(blueprint::mesh::verify(mesh,info,opts));
+    bad = info["topologies/mesh/elements/offsets/invalid_indices"].as_index_t_accessor();
+    ASSERT_EQ(bad.number_of_elements(), 1);
+    EXPECT_EQ(bad[0], 3);
+
+    // polyhedral face references
+    blueprint::mesh::examples::braid("hexs_poly",3,3,3,mesh);
+    blueprint::mesh::utils::topology::unstructured::generate_offsets_inline(mesh["topologies/mesh"]);
+    EXPECT_TRUE(blueprint::mesh::verify(mesh,info,opts));
+    Node &faces = mesh["topologies/mesh/elements/connectivity"];
+    Node faces_idx;
+    faces.to_data_type(DataType::index_t().id(), faces_idx);
+    faces.set(faces_idx);
+    index_t_array faces_vals = faces.value();
+    faces_vals[2] = mesh["topologies/mesh/subelements/sizes"].dtype().number_of_elements();
+    EXPECT_FALSE(blueprint::mesh::verify(mesh,info,opts));
+    bad = info["topologies/mesh/elements/connectivity/invalid_indices"].as_index_t_accessor();
+    ASSERT_EQ(bad.number_of_elements(), 1);
+    EXPECT_EQ(bad[0], 2);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_blueprint_mesh_verify, mesh_deep_matset)
+{
+    Node opts, info;
+    opts["deep"] = 1;
+
+    const std::vector<std::string> matset_types = {"full",
+                                                   "sparse_by_material",
+                                                   "sparse_by_element"};
+    for(const std::string &matset_type : matset_types)
+    {
+        Node mesh;
+        blueprint::mesh::examples::venn(matset_type,10,10,0.25,mesh);
+        EXPECT_TRUE(blueprint::mesh::verify(mesh,info,opts)) << matset_type;
+
+        // scaling every volume fraction breaks the sums
+        Node &vfs = mesh["matsets/matset/volume_fractions"];
+        if(vfs.number_of_children() == 0)
+        {
+            float64_array vals = vfs.value();
+            for(index_t i = 0; i < vals.number_of_elements(); i++)
+            {
+                vals[i] *= 0.5;
+            }
+        }
+        else
+        {
+            NodeIterator itr = vfs.children();
+            while(itr.has_next())
+            {
+                float64_array vals = itr.next().value();
+                for(index_t i = 0; i < vals.number_of_elements(); i++)
+                {
+                    vals[i] *= 0.5;
+                }
+            }
+        }
+        EXPECT_TRUE(blueprint::mesh::verify(mesh,info)) << matset_type;
+        EXPECT_FALSE(blueprint::mesh::verify(mesh,info,opts)) << matset_type;
+        const Node &vfs_info = info["matsets/matset/volume_fractions"];
+        EXPECT_EQ(vfs_info["invalid_indices"].dtype().number_of_elements(), 10);
+        EXPECT_EQ(vfs_info["invalid_indices"].as_index_t_accessor()[0], 0);
+    }
+
+    // multi-domain info is nested by domain
+    Node mesh;
+    blueprint::mesh::examples::venn("full",4,4,0.25,mesh["domain0"]);
+    blueprint::mesh::examples::venn("full",4,4,0.25,mesh["domain1"]);
+    float64_array vals = mesh["domain1/matsets/matset/volume_fractions/background"].value();
+    vals[7] += 0.5;
+    EXPECT_FALSE(blueprint::mesh::verify(mesh,info,opts));
+    EXPECT_EQ(info["domain0/valid"].as_string(), "true");
+    EXPECT_EQ(info["domain1/matsets/matset/volume_fractions/invalid_indices"].as_index_t_accessor()[0], 7);
+}
+
 //-----------------------------------------------------------------------------
 TEST(conduit_blueprint_mesh_verify, empty_mesh_vs_gen_index)
 {
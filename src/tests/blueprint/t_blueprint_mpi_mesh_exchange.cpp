@@ -0,0 +1,221 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: t_blueprint_mpi_mesh_exchange.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+#include "conduit_blueprint.hpp"
+#include "conduit_blueprint_mpi_mesh.hpp"
+#include "conduit_log.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include <mpi.h>
+
+using namespace conduit;
+
+//-----------------------------------------------------------------------------
+// Builds a 2x2 domain grid and keeps the domains whose id % nranks == rank,
+// so each rank has a neighbor on the same rank and on the other rank.
+void
+make_exchange_mesh(int par_rank, int par_size, Node &mesh)
+{
+    Node full;
+    blueprint::mesh::examples::grid("uniform", 5, 5, 0, 2, 2, 1, full);
+
+    NodeIterator itr = full.children();
+    while(itr.has_next())
+    {
+        Node &dom = itr.next();
+        const index_t dom_id = dom["state/domain_id"].to_index_t();
+        if(dom_id % par_size != par_rank)
+        {
+            continue;
+        }
+        Node &out_dom = mesh[itr.name()];
+        out_dom.set(dom);
+
+        const index_t npts = out_dom["fields/braid/values"].dtype().number_of_elements();
+        Node &f = out_dom["fields/dom_id"];
+        f["association"] = "vertex";
+        f["topology"] = "mesh";
+        f["values"].set(DataType::float64(npts));
+        float64_array f_vals = f["values"].value();
+        f_vals.fill(static_cast<float64>(dom_id));
+
+        Node &v = out_dom["fields/vec"];
+        v["association"] = "vertex";
+        v["topology"] = "mesh";
+        v["values/u"].set(DataType::int32(npts));
+        v["values/v"].set(DataType::int64(npts));
+        int32_array u_vals = v["values/u"].value();
+        int64_array v_vals = v["values/v"].value();
+        u_vals.fill(static_cast<int32>(dom_id + 1));
+        v_vals.fill(static_cast<int64>(10 * (dom_id + 1)));
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Returns, per vertex, the ids of all domains that share it (including dom).
+std::vector<std::vector<index_t>>
+sharing_domains(const Node &dom)
+{
+    const index_t dom_id = dom["state/domain_id"].to_index_t();
+    const index_t npts = dom["fields/dom_id/values"].dtype().number_of_elements();
+    std::vector<std::vector<index_t>> res(npts, std::vector<index_t>(1, dom_id));
+
+    NodeConstIterator itr = dom["adjsets/mesh_adj/groups"].children();
+    while(itr.has_next())
+    {
+        const Node &group = itr.next();
+        index_t_accessor nbrs = group["neighbors"].as_index_t_accessor();
+        index_t_accessor vals = group["values"].as_index_t_accessor();
+        for(index_t vi = 0; vi < vals.number_of_elements(); vi++)
+        {
+            for(index_t ni = 0; ni < nbrs.number_of_elements(); ni++)
+            {
+                res[vals[vi]].push_back(nbrs[ni]);
+            }
+        }
+    }
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+TEST(blueprint_mpi_mesh_exchange, replace)
+{
+    int par_rank, par_size;
+    MPI_Comm comm = MPI_COMM_WORLD;
+    MPI_Comm_rank(comm, &par_rank);
+    MPI_Comm_size(comm, &par_size);
+
+    Node mesh;
+    make_exchange_mesh(par_rank, par_size, mesh);
+
+    Node opts;
+    std::vector<std::string> fields = {"dom_id", "vec"};
+    blueprint::mpi::mesh::exchange_fields(mesh, "mesh_adj", fields, opts, comm);
+
+    index_t num_shared = 0;
+    NodeConstIterator itr = mesh.children();
+    while(itr.has_next())
+    {
+        const Node &dom = itr.next();
+        std::vector<std::vector<index_t>> shared = sharing_domains(dom);
+        float64_accessor f_vals = dom["fields/dom_id/values"].as_float64_accessor();
+        int32_accessor u_vals = dom["fields/vec/values/u"].as_int32_accessor();
+        int64_accessor v_vals = dom["fields/vec/values/v"].as_int64_accessor();
+        for(size_t i = 0; i < shared.size(); i++)
+        {
+            const index_t owner = *std::min_element(shared[i].begin(),
+                                                    shared[i].end());
+            num_shared += shared[i].size() > 1 ? 1 : 0;
+            EXPECT_EQ(f_vals[i], static_cast<float64>(owner));
+            EXPECT_EQ(u_vals[i], owner + 1);
+            EXPECT_EQ(v_vals[i], 10 * (owner + 1));
+        }
+    }
+    EXPECT_TRUE(num_shared > 0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(blueprint_mpi_mesh_exchange, reduce_ops)
+{
+    int par_rank, par_size;
+    MPI_Comm comm = MPI_COMM_WORLD;
+    MPI_Comm_rank(comm, &par_rank);
+    MPI_Comm_size(comm, &par_size);
+
+    const std::vector<std::string> ops = {"sum", "max"};
+    for(const std::string &op : ops)
+    {
+        Node mesh;
+        make_exchange_mesh(par_rank, par_size, mesh);
+
+        Node opts;
+        opts["op"] = op;
+        std::vector<std::string> fields = {"dom_id"};
+        blueprint::mpi::mesh::exchange_fields(mesh, "mesh_adj", fields, opts, comm);
+
+        NodeConstIterator itr = mesh.children();
+        while(itr.has_next())
+        {
+            const Node &dom = itr.next();
+            std::vector<std::vector<index_t>> shared = sharing_domains(dom);
+            float64_accessor f_vals = dom["fields/dom_id/values"].as_float64_accessor();
+            for(size_t i = 0; i < shared.size(); i++)
+            {
+                index_t expected = 0;
+                if(op == "sum")
+                {
+                    for(index_t d : shared[i])
+                    {
+                        expected += d;
+                    }
+                }
+                else
+                {
+                    expected = *std::max_element(shared[i].begin(),
+                                                 shared[i].end());
+                }
+                EXPECT_EQ(f_vals[i], static_cast<float64>(expected));
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(blueprint_mpi_mesh_exchange, bad_inputs)
+{
+    int par_rank, par_size;
+    MPI_Comm comm = MPI_COMM_WORLD;
+    MPI_Comm_rank(comm, &par_rank);
+    MPI_Comm_size(comm, &par_size);
+
+    Node mesh;
+    make_exchange_mesh(par_rank, par_size, mesh);
+
+    Node opts;
+    opts["op"] = "avg";
+    std::vector<std::string> fields = {"dom_id"};
+    EXPECT_THROW(blueprint::mpi::mesh::exchange_fields(mesh, "mesh_adj",
+                                                       fields, opts, comm),
+                 conduit::Error);
+
+    // element associated field does not match the vertex adjset
+    opts.reset();
+    fields = {"radial"};
+    EXPECT_THROW(blueprint::mpi::mesh::exchange_fields(mesh, "mesh_adj",
+                                                       fields, opts, comm),
+                 conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    int result = 0;
+
+    ::testing::InitGoogleTest(&argc, argv);
+    MPI_Init(&argc, &argv);
+
+    int size;
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+    if(size == 2)
+        result = RUN_ALL_TESTS();
+    else
+    {
+        std::cout << "This program requires 2 ranks." << std::endl;
+        result = -1;
+    }
+    MPI_Finalize();
+
+    return result;
+}
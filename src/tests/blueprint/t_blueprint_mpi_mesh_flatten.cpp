@@ -10,6 +10,7 @@
 
 #include <iostream>
 #include <string>
+#include <vector>
 
 #include <conduit.hpp>
 #include <conduit_blueprint.hpp>
@@ -346,6 +347,124 @@ TEST(t_blueprint_mpi_mesh_flatten, spiral_select_fields_empty_root)
     }
 }
 
+//-----------------------------------------------------------------------------
+// Compares the leaf columns of a table partition to the rows that start at
+//  row_offset in the gathered table.
+void
+compare_partition(const Node &part, const Node &whole, index_t row_offset)
+{
+    if(whole.number_of_children() > 0)
+    {
+        for(index_t i = 0; i < whole.number_of_children(); i++)
+        {
+            const Node &child = whole[i];
+            ASSERT_TRUE(part.has_child(child.name())) << child.name();
+            compare_partition(part[child.name()], child, row_offset);
+        }
+    }
+    else
+    {
+        const auto p = part.as_float64_accessor();
+        const auto w = whole.as_float64_accessor();
+        ASSERT_LE(row_offset + p.number_of_elements(), w.number_of_elements());
+        for(index_t i = 0; i < p.number_of_elements(); i++)
+        {
+            EXPECT_EQ(p[i], w[row_offset + i]) << whole.path() << "[" << i << "]";
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+index_t
+table_rows(const Node &table)
+{
+    const Node &column = table["values"][0];
+    const Node &leaf = (column.number_of_children() > 0) ? column[0] : column;
+    return leaf.dtype().number_of_elements();
+}
+
+//-----------------------------------------------------------------------------
+void
+test_distributed(bool rebalance, int no_data)
+{
+    const MPI_Comm comm = MPI_COMM_WORLD;
+    int rank = -1, size = 0;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+
+    Node mesh;
+    blueprint::mpi::mesh::examples::spiral_round_robin(4, mesh, comm);
+    if(rank == no_data)
+    {
+        mesh.reset();
+    }
+
+    // Flatten to root for reference.
+    Node table, opts;
+    opts["add_rank"] = 1;
+    blueprint::mpi::mesh::flatten(mesh, opts, table, comm);
+    relay::mpi::broadcast_using_schema(table, 0, comm);
+
+    // Flatten into partitions.
+    Node part;
+    opts["distributed"] = 1;
+    opts["rebalance"] = rebalance ? 1 : 0;
+    blueprint::mpi::mesh::flatten(mesh, opts, part, comm);
+
+    Node info;
+    EXPECT_TRUE(blueprint::table::verify(part, info));
+    const std::vector<std::string> tables{"vertex_data", "element_data"};
+    for(const std::string &name : tables)
+    {
+        ASSERT_TRUE(part.has_child(name));
+        const Node &n_part = part[name];
+        const Node &n_whole = table[name];
+        const index_t nrows = table_rows(n_part);
+        const index_t global_rows = table_rows(n_whole);
+        EXPECT_EQ(n_part["state/global_rows"].to_index_t(), global_rows);
+
+        // The partitions cover the whole table in rank order.
+        index_t my_rows[] = {nrows};
+        std::vector<index_t> all_rows(size, 0);
+        const auto mtype = relay::mpi::conduit_dtype_to_mpi_dtype(DataType::index_t());
+        MPI_Allgather(my_rows, 1, mtype, all_rows.data(), 1, mtype, comm);
+        index_t offset = 0, total = 0;
+        for(int i = 0; i < size; i++)
+        {
+            offset += (i < rank) ? all_rows[i] : 0;
+            total += all_rows[i];
+            if(rebalance)
+            {
+                EXPECT_LE(std::abs(all_rows[i] - global_rows / size), 1);
+            }
+        }
+        EXPECT_EQ(total, global_rows);
+        EXPECT_EQ(n_part["state/row_offset"].to_index_t(), offset);
+        if(!rebalance && rank == no_data)
+        {
+            EXPECT_EQ(nrows, 0);
+        }
+
+        compare_partition(n_part["values"], n_whole["values"], offset);
+    }
+}
+
+TEST(t_blueprint_mpi_mesh_flatten, spiral_distributed)
+{
+    test_distributed(false, -1);
+}
+
+TEST(t_blueprint_mpi_mesh_flatten, spiral_distributed_rebalance)
+{
+    test_distributed(true, -1);
+}
+
+TEST(t_blueprint_mpi_mesh_flatten, spiral_distributed_rebalance_empty_rank)
+{
+    test_distributed(false, 2);
+    test_distributed(true, 2);
+}
+
 //-----------------------------------------------------------------------------
 int main(int argc, char* argv[])
 {
@@ -9,6 +9,9 @@
 //-----------------------------------------------------------------------------
 #include <algorithm>
 #include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
 #include <string>
 #include <vector>
 
@@ -18,6 +21,7 @@
 #include <conduit_blueprint_table_examples.hpp>
 #include <conduit_relay_io.hpp>
 #include <conduit_relay_io_csv.hpp>
+#include <conduit_relay_io_table_bin.hpp>
 
 #include "blueprint_test_helpers.hpp"
 
@@ -194,3 +198,210 @@ TEST(t_blueprint_table_relay, read_write_table_with_list_values)
 
     table::compare_to_baseline(read_table, table);
 }
+
+TEST(t_blueprint_table_relay, read_write_table_bin)
+{
+    const std::string filename = "t_blueprint_table_relay_read_write_table_bin.table_bin";
+    if(utils::is_file(filename))
+    {
+        ASSERT_TRUE(utils::remove_file(filename));
+    }
+
+    Node table;
+    blueprint::table::examples::basic(5, 4, 3, table);
+
+    // Add an interleaved mcarray column.
+    const index_t nrows = table["values/point_data"].dtype().number_of_elements();
+    std::vector<float32> uv(2 * nrows);
+    for(index_t i = 0; i < 2 * nrows; i++)
+    {
+        uv[i] = static_cast<float32>(i);
+    }
+    table["values/uv/u"].set_external(DataType::float32(nrows, 0, 2 * sizeof(float32)), uv.data());
+    table["values/uv/v"].set_external(DataType::float32(nrows, sizeof(float32), 2 * sizeof(float32)), uv.data());
+
+    Node opts;
+    opts["row_group_size"] = 7;
+    relay::io::save(table, filename, opts);
+
+    Node read_table;
+    relay::io::load(filename, read_table);
+    table::compare_to_baseline(read_table, table);
+
+    // The footer has statistics for each row group.
+    Node info;
+    relay::io::read_table_bin_info(filename, info);
+    EXPECT_EQ(info["nrows"].to_index_t(), nrows);
+    const index_t ngroups = (nrows + 6) / 7;
+    const Node &n_column = info["columns"][3];
+    EXPECT_EQ(n_column["name"].as_string(), "point_data");
+    EXPECT_EQ(n_column["stats/count"].dtype().number_of_elements(), ngroups);
+    EXPECT_EQ(n_column["stats/min"].as_float64_array()[1], 7.);
+    EXPECT_EQ(n_column["stats/max"].as_float64_array()[1], 13.);
+
+    // Read a range of rows from some columns.
+    Node read_opts;
+    read_opts["columns"].append().set("point_data");
+    read_opts["columns"].append().set("points/y");
+    read_opts["columns"].append().set("uv");
+    std::vector<index_t> rows{5, 17};
+    read_opts["rows"].set(rows);
+    relay::io::load(filename, read_opts, read_table);
+    EXPECT_EQ(read_table["values"].number_of_children(), 3);
+    EXPECT_FALSE(read_table.has_path("values/points/x"));
+    EXPECT_EQ(read_table["values/points/y"].dtype().number_of_elements(), 12);
+    const auto point_data = read_table["values/point_data"].as_float64_accessor();
+    const auto y = read_table["values/points/y"].as_float64_accessor();
+    const auto yref = table["values/points/y"].as_float64_accessor();
+    const auto v = read_table["values/uv/v"].as_float32_array();
+    for(index_t i = 0; i < 12; i++)
+    {
+        EXPECT_EQ(point_data[i], static_cast<float64>(i + 5));
+        EXPECT_EQ(y[i], yref[i + 5]);
+        EXPECT_EQ(v[i], uv[2 * (i + 5) + 1]);
+    }
+
+    // Read the row groups that may contain point_data values in [15, 22].
+    read_opts.reset();
+    read_opts["filter/column"] = "point_data";
+    read_opts["filter/min"] = 15.;
+    read_opts["filter/max"] = 22.;
+    relay::io::load(filename, read_opts, read_table);
+    const auto filtered = read_table["values/point_data"].as_float64_accessor();
+    ASSERT_EQ(filtered.number_of_elements(), 14);
+    for(index_t i = 0; i < filtered.number_of_elements(); i++)
+    {
+        EXPECT_EQ(filtered[i], static_cast<float64>(i + 14));
+    }
+}
+
+TEST(t_blueprint_table_relay, read_table_bin_other_endianness)
+{
+    const std::string filename = "t_blueprint_table_relay_endianness.table_bin";
+    const std::string swapped_filename = "t_blueprint_table_relay_endianness_swapped.table_bin";
+
+    Node table;
+    blueprint::table::examples::basic(5, 4, 3, table);
+    Node opts;
+    opts["row_group_size"] = 7;
+    relay::io::save(table, filename, opts);
+
+    // Make a copy of the file as it would be written on a machine with the
+    // other byte order.
+    std::ifstream fin(filename, std::ios::in | std::ios::binary);
+    std::vector<char> bytes((std::istreambuf_iterator<char>(fin)),
+                            std::istreambuf_iterator<char>());
+    fin.close();
+    ASSERT_GT(bytes.size(), 32u);
+
+    // The trailer is always little endian.
+    uint64 trailer[2];
+    memcpy(trailer, bytes.data() + bytes.size() - 24, sizeof(trailer));
+    if(Endianness::machine_is_big_endian())
+    {
+        Endianness::swap64(&trailer[0]);
+        Endianness::swap64(&trailer[1]);
+    }
+    const size_t data_end = bytes.size() - 24 - trailer[0] - trailer[1];
+
+    Node info;
+    relay::io::read_table_bin_info(filename, info);
+    const index_t nrows = info["nrows"].to_index_t();
+    const index_t other_endianness = Endianness::machine_is_little_endian()
+        ? Endianness::BIG_ID : Endianness::LITTLE_ID;
+    for(index_t c = 0; c < info["columns"].number_of_children(); c++)
+    {
+        const Node &n_column = info["columns"][c];
+        const DataType dt(DataType::name_to_id(n_column["type"].as_string()), 1);
+        char *ptr = bytes.data() + n_column["data_offset"].to_index_t();
+        for(index_t i = 0; i < nrows; i++, ptr += dt.element_bytes())
+        {
+            if(dt.element_bytes() == 8)
+            {
+                Endianness::swap64(ptr);
+            }
+            else if(dt.element_bytes() == 4)
+            {
+                Endianness::swap32(ptr);
+            }
+            else if(dt.element_bytes() == 2)
+            {
+                Endianness::swap16(ptr);
+            }
+        }
+    }
+    info["endianness"] = Endianness::id_to_name(other_endianness);
+    info.endian_swap(other_endianness);
+
+    Schema footer_schema;
+    info.schema().compact_to(footer_schema);
+    const std::string schema_json = footer_schema.to_json();
+    std::vector<uint8> footer_data;
+    info.serialize(footer_data);
+    trailer[0] = schema_json.size();
+    trailer[1] = footer_data.size();
+    if(Endianness::machine_is_big_endian())
+    {
+        Endianness::swap64(&trailer[0]);
+        Endianness::swap64(&trailer[1]);
+    }
+
+    std::ofstream fout(swapped_filename, std::ios::out | std::ios::binary | std::ios::trunc);
+    fout.write(bytes.data(), data_end);
+    fout.write(schema_json.c_str(), schema_json.size());
+    fout.write(reinterpret_cast<const char *>(footer_data.data()), footer_data.size());
+    fout.write(reinterpret_cast<const char *>(trailer), sizeof(trailer));
+    fout.write(bytes.data() + bytes.size() - 8, 8);
+    fout.close();
+
+    Node read_table;
+    relay::io::load(swapped_filename, "table_bin", read_table);
+    table::compare_to_baseline(read_table, table);
+
+    // The footer statistics are swapped too.
+    Node swapped_info;
+    relay::io::read_table_bin_info(swapped_filename, swapped_info);
+    EXPECT_EQ(swapped_info["nrows"].to_index_t(), nrows);
+    const Node &n_column = swapped_info["columns"][3];
+    EXPECT_EQ(n_column["name"].as_string(), "point_data");
+    EXPECT_EQ(n_column["stats/min"].as_float64_array()[1], 7.);
+    EXPECT_EQ(n_column["stats/max"].as_float64_array()[1], 13.);
+
+    // Row group filters use the swapped statistics.
+    Node read_opts;
+    read_opts["filter/column"] = "point_data";
+    read_opts["filter/min"] = 15.;
+    read_opts["filter/max"] = 22.;
+    relay::io::load(swapped_filename, "table_bin", read_opts, read_table);
+    const auto filtered = read_table["values/point_data"].as_float64_accessor();
+    ASSERT_EQ(filtered.number_of_elements(), 14);
+    for(index_t i = 0; i < filtered.number_of_elements(); i++)
+    {
+        EXPECT_EQ(filtered[i], static_cast<float64>(i + 14));
+    }
+}
+
+TEST(t_blueprint_table_relay, read_write_multi_table_bin)
+{
+    const std::string filename = "t_blueprint_table_relay_read_write_multi_table_bin.table_bin";
+    ASSERT_EQ(0, cleanup_dir(filename));
+
+    Node table;
+    blueprint::table::examples::basic(5, 4, 3, table["a"]);
+    blueprint::table::examples::basic(6, 3, 2, table["b"]);
+    relay::io::save(table, filename);
+    ASSERT_TRUE(utils::is_directory(filename));
+
+    Node read_table;
+    relay::io::load(filename, read_table);
+    table::compare_to_baseline(read_table, table);
+
+    const std::string list_filename = "t_blueprint_table_relay_read_write_multi_table_list_bin.table_bin";
+    ASSERT_EQ(0, cleanup_dir(list_filename));
+    Node list_table;
+    list_table.append().set_external(table["a"]);
+    list_table.append().set_external(table["b"]);
+    relay::io::save(list_table, list_filename);
+    relay::io::load(list_filename, read_table);
+    table::compare_to_baseline(read_table, list_table);
+}
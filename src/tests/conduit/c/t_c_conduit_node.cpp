@@ -11,6 +11,8 @@
 #include "conduit.h"
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include "gtest/gtest.h"
 
 //-----------------------------------------------------------------------------
@@ -626,3 +628,79 @@ TEST(c_conduit_node, c_move_and_swap)
 
 
 
+//-----------------------------------------------------------------------------
+TEST(c_conduit_node, c_leaf_descriptors)
+{
+    conduit_node *n = conduit_node_create();
+
+    conduit_float64 vals[6] = {0.0, 1.0, 2.0, 3.0, 4.0, 5.0};
+    conduit_node_set_path_int(n,"a",10);
+    conduit_node_set_path_external_float64_ptr_detailed(n,
+                                                        "b/strided",
+                                                        vals,
+                                                        3,
+                                                        8,
+                                                        16,
+                                                        8,
+                                                        CONDUIT_ENDIANNESS_DEFAULT_ID);
+    conduit_node_set_path_char8_str(n,"b/name","mesh");
+    conduit_node *lst = conduit_node_fetch(n,"c");
+    conduit_node_set_int(conduit_node_append(lst),1);
+    conduit_node_set_int(conduit_node_append(lst),2);
+    // empty nodes are not leaves
+    conduit_node_fetch(n,"d");
+
+    conduit_index_t num_leaves = 0;
+    conduit_leaf_descriptor *descs = conduit_node_leaf_descriptors(n,
+                                                                   &num_leaves);
+    ASSERT_EQ(num_leaves,5);
+
+    const char *expected_paths[5] = {"a", "b/strided", "b/name",
+                                     "c/[0]", "c/[1]"};
+    for(conduit_index_t i = 0; i < num_leaves; i++)
+    {
+        EXPECT_STREQ(descs[i].path, expected_paths[i]);
+        EXPECT_EQ(descs[i].path_length,
+                  (conduit_index_t)strlen(expected_paths[i]));
+        // paths match the node's own path, and data matches the node
+        char *leaf_path = conduit_node_path(descs[i].node);
+        EXPECT_STREQ(descs[i].path, leaf_path);
+        free(leaf_path);
+        EXPECT_EQ(descs[i].data_ptr,
+                  conduit_node_element_ptr(descs[i].node,0));
+    }
+    EXPECT_EQ(descs[0].node, conduit_node_fetch_existing(n,"a"));
+    EXPECT_EQ(descs[4].node, conduit_node_child(lst,1));
+
+    EXPECT_EQ(descs[1].dtype_id, CONDUIT_FLOAT64_ID);
+    EXPECT_EQ(descs[1].number_of_elements, 3);
+    EXPECT_EQ(descs[1].offset, 8);
+    EXPECT_EQ(descs[1].stride, 16);
+    EXPECT_EQ(descs[1].element_bytes, 8);
+    EXPECT_EQ(descs[1].data_ptr, (void*)&vals[1]);
+    EXPECT_EQ(descs[2].dtype_id, CONDUIT_CHAR8_STR_ID);
+
+    // write through the cached pointers
+    conduit_float64 *b_ptr = (conduit_float64*)descs[1].data_ptr;
+    b_ptr[2] = 42.0;
+    EXPECT_EQ(vals[3], 42.0);
+
+    conduit_leaf_descriptors_destroy(descs);
+
+    // a leaf describes itself with an empty path
+    conduit_node *a = conduit_node_fetch(n,"a");
+    descs = conduit_node_leaf_descriptors(a,&num_leaves);
+    ASSERT_EQ(num_leaves,1);
+    EXPECT_STREQ(descs[0].path,"");
+    EXPECT_EQ(descs[0].path_length,0);
+    conduit_leaf_descriptors_destroy(descs);
+
+    // no leaves
+    conduit_node *e = conduit_node_create();
+    EXPECT_TRUE(conduit_node_leaf_descriptors(e,&num_leaves) == NULL);
+    EXPECT_EQ(num_leaves,0);
+
+    conduit_node_destroy(e);
+    conduit_node_destroy(n);
+}
+
@@ -0,0 +1,70 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_data_convert_benchmark.cpp
+///
+/// Times Node::to_float32_array on float64 data against a per element
+/// accessor loop. Not run as part of the tests.
+///
+/// usage: conduit_data_convert_benchmark [num_elements]
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+
+#include <cstdlib>
+#include <iostream>
+
+using namespace conduit;
+
+//-----------------------------------------------------------------------------
+int
+main(int argc, char **argv)
+{
+    index_t num_ele = 8 * 1024 * 1024;
+    if(argc > 1)
+    {
+        num_ele = (index_t) atol(argv[1]);
+    }
+    int num_iters = 5;
+
+    Node n_src, n_res;
+    n_src.set(DataType::float64(num_ele));
+    float64 *src_ptr = n_src.value();
+    for(index_t i = 0; i < num_ele; i++)
+    {
+        src_ptr[i] = (float64) i;
+    }
+
+    // reference: per element conversion through the accessor
+    n_res.set(DataType::float32(num_ele));
+    float32 *res_ptr = n_res.value();
+    float64_accessor src_acc = n_src.as_float64_accessor();
+    utils::Timer t_ref;
+    for(int iter = 0; iter < num_iters; iter++)
+    {
+        for(index_t i = 0; i < num_ele; i++)
+        {
+            res_ptr[i] = (float32) src_acc[i];
+        }
+    }
+    float ref_time = t_ref.elapsed() / num_iters;
+
+    utils::Timer t_conv;
+    for(int iter = 0; iter < num_iters; iter++)
+    {
+        n_src.to_float32_array(n_res);
+    }
+    float conv_time = t_conv.elapsed() / num_iters;
+
+    std::cout << "float64 -> float32, " << num_ele << " elements" << std::endl
+              << "  per element accessor loop: " << ref_time  << " s"
+              << std::endl
+              << "  to_float32_array:          " << conv_time << " s"
+              << std::endl;
+
+    return 0;
+}
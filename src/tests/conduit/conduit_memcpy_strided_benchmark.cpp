@@ -0,0 +1,116 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_memcpy_strided_benchmark.cpp
+///
+/// Times conduit_memcpy_strided_elements with the default kernels against
+/// one memcpy handler call per element. Not run as part of the tests.
+///
+/// usage: conduit_memcpy_strided_benchmark [num_elements]
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <string.h>
+#include <vector>
+
+using namespace conduit;
+
+//-----------------------------------------------------------------------------
+// a custom memcpy handler forces the per element path
+//-----------------------------------------------------------------------------
+void
+per_element_memcpy(void *dest, const void *src, size_t num)
+{
+    memcpy(dest, src, num);
+}
+
+//-----------------------------------------------------------------------------
+float
+time_strided_copy(size_t num_elements,
+                  size_t ele_bytes,
+                  size_t dest_stride,
+                  size_t src_stride,
+                  int reps)
+{
+    std::vector<uint8> src(num_elements * src_stride, 1);
+    std::vector<uint8> dest(num_elements * dest_stride, 0);
+    utils::Timer t;
+    for(int r = 0; r < reps; r++)
+    {
+        utils::conduit_memcpy_strided_elements(dest.data(),
+                                               num_elements,
+                                               ele_bytes,
+                                               dest_stride,
+                                               src.data(),
+                                               src_stride);
+    }
+    return t.elapsed() / reps;
+}
+
+//-----------------------------------------------------------------------------
+int
+main(int argc, char **argv)
+{
+    size_t num_elements = 1000000;
+    if(argc > 1)
+    {
+        num_elements = (size_t) atol(argv[1]);
+    }
+
+    struct Case
+    {
+        const char *name;
+        size_t      ele_bytes;
+        size_t      dest_stride;
+        size_t      src_stride;
+    };
+
+    Case cases[] = { {"float64 xyz gather   (8, 24->8)",  8,  8, 24},
+                     {"float64 xyz scatter  (8, 8->24)",  8, 24,  8},
+                     {"float32 xyz gather   (4, 12->4)",  4,  4, 12},
+                     {"float64 wide gather  (8, 40->8)",  8,  8, 40},
+                     {"int16 gather         (2, 6->2)",   2,  2,  6},
+                     {"complex128 gather  (16, 32->16)", 16, 16, 32} };
+
+    const int reps = 5;
+
+    std::cout << std::left << std::setw(34) << "case"
+              << std::setw(16) << "kernels (s)"
+              << std::setw(18) << "per element (s)"
+              << "speedup" << std::endl;
+
+    for(size_t c = 0; c < sizeof(cases) / sizeof(Case); c++)
+    {
+        const Case &cs = cases[c];
+        float t_kernels = time_strided_copy(num_elements,
+                                            cs.ele_bytes,
+                                            cs.dest_stride,
+                                            cs.src_stride,
+                                            reps);
+
+        // a custom memcpy handler forces the old per element path
+        utils::set_memcpy_handler(per_element_memcpy);
+        float t_per_ele = time_strided_copy(num_elements,
+                                            cs.ele_bytes,
+                                            cs.dest_stride,
+                                            cs.src_stride,
+                                            reps);
+        utils::set_memcpy_handler(utils::default_memcpy_handler);
+
+        std::cout << std::left << std::setw(34) << cs.name
+                  << std::setw(16) << t_kernels
+                  << std::setw(18) << t_per_ele
+                  << (t_kernels > 0 ? t_per_ele / t_kernels : 0.0f)
+                  << std::endl;
+    }
+
+    return 0;
+}
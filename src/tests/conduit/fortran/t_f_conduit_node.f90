@@ -643,6 +643,47 @@ contains
       end subroutine t_node_move_and_swap
 
 
+      !--------------------------------------------------------------------------
+      subroutine t_node_leaf_descriptors
+          type(C_PTR) cnode
+          type(C_PTR) cdescs
+          real(kind=8), pointer :: check_ptr(:)
+          type(conduit_leaf_descriptor), pointer :: descs(:)
+          real(kind=8), pointer :: f_ptr(:)
+          real(kind=8), dimension(5) :: vals = (/1.0, 2.0, 3.0, 4.0, 5.0/)
+          integer(C_SIZE_T) nvals
+
+          !----------------------------------------------------------------------
+          call set_case_name("t_node_leaf_descriptors")
+          !----------------------------------------------------------------------
+
+          nvals = 5
+          cnode = conduit_node_create()
+          call conduit_node_set_path_int32(cnode,"a",42)
+          call conduit_node_set_path_float64_ptr(cnode,"fields/b",vals,nvals)
+
+          ! describe every leaf once, then use the cached pointers
+          call conduit_node_leaf_descriptors(cnode,descs,cdescs)
+          call assert_equals(2, size(descs))
+          call assert_equals("a", conduit_leaf_descriptor_path(descs(1)))
+          call assert_equals("fields/b", conduit_leaf_descriptor_path(descs(2)))
+          call assert_equals(CONDUIT_INT32_ID, int(descs(1)%dtype_id))
+          call assert_equals(CONDUIT_FLOAT64_ID, int(descs(2)%dtype_id))
+          call assert_equals(5, int(descs(2)%number_of_elements))
+          call assert_equals(8, int(descs(2)%stride))
+
+          call c_f_pointer(descs(2)%data_ptr, f_ptr, (/descs(2)%number_of_elements/))
+          call assert_equals(3.0d+0, f_ptr(3))
+          f_ptr(3) = 10.0d+0
+          call conduit_node_fetch_path_as_float64_ptr(cnode,"fields/b",check_ptr)
+          call assert_equals(10.0d+0, check_ptr(3))
+
+          call conduit_leaf_descriptors_destroy(cdescs)
+          call conduit_node_destroy(cnode)
+
+      end subroutine t_node_leaf_descriptors
+
+
 !------------------------------------------------------------------------------
 end module f_conduit_node
 !------------------------------------------------------------------------------
@@ -676,6 +717,7 @@ program fortran_test
   call t_node_fetch_existing
   call t_node_reset
   call t_node_move_and_swap
+  call t_node_leaf_descriptors
 
   call fruit_summary
   call fruit_finalize
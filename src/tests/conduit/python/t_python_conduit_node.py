@@ -257,6 +257,73 @@ class Test_Conduit_Node(unittest.TestCase):
             for i in range(len(ext_data)):
                 self.assertEqual(n.value()[i], ext_data[i])
 
+    def test_set_external_ndarray(self):
+        base_data = np.arange(60, dtype='float64').reshape(3,4,5)
+        views = [base_data,
+                 np.asfortranarray(base_data),
+                 base_data[:, 1:3, ::2],
+                 base_data[::-1, :, 1]]
+        for ext_data in views:
+            n = Node()
+            n.set_external(ext_data)
+            # NDIndex order, fastest varying dim first
+            self.assertEqual(list(n['shape']), list(ext_data.shape[::-1]))
+            self.assertEqual(n['offset'].size, ext_data.ndim)
+            self.assertEqual(n['stride'].size, ext_data.ndim)
+            res = n.ndarray()
+            self.assertEqual(res.shape, ext_data.shape)
+            self.assertTrue(np.array_equal(res, ext_data))
+            self.assertTrue(np.shares_memory(res, ext_data))
+            res[0,0] = -1
+            self.assertEqual(ext_data[0,0].flat[0], -1)
+        # explicit NDIndex description of a padded 2d array
+        n = Node()
+        n['values'] = np.arange(24, dtype='int32')
+        n['shape'] = np.array([2, 3], dtype='int64')
+        n['offset'] = np.array([1, 1], dtype='int64')
+        n['stride'] = np.array([1, 6], dtype='int64')
+        res = n.ndarray()
+        self.assertEqual(res.shape, (3, 2))
+        self.assertTrue(np.array_equal(res, [[7, 8], [13, 14], [19, 20]]))
+        # descriptions that step outside values are rejected
+        n['shape'] = np.array([6, 4], dtype='int64')
+        with self.assertRaises(TypeError):
+            n.ndarray()
+
+    def test_buffer_protocol(self):
+        n = Node()
+        n['a'] = np.arange(10, dtype='int32')
+        m = memoryview(n.fetch('a'))
+        self.assertEqual(m.format, 'i')
+        self.assertEqual(m.shape, (10,))
+        self.assertEqual(m.tolist(), list(range(10)))
+        m[3] = 42
+        self.assertEqual(n['a'][3], 42)
+        # strided leaf
+        base_data = np.arange(20, dtype='float32')
+        n2 = Node()
+        n2.set_external(base_data[1:16:2])
+        m2 = memoryview(n2)
+        self.assertEqual(m2.strides, (8,))
+        self.assertFalse(m2.c_contiguous)
+        self.assertTrue(np.array_equal(np.asarray(n2), base_data[1:16:2]))
+        # n-d
+        ext_data = np.arange(24, dtype='uint16').reshape(2,3,4)
+        n3 = Node()
+        n3.set_external(ext_data)
+        m3 = memoryview(n3)
+        self.assertEqual(m3.shape, (2,3,4))
+        self.assertTrue(m3.c_contiguous)
+        res = np.asarray(n3)
+        self.assertTrue(np.shares_memory(res, ext_data))
+        # only numeric data can be exported
+        with self.assertRaises(BufferError):
+            memoryview(Node())
+        n4 = Node()
+        n4['s'] = "string"
+        with self.assertRaises(BufferError):
+            memoryview(n4.fetch('s'))
+
     def test_diff(self):
         n1 = Node()
         n2 = Node()
@@ -535,12 +602,13 @@ class Test_Conduit_Node(unittest.TestCase):
         sdiff = np.setdiff1d(n['vs'], v[:,0])
         print("Set Difference: ",sdiff )
         self.assertEqual(len(sdiff), 0);
-        # a more complex slice, can't use set external here.
+        # a more complex slice, set external creates an ndarray node
         n = Node()
         numpy_array = np.array(range(105), dtype='float64')
         v = numpy_array.reshape((3, 7, 5))
-        with self.assertRaises(TypeError):
-            n['vs'].set_external(v[:,0,3:5])
+        n['vs'].set_external(v[:,0,3:5])
+        self.assertTrue(np.array_equal(n.fetch('vs').ndarray(), v[:,0,3:5]))
+        n = Node()
         # lets do a 1-d eff slice, this should work since
         # it reduces to a 1-D strided case
         n['vs'].set_external(v[:,0,0])
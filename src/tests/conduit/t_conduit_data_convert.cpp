@@ -0,0 +1,245 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: t_conduit_data_convert.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+
+#include <iostream>
+#include <vector>
+#include "gtest/gtest.h"
+
+using namespace conduit;
+
+//-----------------------------------------------------------------------------
+const index_t numeric_ids[] = { DataType::INT8_ID,
+                                DataType::INT16_ID,
+                                DataType::INT32_ID,
+                                DataType::INT64_ID,
+                                DataType::UINT8_ID,
+                                DataType::UINT16_ID,
+                                DataType::UINT32_ID,
+                                DataType::UINT64_ID,
+                                DataType::FLOAT32_ID,
+                                DataType::FLOAT64_ID};
+
+//-----------------------------------------------------------------------------
+TEST(conduit_data_convert, all_pairs)
+{
+    index_t num_ele = 37;
+
+    for(index_t src_id : numeric_ids)
+    {
+        Node n_src, n_vals;
+        n_vals.set(DataType::float64(num_ele));
+        float64_array vals = n_vals.value();
+        for(index_t i = 0; i < num_ele; i++)
+        {
+            vals[i] = (float64)(i * 3);
+        }
+        n_vals.to_data_type(src_id, n_src);
+        EXPECT_EQ(n_src.dtype().id(), src_id);
+
+        for(index_t dest_id : numeric_ids)
+        {
+            EXPECT_TRUE(utils::convert_kernel(dest_id, src_id) != NULL);
+
+            Node n_res;
+            n_src.to_data_type(dest_id, n_res);
+            EXPECT_EQ(n_res.dtype().id(), dest_id);
+            EXPECT_EQ(n_res.dtype().number_of_elements(), num_ele);
+
+            float64_accessor res_vals = n_res.as_float64_accessor();
+            for(index_t i = 0; i < num_ele; i++)
+            {
+                EXPECT_EQ(res_vals[i], (float64)(i * 3));
+            }
+        }
+    }
+
+    EXPECT_TRUE(utils::convert_kernel(DataType::CHAR8_STR_ID,
+                                      DataType::INT32_ID) == NULL);
+    EXPECT_TRUE(utils::convert_kernel(DataType::FLOAT64_ID,
+                                      DataType::OBJECT_ID) == NULL);
+
+    Node n_str, n_res;
+    n_str.set("a string");
+    EXPECT_THROW(n_str.to_float64_array(n_res), conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_data_convert, cast_semantics)
+{
+    float64 vals[4] = {-2.7, 2.7, 255.0, 65.5};
+
+    Node n_src, n_res;
+    n_src.set_external(vals, 4);
+
+    n_src.to_int32_array(n_res);
+    int32_array i32_vals = n_res.value();
+    EXPECT_EQ(i32_vals[0], -2);
+    EXPECT_EQ(i32_vals[1], 2);
+    EXPECT_EQ(i32_vals[2], 255);
+    EXPECT_EQ(i32_vals[3], 65);
+
+    n_src.to_uint8_array(n_res);
+    uint8_array u8_vals = n_res.value();
+    EXPECT_EQ(u8_vals[1], 2);
+    EXPECT_EQ(u8_vals[2], 255);
+
+    int64 ivals[3] = {-1, 1, 3};
+    n_src.set_external(ivals, 3);
+    n_src.to_uint32_array(n_res);
+    uint32_array u32_vals = n_res.value();
+    EXPECT_EQ(u32_vals[0], (uint32)-1);
+    EXPECT_EQ(u32_vals[2], 3u);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_data_convert, strided_and_unaligned)
+{
+    index_t num_ele = 100;
+
+    // interleaved xyz float64 values
+    std::vector<float64> xyz(num_ele * 3);
+    for(index_t i = 0; i < num_ele; i++)
+    {
+        xyz[i*3]   = (float64) i;
+        xyz[i*3+1] = (float64) (i + 1000);
+        xyz[i*3+2] = (float64) (i + 2000);
+    }
+
+    Node n_y, n_res;
+    n_y.set_external(DataType::float64(num_ele,
+                                       sizeof(float64),
+                                       3 * sizeof(float64)),
+                     xyz.data());
+    n_y.to_int32_array(n_res);
+    EXPECT_TRUE(n_res.dtype().is_compact());
+    int32_array y_vals = n_res.value();
+    for(index_t i = 0; i < num_ele; i++)
+    {
+        EXPECT_EQ(y_vals[i], i + 1000);
+    }
+
+    // int32 values that start one byte into a buffer
+    std::vector<uint8> bytes(num_ele * sizeof(int32) + 1);
+    for(index_t i = 0; i < num_ele; i++)
+    {
+        int32 v = (int32) (i - 50);
+        memcpy(bytes.data() + 1 + i * sizeof(int32), &v, sizeof(int32));
+    }
+
+    Node n_unaligned;
+    n_unaligned.set_external(DataType::int32(num_ele, 1), bytes.data());
+    n_unaligned.to_float64_array(n_res);
+    float64_array f64_vals = n_res.value();
+    for(index_t i = 0; i < num_ele; i++)
+    {
+        EXPECT_EQ(f64_vals[i], (float64) (i - 50));
+    }
+
+    // typed DataArray sets between strided arrays
+    float64_array x_src(xyz.data(),
+                        DataType::float64(num_ele,
+                                          0,
+                                          3 * sizeof(float64)));
+    Node n_ints;
+    n_ints.set(DataType::int32(num_ele));
+    int32_array ints = n_ints.value();
+    ints.set(x_src);
+    for(index_t i = 0; i < num_ele; i++)
+    {
+        EXPECT_EQ(ints[i], i);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_data_convert, large_parallel)
+{
+    // large enough to be split into blocks
+    index_t num_ele = 3 * 1024 * 1024 + 17;
+
+    Node n_src, n_res;
+    n_src.set(DataType::int32(num_ele));
+    int32 *src_ptr = n_src.value();
+    for(index_t i = 0; i < num_ele; i++)
+    {
+        src_ptr[i] = (int32)(i % 100000);
+    }
+
+    n_src.to_float32_array(n_res);
+    float32 *res_ptr = n_res.value();
+    index_t num_bad = 0;
+    for(index_t i = 0; i < num_ele; i++)
+    {
+        if(res_ptr[i] != (float32)(i % 100000))
+        {
+            num_bad++;
+        }
+    }
+    EXPECT_EQ(num_bad, 0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_data_convert, convert_to_data_type)
+{
+    int32 vals[4] = {1, -2, 3, -4};
+
+    // same width, in place: external data is converted where it lives
+    Node n;
+    n.set_external(vals, 4);
+    n.convert_to_data_type(DataType::FLOAT32_ID, true);
+    EXPECT_EQ(n.dtype().id(), (index_t)DataType::FLOAT32_ID);
+    EXPECT_EQ(n.data_ptr(), (void*)vals);
+    float32 *f32_vals = (float32*)(void*)vals;
+    EXPECT_EQ(f32_vals[0], 1.0f);
+    EXPECT_EQ(f32_vals[3], -4.0f);
+
+    // different width: the node gets new data
+    n.convert_to_data_type(DataType::FLOAT64_ID, true);
+    EXPECT_EQ(n.dtype().id(), (index_t)DataType::FLOAT64_ID);
+    EXPECT_NE(n.data_ptr(), (void*)vals);
+    float64_array f64_vals = n.value();
+    EXPECT_EQ(f64_vals[1], -2.0);
+    EXPECT_EQ(f64_vals[2], 3.0);
+
+    // not in place: the node gets new data even for the same width
+    n.convert_to_data_type(DataType::INT64_ID);
+    EXPECT_EQ(n.dtype().id(), (index_t)DataType::INT64_ID);
+    int64_array i64_vals = n.value();
+    EXPECT_EQ(i64_vals[3], -4);
+
+    // strided child of a compact tree keeps its layout
+    Schema s;
+    s["a"].set(DataType::int64(5, 0, 16));
+    s["b"].set(DataType::float64(5, 8, 16));
+    Node n_tree(s);
+    int64_array a_vals = n_tree["a"].value();
+    float64_array b_vals = n_tree["b"].value();
+    for(index_t i = 0; i < 5; i++)
+    {
+        a_vals[i] = i * 10;
+        b_vals[i] = 0.5;
+    }
+    n_tree["a"].convert_to_data_type(DataType::FLOAT64_ID, true);
+    EXPECT_EQ(n_tree["a"].dtype().stride(), 16);
+    EXPECT_EQ(n_tree.schema()["a"].dtype().id(),
+              (index_t)DataType::FLOAT64_ID);
+    float64_array a_f64_vals = n_tree["a"].value();
+    for(index_t i = 0; i < 5; i++)
+    {
+        EXPECT_EQ(a_f64_vals[i], (float64)(i * 10));
+        EXPECT_EQ(b_vals[i], 0.5);
+    }
+
+    Node n_str;
+    n_str.set("a string");
+    EXPECT_THROW(n_str.convert_to_data_type(DataType::INT32_ID, true),
+                 conduit::Error);
+}
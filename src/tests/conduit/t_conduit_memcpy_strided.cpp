@@ -0,0 +1,181 @@
+// Copyright (c) Lawrence Livermore National Security, LLC and other Conduit
+// Project developers. See top-level LICENSE AND COPYRIGHT files for dates and
+// other details. No copyright assignment is required to contribute to Conduit.
+
+//-----------------------------------------------------------------------------
+///
+/// file: t_conduit_memcpy_strided.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+
+#include <iostream>
+#include <string.h>
+#include <vector>
+#include "gtest/gtest.h"
+
+using namespace conduit;
+
+//-----------------------------------------------------------------------------
+// reference: copy one element at a time
+//-----------------------------------------------------------------------------
+void
+ref_strided_copy(uint8 *dest,
+                 size_t num_elements,
+                 size_t ele_bytes,
+                 size_t dest_stride,
+                 const uint8 *src,
+                 size_t src_stride)
+{
+    for(size_t i = 0; i < num_elements; i++)
+    {
+        memcpy(dest + i * dest_stride, src + i * src_stride, ele_bytes);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// copies with conduit_memcpy_strided_elements and checks against the
+// reference, including bytes between strided elements
+//-----------------------------------------------------------------------------
+bool
+check_strided_copy(size_t num_elements,
+                   size_t ele_bytes,
+                   size_t dest_stride,
+                   size_t src_stride)
+{
+    std::vector<uint8> src(num_elements * src_stride + ele_bytes);
+    for(size_t i = 0; i < src.size(); i++)
+    {
+        src[i] = (uint8)(i * 7 + 3);
+    }
+
+    std::vector<uint8> dest(num_elements * dest_stride + ele_bytes, 0xab);
+    std::vector<uint8> ref(dest);
+
+    utils::conduit_memcpy_strided_elements(dest.data(),
+                                           num_elements,
+                                           ele_bytes,
+                                           dest_stride,
+                                           src.data(),
+                                           src_stride);
+    ref_strided_copy(ref.data(),
+                     num_elements,
+                     ele_bytes,
+                     dest_stride,
+                     src.data(),
+                     src_stride);
+    return dest == ref;
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_memcpy_strided, element_sizes_and_strides)
+{
+    size_t ele_sizes[] = {1, 2, 3, 4, 8, 12, 16};
+    for(size_t e = 0; e < sizeof(ele_sizes) / sizeof(size_t); e++)
+    {
+        size_t ele_bytes = ele_sizes[e];
+        for(size_t ds = 1; ds <= 5; ds++)
+        {
+            for(size_t ss = 1; ss <= 5; ss++)
+            {
+                EXPECT_TRUE(check_strided_copy(1001,
+                                               ele_bytes,
+                                               ds * ele_bytes,
+                                               ss * ele_bytes))
+                    << "ele_bytes=" << ele_bytes
+                    << " dest_stride=" << ds * ele_bytes
+                    << " src_stride=" << ss * ele_bytes;
+            }
+        }
+        // strides that are not a multiple of the element size
+        EXPECT_TRUE(check_strided_copy(1001, ele_bytes, ele_bytes, ele_bytes + 1));
+        EXPECT_TRUE(check_strided_copy(1001, ele_bytes, ele_bytes + 3, ele_bytes));
+    }
+
+    // empty copy
+    EXPECT_TRUE(check_strided_copy(0, 8, 8, 24));
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_memcpy_strided, large_parallel)
+{
+    // large enough to use the blocked (parallel) path
+    EXPECT_TRUE(check_strided_copy(1000003, 8, 8, 24));
+    EXPECT_TRUE(check_strided_copy(1000003, 4, 12, 4));
+    EXPECT_TRUE(check_strided_copy(1000003, 8, 16, 40));
+}
+
+//-----------------------------------------------------------------------------
+// custom handlers
+//-----------------------------------------------------------------------------
+static int memcpy_calls = 0;
+static int memcpy_strided_calls = 0;
+
+//-----------------------------------------------------------------------------
+void
+counting_memcpy(void *dest, const void *src, size_t num)
+{
+    memcpy_calls++;
+    memcpy(dest, src, num);
+}
+
+//-----------------------------------------------------------------------------
+void
+counting_memcpy_strided(void *dest,
+                        size_t num_elements,
+                        size_t ele_bytes,
+                        size_t dest_stride,
+                        const void *src,
+                        size_t src_stride)
+{
+    memcpy_strided_calls++;
+    ref_strided_copy((uint8*)dest,
+                     num_elements,
+                     ele_bytes,
+                     dest_stride,
+                     (const uint8*)src,
+                     src_stride);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_memcpy_strided, custom_handlers)
+{
+    std::vector<float64> xyz(30);
+    for(size_t i = 0; i < xyz.size(); i++)
+    {
+        xyz[i] = (float64) i;
+    }
+
+    Node n;
+    n["x"].set_external(DataType::float64(10,0,3*sizeof(float64)),
+                        xyz.data());
+
+    // a custom memcpy handler without a strided handler is called for
+    // each element
+    memcpy_calls = 0;
+    utils::set_memcpy_handler(counting_memcpy);
+    Node n_compact;
+    n.compact_to(n_compact);
+    EXPECT_EQ(memcpy_calls, 10);
+    EXPECT_EQ(n_compact["x"].as_float64_ptr()[9], 27.0);
+
+    // with a strided handler, strided copies are a single call
+    memcpy_calls = 0;
+    memcpy_strided_calls = 0;
+    utils::set_memcpy_strided_elements_handler(counting_memcpy_strided);
+    n.compact_to(n_compact);
+    EXPECT_EQ(memcpy_calls, 0);
+    EXPECT_EQ(memcpy_strided_calls, 1);
+    EXPECT_EQ(n_compact["x"].as_float64_ptr()[9], 27.0);
+
+    // compact copies still use the memcpy handler
+    Node n_copy;
+    n_copy.set(n_compact);
+    EXPECT_EQ(memcpy_calls, 1);
+    EXPECT_EQ(memcpy_strided_calls, 1);
+
+    utils::set_memcpy_handler(utils::default_memcpy_handler);
+    utils::set_memcpy_strided_elements_handler(
+        utils::default_memcpy_strided_elements_handler);
+}
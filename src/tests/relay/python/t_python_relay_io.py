@@ -10,6 +10,8 @@
 import sys
 import os
 import unittest
+import threading
+import time
 
 from numpy import *
 from conduit import Node
@@ -182,6 +184,97 @@ class Test_Relay_IO(unittest.TestCase):
         with self.assertRaises(IOError):
             relay.io.save_merged(n,"/bad/bad/bad/cant_write_here_either.conduit_bin");
 
+    def test_threaded_load_save(self):
+        # several python threads can save and load at the same time
+        nthreads = 4
+        nvals = 1000000
+        def save_load(idx, res):
+            n = Node()
+            n['idx'] = int64(idx)
+            n['vals'] = arange(nvals, dtype=float64) * idx
+            fname = "tout_python_relay_io_threaded_%d.conduit_bin" % idx
+            relay.io.save(n,fname)
+            n_load = Node()
+            relay.io.load(n_load,fname)
+            res[idx] = n_load['idx'] == idx and \
+                       n_load['vals'][nvals-1] == (nvals - 1) * idx
+        res = [False] * nthreads
+        threads = [ threading.Thread(target=save_load, args=(i,res))
+                    for i in range(nthreads) ]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+        self.assertTrue(all(res))
+
+    def test_save_releases_gil(self):
+        # another python thread makes progress while a large save runs
+        n = Node()
+        n['vals'] = arange(8000000, dtype=float64)
+        state = {"in_save": False, "done": False, "ticks": 0}
+        def monitor():
+            while not state["done"]:
+                if state["in_save"]:
+                    state["ticks"] += 1
+                time.sleep(0.001)
+        t = threading.Thread(target=monitor)
+        t.start()
+        time.sleep(0.01)
+        state["in_save"] = True
+        relay.io.save(n,"tout_python_relay_io_gil.conduit_bin")
+        state["in_save"] = False
+        state["done"] = True
+        t.join()
+        # if the save held the GIL, the monitor could only tick right
+        # before and right after the call
+        self.assertGreater(state["ticks"], 4)
+
+    def test_modify_node_in_use(self):
+        # a node can't be changed while a call that released the GIL
+        # is using it
+        n = Node()
+        n['vals'] = arange(8000000, dtype=float64)
+        n_vals = n.fetch('vals')
+        state = {"in_save": False, "done": False, "raised": 0}
+        def modify():
+            while not state["done"]:
+                if state["in_save"]:
+                    for f in [lambda : n.set(int64(1)),
+                              lambda : n_vals.reset(),
+                              lambda : n.fetch('new')]:
+                        try:
+                            f()
+                        except RuntimeError:
+                            state["raised"] += 1
+                time.sleep(0.001)
+        t = threading.Thread(target=modify)
+        t.start()
+        time.sleep(0.01)
+        state["in_save"] = True
+        relay.io.save(n,"tout_python_relay_io_in_use.conduit_bin")
+        state["in_save"] = False
+        state["done"] = True
+        t.join()
+        self.assertGreater(state["raised"], 0)
+        # the node can be changed once the call returns
+        n['extra'] = int64(1)
+        self.assertTrue(n.has_child('extra'))
+
+    def test_threaded_io_errors(self):
+        # errors raised while the GIL is released still reach python
+        errs = []
+        def bad_load():
+            try:
+                relay.io.load(Node(),"pile_of_threaded_garbage.conduit_bin")
+            except IOError:
+                errs.append(True)
+        threads = [ threading.Thread(target=bad_load) for i in range(4) ]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+        self.assertEqual(len(errs),4)
+
 
 
 
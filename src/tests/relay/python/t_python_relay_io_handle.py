@@ -10,6 +10,7 @@
 import sys
 import os
 import unittest
+import threading
 
 from numpy import *
 from conduit import Node
@@ -281,6 +282,37 @@ class Test_Relay_IO_Handle(unittest.TestCase):
                 h.read(node=n_read,options=opts)
 
 
+    def test_io_handle_threaded_writes(self):
+        # calls on one handle from several threads are serialized
+        test_file = "tout_python_relay_io_handle_threaded.conduit_bin"
+        if os.path.isfile(test_file):
+            os.remove(test_file)
+        nthreads = 4
+        h = conduit.relay.io.IOHandle()
+        h.open(test_file)
+        missing = []
+        def write_vals(idx):
+            for i in range(50):
+                n_val = conduit.Node()
+                n_val.set(arange(1000, dtype=float64) * idx)
+                h.write(n_val,"thread_%d/val_%d" % (idx,i))
+                if not h.has_path("thread_%d/val_%d" % (idx,i)):
+                    missing.append((idx,i))
+        threads = [ threading.Thread(target=write_vals, args=(i,))
+                    for i in range(nthreads) ]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+        h.close()
+        self.assertEqual(len(missing), 0)
+        n = conduit.Node()
+        relay.io.load(n,test_file)
+        self.assertEqual(n.number_of_children(), nthreads)
+        for idx in range(nthreads):
+            self.assertEqual(n["thread_%d" % idx].number_of_children(), 50)
+            self.assertEqual(n["thread_%d/val_49" % idx][999], 999.0 * idx)
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -984,6 +984,99 @@ TEST(conduit_mpi_test, all_gather_using_schema_simple)
 }
 
 
+//-----------------------------------------------------------------------------
+TEST(conduit_mpi_test, gather_using_schema_options)
+{
+    int rank = mpi::rank(MPI_COMM_WORLD);
+    int com_size = mpi::size(MPI_COMM_WORLD);
+
+    Node n;
+    n["values/a"] = rank+1;
+    n["values/b"] = rank+2;
+    n["values/c"] = rank+3;
+    if(rank != 0)
+    {
+        n["values/d"] = rank+4;
+    }
+
+    for(int root = 0; root < com_size; root++)
+    {
+        Node rcv_flat, rcv_hier, opts, info;
+        mpi::gather_using_schema(n,rcv_flat,root,MPI_COMM_WORLD);
+
+        opts["hierarchical"] = "true";
+        mpi::gather_using_schema(n,rcv_hier,root,MPI_COMM_WORLD,opts);
+
+        if(rank == root)
+        {
+            EXPECT_EQ(rcv_hier.number_of_children(),com_size);
+            EXPECT_FALSE(rcv_flat.diff(rcv_hier,info));
+        }
+
+        Node rcv_packed;
+        opts["output"] = "packed";
+        mpi::gather_using_schema(n,rcv_packed,root,MPI_COMM_WORLD,opts);
+
+        if(rank == root)
+        {
+            rcv_packed.print();
+            // rank 0's schema differs from the rest
+            index_t num_schemas = com_size > 1 ? 2 : 1;
+            EXPECT_EQ(rcv_packed["schemas"].number_of_children(),num_schemas);
+
+            int64_array offsets = rcv_packed["offsets"].value();
+            int64_array sizes   = rcv_packed["sizes"].value();
+            EXPECT_EQ(offsets[0],0);
+            EXPECT_EQ(sizes[0],(int64)(3 * sizeof(int)));
+            if(com_size > 1)
+            {
+                EXPECT_EQ(offsets[1],(int64)(3 * sizeof(int)));
+                EXPECT_EQ(sizes[1],(int64)(4 * sizeof(int)));
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_mpi_test, all_gather_using_schema_options)
+{
+    int rank = mpi::rank(MPI_COMM_WORLD);
+
+    Node n;
+    n["values/a"] = rank+1;
+    n["values/b"] = rank+2;
+    n["values/c"] = rank+3;
+    if(rank != 0)
+    {
+        n["values/d"] = rank+4;
+    }
+
+    Node rcv_flat, rcv_hier, opts, info;
+    mpi::all_gather_using_schema(n,rcv_flat,MPI_COMM_WORLD);
+
+    opts["hierarchical"] = "true";
+    mpi::all_gather_using_schema(n,rcv_hier,MPI_COMM_WORLD,opts);
+    rcv_hier.print();
+
+    EXPECT_FALSE(rcv_flat.diff(rcv_hier,info));
+
+    // packed output w/o shared memory
+    Node rcv_packed;
+    opts["hierarchical"] = "false";
+    opts["output"] = "packed";
+    mpi::all_gather_using_schema(n,rcv_packed,MPI_COMM_WORLD,opts);
+
+    int64_array schema_ids = rcv_packed["schema_ids"].value();
+    EXPECT_EQ(schema_ids.number_of_elements(),
+              (index_t)mpi::size(MPI_COMM_WORLD));
+    EXPECT_EQ(schema_ids[0],0);
+
+    int *res_ptr = (int*)rcv_packed["data"].element_ptr(0);
+    EXPECT_EQ(res_ptr[0],1);
+    EXPECT_EQ(res_ptr[1],2);
+    EXPECT_EQ(res_ptr[2],3);
+}
+
 //-----------------------------------------------------------------------------
 TEST(conduit_mpi_test, bcast)
 {
@@ -9,7 +9,12 @@
 //-----------------------------------------------------------------------------
 
 #include "conduit_relay.hpp"
+#include "civetweb.h"
+#include <atomic>
+#include <cstdlib>
 #include <iostream>
+#include <sstream>
+#include <thread>
 #include "gtest/gtest.h"
 
 #include "t_config.hpp"
@@ -71,6 +76,310 @@ TEST(conduit_relay_web, node_viewer)
     delete n;
 }
 
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_web, node_viewer_pages)
+{
+    Node n;
+    n["a"] = (int64) 20;
+    n["fields/p/values"].set(DataType::float64(100));
+    float64_array vals = n["fields/p/values"].value();
+    for(index_t i = 0; i < 100; i++)
+    {
+        vals[i] = (float64) i;
+    }
+    for(index_t i = 0; i < 10; i++)
+    {
+        std::ostringstream oss;
+        oss << "fields/f_" << i;
+        n[oss.str()] = (int32) i;
+    }
+    n["fields/deep/deeper/leaf"] = "str";
+
+    web::NodeViewerRequestHandler handler;
+    handler.set_node(&n);
+
+    // ranged leaf values
+    std::ostringstream oss;
+    EXPECT_TRUE(handler.write_value_page("fields/p/values",10,5,oss));
+    Node res;
+    res.parse(oss.str(),"json");
+    res.print();
+    EXPECT_EQ(res["number_of_elements"].to_int64(), 100);
+    EXPECT_EQ(res["start"].to_int64(), 10);
+    EXPECT_EQ(res["count"].to_int64(), 5);
+    EXPECT_EQ(res["datavalue"].dtype().number_of_elements(), 5);
+    EXPECT_EQ(res["datavalue"].as_float64_accessor()[0], 10.0);
+    EXPECT_EQ(res["datavalue"].as_float64_accessor()[4], 14.0);
+
+    // windows past the end are clamped
+    oss.str("");
+    EXPECT_TRUE(handler.write_value_page("fields/p/values",98,10,oss));
+    res.parse(oss.str(),"json");
+    EXPECT_EQ(res["count"].to_int64(), 2);
+    EXPECT_EQ(res["datavalue"].as_float64_accessor()[1], 99.0);
+
+    // a single element is still returned as an array
+    oss.str("");
+    EXPECT_TRUE(handler.write_value_page("fields/p/values",3,1,oss));
+    EXPECT_NE(oss.str().find("[3.0]"), std::string::npos);
+
+    // a window of children
+    oss.str("");
+    EXPECT_TRUE(handler.write_value_page("fields",1,2,oss));
+    res.parse(oss.str(),"json");
+    EXPECT_EQ(res["number_of_children"].to_int64(), 12);
+    EXPECT_EQ(res["datavalue"].number_of_children(), 2);
+    EXPECT_EQ(res["datavalue/f_0"].to_int64(), 0);
+    EXPECT_EQ(res["datavalue/f_1"].to_int64(), 1);
+
+    // missing paths
+    oss.str("");
+    EXPECT_FALSE(handler.write_value_page("fields/bad",0,1,oss));
+    EXPECT_FALSE(handler.write_schema_page("fields/bad",0,1,-1,oss));
+
+    // schema page with a depth limit
+    oss.str("");
+    EXPECT_TRUE(handler.write_schema_page("fields",0,-1,0,oss));
+    res.parse(oss.str(),"json");
+    res.print();
+    EXPECT_EQ(res["number_of_children"].to_int64(), 12);
+    EXPECT_EQ(res["count"].to_int64(), 12);
+    EXPECT_TRUE(res["schema/p/truncated"].to_int() != 0);
+    EXPECT_EQ(res["schema/p/number_of_children"].to_int64(), 1);
+    EXPECT_EQ(res["schema/f_3/dtype"].as_string(), "int32");
+
+    oss.str("");
+    EXPECT_TRUE(handler.write_schema_page("fields",11,5,1,oss));
+    res.parse(oss.str(),"json");
+    EXPECT_EQ(res["count"].to_int64(), 1);
+    EXPECT_TRUE(res["schema/deep/deeper/truncated"].to_int() != 0);
+
+    // the same page again comes from the cache
+    std::string page = oss.str();
+    oss.str("");
+    EXPECT_TRUE(handler.write_schema_page("fields",11,5,1,oss));
+    EXPECT_EQ(oss.str(), page);
+
+    // cached pages are checked against the node at path
+    n["fields/f_new"] = (int32) 1;
+    oss.str("");
+    EXPECT_TRUE(handler.write_schema_page("fields",0,-1,0,oss));
+    res.parse(oss.str(),"json");
+    EXPECT_EQ(res["number_of_children"].to_int64(), 13);
+
+    // a replaced subtree with the same shape is not served from the cache
+    oss.str("");
+    EXPECT_TRUE(handler.write_schema_page("fields/deep",0,-1,-1,oss));
+    EXPECT_NE(oss.str().find("deeper"), std::string::npos);
+    Node n_other;
+    n_other["other/leaf"] = "str";
+    n["fields/deep"].swap(n_other);
+    oss.str("");
+    EXPECT_TRUE(handler.write_schema_page("fields/deep",0,-1,-1,oss));
+    EXPECT_EQ(oss.str().find("deeper"), std::string::npos);
+    EXPECT_NE(oss.str().find("other"), std::string::npos);
+}
+
+//-----------------------------------------------------------------------------
+// sends a request to a local server, returns the http status code
+// (or -1 on error) and the response body
+int
+send_request(int port,
+             const std::string &request,
+             std::string &response)
+{
+    char ebuf[256];
+    struct mg_connection *conn = mg_download("127.0.0.1",
+                                             port,
+                                             0,
+                                             ebuf,
+                                             sizeof(ebuf),
+                                             "%s",
+                                             request.c_str());
+    if(conn == NULL)
+    {
+        std::cout << "request failed: " << ebuf << std::endl;
+        return -1;
+    }
+
+    // for client connections, uri holds the response code
+    int status = atoi(mg_get_request_info(conn)->uri);
+
+    char buf[1024];
+    int  len = 0;
+    response.clear();
+    while( (len = mg_read(conn, buf, sizeof(buf))) > 0)
+    {
+        response.append(buf, (size_t)len);
+    }
+    mg_close_connection(conn);
+    return status;
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_web, node_viewer_post_data_limit)
+{
+    Node n;
+    n["a"] = (int64) 20;
+
+    int port = 8089;
+    web::NodeViewerServer svr;
+    svr.set_port(port);
+    svr.set_node(&n);
+    svr.serve();
+
+    std::string header = "POST /api/get-value HTTP/1.1\r\n"
+                         "Host: 127.0.0.1\r\n"
+                         "Content-Type: application/x-www-form-urlencoded\r\n"
+                         "Connection: close\r\n";
+    std::string response;
+
+    // small post data is read as args
+    std::string body = "path=a";
+    std::ostringstream oss;
+    oss << header
+        << "Content-Length: " << body.size() << "\r\n\r\n"
+        << body;
+    EXPECT_EQ(send_request(port, oss.str(), response), 200);
+    Node res;
+    res.parse(response,"json");
+    EXPECT_EQ(res["datavalue"].to_int64(), 20);
+
+    // post data past the limit is rejected
+    body = "path=a&pad=" + std::string(100 * 1024, 'x');
+    oss.str("");
+    oss << header
+        << "Content-Length: " << body.size() << "\r\n\r\n"
+        << body;
+    EXPECT_EQ(send_request(port, oss.str(), response), 413);
+    res.parse(response,"json");
+    EXPECT_TRUE(res.has_child("error"));
+
+    // including when the size is not known up front
+    oss.str("");
+    oss << header
+        << "Transfer-Encoding: chunked\r\n\r\n";
+    std::string chunk(16 * 1024, 'x');
+    for(int i = 0; i < 8; i++)
+    {
+        oss << std::hex << chunk.size() << std::dec << "\r\n"
+            << chunk << "\r\n";
+    }
+    oss << "0\r\n\r\n";
+    EXPECT_EQ(send_request(port, oss.str(), response), 413);
+
+    svr.shutdown();
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_web, node_snapshot_publisher)
+{
+    Node n;
+    n["cycle"] = (int64) 0;
+    n["fields/a"].set(DataType::float64(1000));
+    n["fields/b"].set(DataType::float64(1000));
+    n["coords"].set(DataType::float64(5000));
+
+    web::NodeSnapshotPublisher pub;
+    EXPECT_FALSE(pub.latest());
+    EXPECT_EQ(pub.version(), 0);
+
+    // first publish copies every leaf
+    EXPECT_EQ(pub.publish(n), 4);
+    EXPECT_EQ(pub.version(), 1);
+
+    index_t schema_version = 0;
+    std::shared_ptr<const Node> snap = pub.latest(&schema_version);
+    EXPECT_EQ(schema_version, 1);
+    EXPECT_EQ(snap->fetch_existing("cycle").to_int64(), 0);
+
+    // only changed leaves are copied
+    EXPECT_EQ(pub.publish(n), 0);
+    n["cycle"] = (int64) 1;
+    n["fields/a"].as_float64_ptr()[10] = 1.0;
+    EXPECT_EQ(pub.publish(n), 2);
+
+    // unchanged leaves share buffers across snapshots
+    std::shared_ptr<const Node> snap_3 = pub.latest(&schema_version);
+    EXPECT_EQ(schema_version, 1);
+    EXPECT_EQ(snap->fetch_existing("coords").data_ptr(),
+              snap_3->fetch_existing("coords").data_ptr());
+
+    // snapshots we hold don't change
+    EXPECT_EQ(snap->fetch_existing("cycle").to_int64(), 0);
+    EXPECT_EQ(snap_3->fetch_existing("cycle").to_int64(), 1);
+    EXPECT_EQ(snap_3->fetch_existing("fields/a").as_float64_ptr()[10], 1.0);
+
+    // schema changes bump the schema version
+    n["fields/c"] = (int32) 3;
+    EXPECT_EQ(pub.publish(n), 1);
+    pub.latest(&schema_version);
+    EXPECT_EQ(schema_version, 2);
+
+    // readers see consistent snapshots while a producer publishes
+    float64 *a = n["fields/a"].as_float64_ptr();
+    float64 *b = n["fields/b"].as_float64_ptr();
+    for(index_t i = 0; i < 1000; i++)
+    {
+        a[i] = 1.0;
+        b[i] = 1.0;
+    }
+    pub.publish(n);
+
+    std::atomic<bool> done(false);
+    std::atomic<int>  num_bad(0);
+    std::vector<std::thread> readers;
+    for(int t = 0; t < 4; t++)
+    {
+        readers.push_back(std::thread([&]()
+        {
+            while(!done)
+            {
+                std::shared_ptr<const Node> s = pub.latest();
+                const float64 *a = s->fetch_existing("fields/a").as_float64_ptr();
+                const float64 *b = s->fetch_existing("fields/b").as_float64_ptr();
+                int64 cycle = s->fetch_existing("cycle").to_int64();
+                for(index_t i = 0; i < 1000; i++)
+                {
+                    if(a[i] != (float64)cycle || b[i] != (float64)cycle)
+                    {
+                        num_bad++;
+                        break;
+                    }
+                }
+            }
+        }));
+    }
+
+    for(int64 cycle = 2; cycle < 200; cycle++)
+    {
+        n["cycle"] = cycle;
+        for(index_t i = 0; i < 1000; i++)
+        {
+            a[i] = (float64) cycle;
+            b[i] = (float64) cycle;
+        }
+        // each cycle only copies cycle, a and b
+        EXPECT_EQ(pub.publish(n), 3);
+    }
+
+    done = true;
+    for(size_t t = 0; t < readers.size(); t++)
+    {
+        readers[t].join();
+    }
+    EXPECT_EQ(num_bad, 0);
+
+    // the viewer serves the latest snapshot
+    web::NodeViewerRequestHandler handler;
+    handler.set_snapshot_publisher(&pub);
+    std::ostringstream oss;
+    EXPECT_TRUE(handler.write_value_page("cycle",0,-1,oss));
+    Node res;
+    res.parse(oss.str(),"json");
+    EXPECT_EQ(res["datavalue"].to_int64(), 199);
+}
+
 //-----------------------------------------------------------------------------
 int main(int argc, char* argv[])
 {
@@ -10,6 +10,7 @@
 
 #include "conduit_relay.hpp"
 #include <iostream>
+#include <string.h>
 #include "gtest/gtest.h"
 
 #include "t_config.hpp"
@@ -22,6 +23,150 @@ using namespace conduit::relay;
 bool launch_server = false;
 bool use_ssl       = false;
 bool use_auth      = false;
+bool use_binary    = false;
+
+//-----------------------------------------------------------------------------
+// reads the leaf blocks of a binary stream data message into a node
+// keyed by leaf index
+//-----------------------------------------------------------------------------
+void
+decode_stream_data_msg(const std::vector<uint8> &msg,
+                       Node &res)
+{
+    res.reset();
+    EXPECT_GE(msg.size(), (size_t)24);
+    EXPECT_EQ(std::string((const char*)&msg[0],4), "CDAT");
+
+    uint32 schema_id, num_blocks;
+    uint64 seq;
+    memcpy(&schema_id,  &msg[4],  4);
+    memcpy(&seq,        &msg[8],  8);
+    memcpy(&num_blocks, &msg[16], 4);
+    res["schema_id"] = schema_id;
+    res["sequence"]  = seq;
+
+    Node &blocks = res["blocks"];
+    size_t pos = 24;
+    for(uint32 i = 0; i < num_blocks; i++)
+    {
+        uint32 leaf_idx, num_bytes;
+        memcpy(&leaf_idx,  &msg[pos],     4);
+        memcpy(&num_bytes, &msg[pos + 4], 4);
+        pos += 8;
+        // data must start 8 byte aligned
+        EXPECT_EQ(pos % 8, (size_t)0);
+        std::ostringstream oss;
+        oss << leaf_idx;
+        blocks[oss.str()].set(DataType::uint8(num_bytes));
+        if(num_bytes > 0)
+        {
+            memcpy(blocks[oss.str()].data_ptr(), &msg[pos], num_bytes);
+        }
+        pos += ((num_bytes + 7) / 8) * 8;
+    }
+    EXPECT_EQ(pos, msg.size());
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_web_websocket, stream_encoder)
+{
+    Node data;
+    data["count"] = (int64) 0;
+    data["fields/vals"].set(DataType::float64(4));
+    float64_array vals = data["fields/vals"].value();
+    for(index_t i = 0; i < 4; i++)
+    {
+        vals[i] = (float64) i;
+    }
+    // strided leaf, only every other element is sent
+    std::vector<int32> strided_vals = {10, -1, 20, -1, 30, -1};
+    data["fields/strided"].set_external(DataType::int32(3,0,2*sizeof(int32)),
+                                        strided_vals.data());
+    data["label"] = "ab";
+
+    web::WebStreamEncoder enc;
+    std::string schema_msg;
+    std::vector<uint8> data_msg;
+
+    // first encode includes the schema and every leaf
+    EXPECT_TRUE(enc.encode(data, true, schema_msg, data_msg));
+    EXPECT_EQ(enc.schema_id(), 1);
+    EXPECT_EQ(enc.number_of_leaves(), 4);
+
+    Node schema_info;
+    schema_info.parse(schema_msg,"json");
+    schema_info.print();
+    EXPECT_EQ(schema_info["type"].as_string(), "conduit_stream_schema");
+    EXPECT_EQ(schema_info["schema_id"].to_int64(), 1);
+    EXPECT_EQ(schema_info["leaves"].number_of_children(), 4);
+    EXPECT_EQ(schema_info["leaves"][1]["path"].as_string(), "fields/vals");
+    EXPECT_EQ(schema_info["leaves"][2]["number_of_elements"].to_int64(), 3);
+
+    Node res;
+    decode_stream_data_msg(data_msg, res);
+    EXPECT_EQ(res["schema_id"].to_int64(), 1);
+    EXPECT_EQ(res["sequence"].to_int64(), 0);
+    EXPECT_EQ(res["blocks"].number_of_children(), 4);
+    EXPECT_EQ(res["blocks/1"].dtype().number_of_elements(), 32);
+    float64 *vals_res = (float64*)res["blocks/1"].data_ptr();
+    EXPECT_EQ(vals_res[3], 3.0);
+    int32 *strided_res = (int32*)res["blocks/2"].data_ptr();
+    EXPECT_EQ(strided_res[0], 10);
+    EXPECT_EQ(strided_res[1], 20);
+    EXPECT_EQ(strided_res[2], 30);
+
+    // nothing changed, no schema and no leaf blocks
+    EXPECT_FALSE(enc.encode(data, true, schema_msg, data_msg));
+    EXPECT_TRUE(schema_msg.empty());
+    decode_stream_data_msg(data_msg, res);
+    EXPECT_EQ(res["sequence"].to_int64(), 1);
+    EXPECT_EQ(res["blocks"].number_of_children(), 0);
+
+    // only the changed leaf is sent
+    data["count"] = (int64) 1;
+    EXPECT_FALSE(enc.encode(data, true, schema_msg, data_msg));
+    decode_stream_data_msg(data_msg, res);
+    EXPECT_EQ(res["blocks"].number_of_children(), 1);
+    EXPECT_TRUE(res["blocks"].has_child("0"));
+    EXPECT_EQ(((int64*)res["blocks/0"].data_ptr())[0], 1);
+
+    // without skip_unchanged, every leaf is sent
+    EXPECT_FALSE(enc.encode(data, false, schema_msg, data_msg));
+    decode_stream_data_msg(data_msg, res);
+    EXPECT_EQ(res["blocks"].number_of_children(), 4);
+
+    // a schema change sends a new schema and every leaf
+    data["fields/vals"].set(DataType::float64(8));
+    EXPECT_TRUE(enc.encode(data, true, schema_msg, data_msg));
+    EXPECT_EQ(enc.schema_id(), 2);
+    decode_stream_data_msg(data_msg, res);
+    EXPECT_EQ(res["schema_id"].to_int64(), 2);
+    EXPECT_EQ(res["blocks"].number_of_children(), 4);
+
+    // reset starts over, as done for a new connection
+    enc.reset();
+    EXPECT_TRUE(enc.encode(data, true, schema_msg, data_msg));
+    EXPECT_EQ(enc.schema_id(), 3);
+
+    // changes to the tree that keep the leaf paths are schema changes
+    Node obj, list;
+    obj["0"] = (int64) 1;
+    list.append() = (int64) 1;
+    web::WebStreamEncoder enc_tree;
+    EXPECT_TRUE(enc_tree.encode(obj, true, schema_msg, data_msg));
+    EXPECT_FALSE(enc_tree.encode(obj, true, schema_msg, data_msg));
+    EXPECT_TRUE(enc_tree.encode(list, true, schema_msg, data_msg));
+    EXPECT_FALSE(schema_msg.empty());
+    EXPECT_EQ(enc_tree.schema_id(), 2);
+
+    Node nested, slash_name;
+    nested["a/b"] = (int64) 1;
+    slash_name.add_child("a/b") = (int64) 1;
+    EXPECT_TRUE(slash_name.has_child("a/b"));
+    EXPECT_TRUE(enc_tree.encode(nested, true, schema_msg, data_msg));
+    EXPECT_TRUE(enc_tree.encode(slash_name, true, schema_msg, data_msg));
+    EXPECT_EQ(enc_tree.schema_id(), 4);
+}
 
 TEST(conduit_relay_web_websocket, websocket_test)
 {
@@ -103,7 +248,16 @@ TEST(conduit_relay_web_websocket, websocket_test)
         utils::sleep(1000);
         
         // websocket() returns the first active websocket
-        svr.websocket()->send(msg);
+        if(use_binary)
+        {
+            // only the count changes, so after the first send
+            // only the count leaf is streamed
+            svr.websocket()->send_binary(msg,true);
+        }
+        else
+        {
+            svr.websocket()->send(msg);
+        }
         // or with a very short timeout
         //svr.websocket(10,100)->send(msg);
         
@@ -138,6 +292,11 @@ int main(int argc, char* argv[])
             // the user name and password for this example are both "test"
             use_auth = true;
         }
+        else if(arg_str == "binary")
+        {
+            // test using the binary streaming protocol
+            use_binary = true;
+        }
         
     }
 